@@ -64,7 +64,8 @@ typedef enum
    MDPI_IPC_STATE_FREE = 0,
    MDPI_IPC_STATE_LOCKED,
    MDPI_IPC_STATE_REQUEST,
-   MDPI_IPC_STATE_RESPONSE
+   MDPI_IPC_STATE_RESPONSE,
+   MDPI_IPC_STATE_POSTED
 } mdpi_ipc_state_t;
 
 // clang-format off
@@ -154,6 +155,7 @@ static void __ipc_fini(mdpi_entity_t init);
 
 #define __M_IPC_BACKEND_ATOMIC 1
 #define __M_IPC_BACKEND_SIG 2
+#define __M_IPC_BACKEND_RING 3
 
 #ifndef __M_IPC_BACKEND
 #define __M_IPC_BACKEND __M_IPC_BACKEND_SIG
@@ -167,4 +169,8 @@ static void __ipc_fini(mdpi_entity_t init);
 #include "mdpi_ipc_sig.h"
 #endif
 
+#if __M_IPC_BACKEND == __M_IPC_BACKEND_RING
+#include "mdpi_ipc_ring.h"
+#endif
+
 #endif // __MDPI_IPC_H
\ No newline at end of file
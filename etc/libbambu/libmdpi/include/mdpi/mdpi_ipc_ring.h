@@ -0,0 +1,388 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2023-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file mdpi_ipc_ring.h
+ * @brief Multi-slot ring buffer IPC backend with posted writes and spin-then-futex waiting.
+ *
+ */
+
+/*
+ * Never include this file directly; use <mdpi/mdpi_ipc.h> instead.
+ */
+
+#ifndef __MDPI_IPC_RING_H
+#define __MDPI_IPC_RING_H
+
+#define __USE_FILE_OFFSET64
+#define _FILE_OFFSET_BITS 64
+
+#ifndef __cplusplus
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#else
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#define _Atomic(X) std::atomic<X>
+#endif
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+/* Number of operations which may be in flight between simulator and driver (must be a power of two) */
+#ifndef __M_IPC_BACKEND_RING_SIZE
+#define __M_IPC_BACKEND_RING_SIZE 64
+#endif
+/* Maximum number of polling iterations before sleeping on a futex */
+#ifndef __M_IPC_BACKEND_RING_SPIN
+#define __M_IPC_BACKEND_RING_SPIN 4096
+#endif
+#ifndef __M_IPC_BACKEND_RING_TIMEOUT
+#define __M_IPC_BACKEND_RING_TIMEOUT 1
+#endif
+
+#if(__M_IPC_BACKEND_RING_SIZE & (__M_IPC_BACKEND_RING_SIZE - 1)) != 0
+#error "__M_IPC_BACKEND_RING_SIZE must be a power of two"
+#endif
+
+/* Writes are posted: the simulator does not wait for the driver to complete them */
+#define __M_IPC_POSTED_WRITES 1
+
+typedef struct
+{
+   _Atomic(uint32_t) handle;
+   mdpi_op_t operation;
+} __attribute__((aligned(64))) mdpi_ipc_slot_t;
+
+typedef struct
+{
+   /* Futex word each entity sleeps on, bumped by the remote entity when it changes the state of a slot */
+   _Atomic(uint32_t) doorbell[MDPI_ENTITY_COUNT];
+   /* Non-zero while the entity is (about to be) sleeping on its doorbell */
+   _Atomic(uint32_t) waiting[MDPI_ENTITY_COUNT];
+   mdpi_ipc_slot_t ring[__M_IPC_BACKEND_RING_SIZE];
+} __attribute__((aligned(64))) mdpi_ipc_file_t;
+
+static mdpi_ipc_file_t* __m_ipc_file = NULL;
+
+/*
+ * Each entity walks the ring in order: the simulator moves to the next slot when it reserves a new operation, while
+ * the driver moves to the next slot once the current operation has been completed. The slot of the last operation
+ * stays addressable through __m_ipc_operation until the next one is started.
+ */
+static uint32_t __m_ipc_index = 0;
+
+#define __m_ipc_slot (__m_ipc_file->ring[__m_ipc_index & (__M_IPC_BACKEND_RING_SIZE - 1)])
+#define __m_ipc_operation (__m_ipc_slot.operation)
+
+static inline __attribute__((always_inline)) void __ipc_cpu_relax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+   __builtin_ia32_pause();
+#endif
+}
+
+static void __ipc_notify()
+{
+   const int remote = 1 - __LOCAL_ENTITY;
+   if(atomic_load(&__m_ipc_file->waiting[remote]))
+   {
+      atomic_fetch_add(&__m_ipc_file->doorbell[remote], 1u);
+#ifdef __linux__
+      syscall(SYS_futex, (uint32_t*)&__m_ipc_file->doorbell[remote], FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+   }
+}
+
+/*
+ * A slot holding a response the simulator has not requested carries the final state change of the driver, which
+ * must also wake a simulator waiting to reserve that slot.
+ */
+static inline __attribute__((always_inline)) int __ipc_ready(uint32_t handle, mdpi_ipc_state_t state)
+{
+   return handle == (uint32_t)state || (state == MDPI_IPC_STATE_REQUEST && handle == MDPI_IPC_STATE_POSTED) ||
+          (state == MDPI_IPC_STATE_FREE && handle == MDPI_IPC_STATE_RESPONSE);
+}
+
+/*
+ * The polling budget adapts to the observed latency of the remote entity: it doubles when polling was needed and
+ * succeeded, and halves when the wait ends up sleeping, so that no time is burnt polling when both entities share a
+ * single processor.
+ */
+static int __m_ipc_spin = __M_IPC_BACKEND_RING_SPIN;
+
+static void __ipc_wait(mdpi_ipc_state_t state)
+{
+   int i;
+   uint32_t doorbell;
+   for(i = 0; i < __m_ipc_spin; ++i)
+   {
+      if(__ipc_ready(atomic_load(&__m_ipc_slot.handle), state))
+      {
+         if(i && __m_ipc_spin < __M_IPC_BACKEND_RING_SPIN)
+         {
+            __m_ipc_spin <<= 1;
+         }
+         return;
+      }
+      __ipc_cpu_relax();
+   }
+   if(__m_ipc_spin > 1)
+   {
+      __m_ipc_spin >>= 1;
+   }
+   while(1)
+   {
+      doorbell = atomic_load(&__m_ipc_file->doorbell[__LOCAL_ENTITY]);
+      atomic_store(&__m_ipc_file->waiting[__LOCAL_ENTITY], 1u);
+      if(__ipc_ready(atomic_load(&__m_ipc_slot.handle), state))
+      {
+         break;
+      }
+#ifdef __linux__
+      {
+         static const struct timespec tv = {__M_IPC_BACKEND_RING_TIMEOUT, 0};
+         if(syscall(SYS_futex, (uint32_t*)&__m_ipc_file->doorbell[__LOCAL_ENTITY], FUTEX_WAIT, doorbell, &tv, NULL,
+                    0) == -1 &&
+            errno != EAGAIN && errno != EINTR && errno != ETIMEDOUT)
+         {
+            error("Unable to wait on IPC futex.\n");
+            perror("futex failed");
+            abort();
+         }
+      }
+#else
+      (void)doorbell;
+      sched_yield();
+#endif
+   }
+   atomic_store(&__m_ipc_file->waiting[__LOCAL_ENTITY], 0u);
+}
+
+/*
+ * Lock the next slot of the ring: returns non-zero if the driver has terminated, leaving its state change in the slot
+ */
+static int __ipc_reserve_slot()
+{
+   uint32_t expected;
+   ++__m_ipc_index;
+   do
+   {
+      expected = MDPI_IPC_STATE_FREE;
+      __ipc_wait(MDPI_IPC_STATE_FREE);
+      if(atomic_load(&__m_ipc_slot.handle) == MDPI_IPC_STATE_RESPONSE)
+      {
+         return 1;
+      }
+   } while(!atomic_compare_exchange_strong(&__m_ipc_slot.handle, &expected, (uint32_t)MDPI_IPC_STATE_LOCKED));
+   return 0;
+}
+
+static void __ipc_reserve()
+{
+   if(__ipc_reserve_slot())
+   {
+      error("Co-simulation driver terminated: %s (%u)\n", mdpi_state_str(__m_ipc_operation.payload.sc.state),
+            __m_ipc_operation.payload.sc.retval);
+      abort();
+   }
+}
+
+static void __ipc_request()
+{
+   assert(atomic_load(&__m_ipc_slot.handle) == MDPI_IPC_STATE_LOCKED && "Illegal IPC commit operation.");
+   atomic_store(&__m_ipc_slot.handle, (uint32_t)MDPI_IPC_STATE_REQUEST);
+   __ipc_notify();
+}
+
+/*
+ * Commit an operation which does not need a response: the driver frees the slot once it has been processed
+ */
+static void __ipc_post()
+{
+   assert(atomic_load(&__m_ipc_slot.handle) == MDPI_IPC_STATE_LOCKED && "Illegal IPC post operation.");
+   atomic_store(&__m_ipc_slot.handle, (uint32_t)MDPI_IPC_STATE_POSTED);
+   __ipc_notify();
+}
+
+static int __ipc_posted()
+{
+   return atomic_load(&__m_ipc_slot.handle) == MDPI_IPC_STATE_POSTED;
+}
+
+static void __ipc_response()
+{
+   const uint32_t handle = atomic_load(&__m_ipc_slot.handle);
+   assert((handle == MDPI_IPC_STATE_REQUEST || handle == MDPI_IPC_STATE_POSTED) && "Illegal IPC complete operation.");
+   atomic_store(&__m_ipc_slot.handle,
+                (uint32_t)(handle == MDPI_IPC_STATE_POSTED ? MDPI_IPC_STATE_FREE : MDPI_IPC_STATE_RESPONSE));
+   ++__m_ipc_index;
+   __ipc_notify();
+}
+
+static void __ipc_release()
+{
+   atomic_store(&__m_ipc_slot.handle, (uint32_t)MDPI_IPC_STATE_FREE);
+   __ipc_notify();
+}
+
+static void __ipc_exit(mdpi_ipc_state_t ipc_state, mdpi_state_t state, uint8_t retval)
+{
+   uint32_t expected, skipped = 0;
+   if(__LOCAL_ENTITY == MDPI_ENTITY_SIM)
+   {
+      /* Operations still queued in the ring must reach the driver before the state change */
+      if(__ipc_reserve_slot())
+      {
+         /* The driver has already terminated */
+         return;
+      }
+   }
+   else
+   {
+      /*
+       * The simulator does not wait on posted operations: the state change goes to the first slot which is not
+       * posted, where the simulator is waiting for a response or is going to reserve the next operation. When the
+       * whole ring is posted the simulator is waiting for the oldest slot to be freed.
+       */
+      while(1)
+      {
+         expected = atomic_load(&__m_ipc_slot.handle);
+         if(expected == MDPI_IPC_STATE_POSTED && skipped < __M_IPC_BACKEND_RING_SIZE)
+         {
+            ++__m_ipc_index;
+            ++skipped;
+            continue;
+         }
+         if(expected != MDPI_IPC_STATE_LOCKED &&
+            atomic_compare_exchange_strong(&__m_ipc_slot.handle, &expected, (uint32_t)MDPI_IPC_STATE_LOCKED))
+         {
+            break;
+         }
+      }
+   }
+   __m_ipc_operation.type = MDPI_OP_TYPE_STATE_CHANGE;
+   __m_ipc_operation.payload.sc.state = state;
+   __m_ipc_operation.payload.sc.retval = retval;
+   atomic_store(&__m_ipc_slot.handle, (uint32_t)ipc_state);
+   __ipc_notify();
+}
+
+static void __ipc_init(mdpi_entity_t init)
+{
+   int ipc_descriptor, i;
+
+   debug("IPC memory mapping on file %s\n", __M_IPC_FILENAME);
+   ipc_descriptor = open(__M_IPC_FILENAME, O_RDWR | O_CREAT, 0664);
+   if(ipc_descriptor < 0)
+   {
+      error("Error opening IPC file: %s\n", __M_IPC_FILENAME);
+      perror("MDPI library initialization error");
+      abort();
+   }
+
+   if(init == MDPI_ENTITY_DRIVER)
+   {
+      // Ensure that the file will hold enough space
+      lseek(ipc_descriptor, sizeof(mdpi_ipc_file_t), SEEK_SET);
+      if(write(ipc_descriptor, "", 1) < 1)
+      {
+         error("Error writing IPC file: %s\n", __M_IPC_FILENAME);
+         perror("MDPI library initialization error");
+         abort();
+      }
+      lseek(ipc_descriptor, 0, SEEK_SET);
+   }
+
+   __m_ipc_file =
+       (mdpi_ipc_file_t*)mmap(NULL, sizeof(mdpi_ipc_file_t), PROT_READ | PROT_WRITE, MAP_SHARED, ipc_descriptor, 0);
+
+   if(__m_ipc_file == MAP_FAILED)
+   {
+      error("An error occurred while mapping IPC address range.\n");
+      perror("MDPI library initialization error");
+      abort();
+   }
+   debug("IPC file memory-mapping completed.\n");
+
+   if(init == MDPI_ENTITY_DRIVER)
+   {
+      for(i = 0; i < MDPI_ENTITY_COUNT; ++i)
+      {
+         atomic_store(&__m_ipc_file->doorbell[i], 0u);
+         atomic_store(&__m_ipc_file->waiting[i], 0u);
+      }
+      for(i = 0; i < __M_IPC_BACKEND_RING_SIZE; ++i)
+      {
+         atomic_store(&__m_ipc_file->ring[i].handle, (uint32_t)MDPI_IPC_STATE_FREE);
+         mdpi_op_init(&__m_ipc_file->ring[i].operation);
+      }
+   }
+
+   __m_ipc_index = init == MDPI_ENTITY_SIM ? UINT32_MAX : 0;
+
+   close(ipc_descriptor);
+}
+
+static void __ipc_init1()
+{
+}
+
+static void __ipc_fini(__attribute__((unused)) mdpi_entity_t init)
+{
+   if(munmap(__m_ipc_file, sizeof(mdpi_ipc_file_t)))
+   {
+      error("An error occurred while unmapping IPC address range.\n");
+      perror("MDPI library finalization error");
+   }
+   if(init == MDPI_ENTITY_DRIVER)
+   {
+      remove(__M_IPC_FILENAME);
+   }
+}
+
+#endif // __MDPI_IPC_RING_H
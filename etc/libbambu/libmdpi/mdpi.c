@@ -210,6 +210,14 @@ int m_write(uint8_t id, CONSTARG svLogicVecVal* data, uint16_t bitsize, ptr_t ad
 #endif
       __m_ipc_operation.payload.interface.buffer[i] = data[i / 4].aval >> byte_offset(i);
    }
+#ifdef __M_IPC_POSTED_WRITES
+   if(!shift)
+   {
+      /* The result of plain writes is not used by the simulation: the driver completes them asynchronously */
+      __ipc_post();
+      return 0;
+   }
+#endif
    __ipc_request();
    __ipc_wait(MDPI_IPC_STATE_RESPONSE);
 
@@ -97,6 +97,10 @@ static std::unique_ptr<memmap> __m_mapper;
 
 static std::vector<std::unique_ptr<interface>> __m_interfaces;
 
+#ifdef __M_IPC_POSTED_WRITES
+static bool __m_posted_error = false;
+#endif
+
 void __m_interface_set(uint8_t id, interface* if_manager)
 {
    if(__m_interfaces.size() <= id)
@@ -115,10 +119,100 @@ void __m_interface_fini()
 class device_memmap : public memmap
 {
  private:
+   /// Contiguous simulator address range [base, top) mapped at host address base + offset
+   struct mmu_range
+   {
+      ptr_t base;
+      ptr_t top;
+      bptr_t offset;
+      /// True when the host range overlaps the one of another simulator range
+      bool aliased;
+   };
+
+   /// Host address range [base, top) of the simulator range at index range
+   struct host_range
+   {
+      bptr_t base;
+      bptr_t top;
+      /// Highest top among this and all the preceding host ranges
+      bptr_t max_top;
+      size_t range;
+   };
+
    std::map<ptr_t, bptr_t> __m_mmu;
 
+   /// Flat views of __m_mmu rebuilt lazily after map calls, sorted by simulator and host base address respectively
+   std::vector<mmu_range> __m_sim_ranges;
+   std::vector<host_range> __m_host_ranges;
+   bool __m_dirty;
+
+   /// Indices in __m_sim_ranges of the last successful translations in each direction
+   size_t __m_addrmap_hit;
+   size_t __m_mapaddr_hit;
+
+   void rebuild()
+   {
+      __m_sim_ranges.clear();
+      __m_host_ranges.clear();
+      for(std::map<ptr_t, bptr_t>::const_iterator it = __m_mmu.begin(), next; it != __m_mmu.end(); it = next)
+      {
+         next = it;
+         ++next;
+         if(it->second && next != __m_mmu.end())
+         {
+            __m_sim_ranges.push_back(mmu_range{it->first, next->first, it->second, false});
+         }
+      }
+      __m_host_ranges.reserve(__m_sim_ranges.size());
+      for(size_t i = 0; i < __m_sim_ranges.size(); ++i)
+      {
+         const mmu_range& r = __m_sim_ranges[i];
+         __m_host_ranges.push_back(host_range{r.offset + r.base, r.offset + r.top, nullptr, i});
+      }
+      std::stable_sort(__m_host_ranges.begin(), __m_host_ranges.end(),
+                       [](const host_range& a, const host_range& b) { return a.base < b.base; });
+      bptr_t max_top = nullptr;
+      size_t max_range = 0;
+      for(host_range& r : __m_host_ranges)
+      {
+         if(r.base < max_top)
+         {
+            __m_sim_ranges[r.range].aliased = true;
+            __m_sim_ranges[max_range].aliased = true;
+         }
+         if(max_top < r.top)
+         {
+            max_top = r.top;
+            max_range = r.range;
+         }
+         r.max_top = max_top;
+      }
+      __m_addrmap_hit = __m_mapaddr_hit = __m_sim_ranges.size();
+      __m_dirty = false;
+   }
+
+   void addrmap_error(ptr_t sim_addr)
+   {
+      std::map<ptr_t, bptr_t>::iterator mmu_it = --__m_mmu.upper_bound(sim_addr);
+      std::map<ptr_t, bptr_t>::iterator mmu_base;
+      if(mmu_it == __m_mmu.begin())
+      {
+         mmu_base = ++mmu_it;
+         ++mmu_it;
+      }
+      else
+      {
+         mmu_base = mmu_it;
+         --mmu_base;
+      }
+      error("Nearest memory space is [" PTR_FORMAT ", " PTR_FORMAT "] -> [" BPTR_FORMAT ", " BPTR_FORMAT
+            "] (%zu bytes).\n",
+            mmu_base->first, mmu_it->first, bptr_to_int(mmu_base->second + mmu_base->first),
+            bptr_to_int(mmu_base->second + mmu_it->first), static_cast<size_t>(mmu_it->first - mmu_base->first));
+   }
+
  public:
-   device_memmap()
+   device_memmap() : __m_dirty(true), __m_addrmap_hit(0), __m_mapaddr_hit(0)
    {
       __m_mmu[0] = NULL;
    }
@@ -126,6 +220,7 @@ class device_memmap : public memmap
    int map(ptr_t dst, void* src, size_t bytes) override
    {
       bptr_t bits = reinterpret_cast<bptr_t>(src);
+      __m_dirty = true;
       info("Address " BPTR_FORMAT " mapped at " PTR_FORMAT " (%zu bytes)\n", bptr_to_int(bits), dst, bytes);
 
       const std::pair<std::map<ptr_t, bptr_t>::iterator, bool> base = __m_mmu.insert(std::make_pair(dst, bits - dst));
@@ -194,50 +289,66 @@ class device_memmap : public memmap
 
    bptr_t addrmap(ptr_t sim_addr) override
    {
-      std::map<ptr_t, bptr_t>::iterator mmu_it = --__m_mmu.upper_bound(sim_addr);
-      if(mmu_it != __m_mmu.begin() && mmu_it->second)
+      if(__m_dirty)
       {
-         bptr_t addr = mmu_it->second + sim_addr;
-         return addr;
+         rebuild();
       }
-      std::map<ptr_t, bptr_t>::iterator mmu_base;
-      if(mmu_it == __m_mmu.begin())
+      if(__m_addrmap_hit < __m_sim_ranges.size())
       {
-         mmu_base = ++mmu_it;
-         ++mmu_it;
+         const mmu_range& hit = __m_sim_ranges[__m_addrmap_hit];
+         if(hit.base <= sim_addr && sim_addr < hit.top)
+         {
+            return hit.offset + sim_addr;
+         }
       }
-      else
+      std::vector<mmu_range>::const_iterator it =
+          std::upper_bound(__m_sim_ranges.begin(), __m_sim_ranges.end(), sim_addr,
+                           [](ptr_t addr, const mmu_range& r) { return addr < r.base; });
+      if(it != __m_sim_ranges.begin() && sim_addr < (--it)->top)
       {
-         mmu_base = mmu_it;
-         --mmu_base;
+         __m_addrmap_hit = static_cast<size_t>(it - __m_sim_ranges.begin());
+         return it->offset + sim_addr;
       }
-      error("Nearest memory space is [" PTR_FORMAT ", " PTR_FORMAT "] -> [" BPTR_FORMAT ", " BPTR_FORMAT
-            "] (%zu bytes).\n",
-            mmu_base->first, mmu_it->first, bptr_to_int(mmu_base->second + mmu_base->first),
-            bptr_to_int(mmu_base->second + mmu_it->first), static_cast<size_t>(mmu_it->first - mmu_base->first));
+      addrmap_error(sim_addr);
       return 0;
    }
 
    ptr_t mapaddr(const bptr_t addr) override
    {
-      std::map<ptr_t, bptr_t>::iterator curr = __m_mmu.begin(), prev;
-      do
+      if(__m_dirty)
       {
-         if(curr->second)
+         rebuild();
+      }
+      if(__m_mapaddr_hit < __m_sim_ranges.size())
+      {
+         const mmu_range& hit = __m_sim_ranges[__m_mapaddr_hit];
+         if((hit.offset + hit.base) <= addr && addr < (hit.offset + hit.top))
          {
-            prev = curr++;
+            return addr - hit.offset;
          }
-         else
+      }
+      /* Host ranges may overlap when the same buffer is mapped more than once: walk back while a preceding range
+       * may still contain addr and pick the lowest simulator address among the matching ones. */
+      std::vector<host_range>::const_iterator it =
+          std::upper_bound(__m_host_ranges.begin(), __m_host_ranges.end(), addr,
+                           [](const bptr_t a, const host_range& r) { return a < r.base; });
+      size_t match = __m_sim_ranges.size();
+      while(it != __m_host_ranges.begin() && addr < (--it)->max_top)
+      {
+         if(addr < it->top && it->range < match)
          {
-            prev = ++curr;
-            ++curr;
+            match = it->range;
          }
-      } while(prev != __m_mmu.end() && (addr < (prev->first + prev->second) || addr >= (curr->first + prev->second)));
-      if(prev == __m_mmu.end())
+      }
+      if(match == __m_sim_ranges.size())
       {
          return 0;
       }
-      return addr - prev->second;
+      if(!__m_sim_ranges[match].aliased)
+      {
+         __m_mapaddr_hit = match;
+      }
+      return addr - __m_sim_ranges[match].offset;
    }
 };
 
@@ -699,9 +810,11 @@ void __m_sim_start()
    assert(__m_ipc_operation.type == MDPI_OP_TYPE_STATE_CHANGE && "Unexpected simulator request.");
    assert(__m_ipc_operation.payload.sc.state == MDPI_STATE_READY && "Unexpected simulator state.");
    __m_ipc_operation.payload.sc.state = MDPI_STATE_SETUP;
+   // The response may move the IPC channel to another operation slot
+   const mdpi_state_t state = __m_ipc_operation.payload.sc.state;
+   const uint8_t retval = __m_ipc_operation.payload.sc.retval;
    __ipc_response();
-   debug("Simulator state: %s (%u)\n", mdpi_state_str(__m_ipc_operation.payload.sc.state),
-         __m_ipc_operation.payload.sc.retval);
+   debug("Simulator state: %s (%u)\n", mdpi_state_str(state), retval);
    debug("Launch simulation\n");
 
 #ifdef MDPI_PARALLEL_VERIFICATION
@@ -793,6 +906,13 @@ static void* __m_driver_loop(void*)
    while(true)
    {
       __ipc_wait(MDPI_IPC_STATE_REQUEST);
+#ifdef __M_IPC_POSTED_WRITES
+      if(__m_posted_error && !__ipc_posted())
+      {
+         // Failures of posted writes are reported on the first operation the simulator is waiting for
+         __ipc_abort();
+      }
+#endif
       switch(__m_ipc_operation.type)
       {
          case MDPI_OP_TYPE_STATE_CHANGE:
@@ -843,6 +963,13 @@ static void* __m_driver_loop(void*)
                                                                  ->state(__m_ipc_operation.payload.interface.info);
                }
             }
+#ifdef __M_IPC_POSTED_WRITES
+            if(__ipc_posted() && __m_ipc_operation.payload.interface.id == MDPI_IF_IDX_OUT_OF_BOUNDS)
+            {
+               error("Posted write operation failed.\n");
+               __m_posted_error = true;
+            }
+#endif
             __ipc_response();
             break;
          case MDPI_OP_TYPE_IF_EXIT:
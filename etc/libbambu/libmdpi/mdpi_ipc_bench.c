@@ -0,0 +1,189 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2023-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file mdpi_ipc_bench.c
+ * @brief Microbenchmark measuring the transactions per second sustained by the selected MDPI IPC backend.
+ *
+ * The process forks a simulator entity issuing memory reads and writes the same way libmdpi does, while the parent
+ * serves them as the co-simulation driver. Build it once per backend, e.g.:
+ *
+ *    cc -O2 -D__M_IPC_BACKEND=3 -I include mdpi_ipc_bench.c -o mdpi_ipc_bench
+ *    ./mdpi_ipc_bench [transactions] [percentage of writes]
+ *
+ */
+
+/* DPI types are not used here, but mdpi_types.h requires a simulator flavour */
+#ifndef VERILATOR
+#define VERILATOR
+#endif
+
+#include <mdpi/mdpi_types.h>
+
+static mdpi_entity_t __m_bench_entity = MDPI_ENTITY_DRIVER;
+
+#define __LOCAL_ENTITY __m_bench_entity
+#define __M_IPC_FILENAME "/tmp/panda_ipc_bench_mmap"
+#define NDEBUG
+
+#include <mdpi/mdpi_debug.h>
+#include <mdpi/mdpi_ipc.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#if __M_IPC_BACKEND == __M_IPC_BACKEND_ATOMIC
+#define BACKEND_NAME "atomic"
+#elif __M_IPC_BACKEND == __M_IPC_BACKEND_SIG
+#define BACKEND_NAME "sig"
+#elif __M_IPC_BACKEND == __M_IPC_BACKEND_RING
+#define BACKEND_NAME "ring"
+#endif
+
+#define MEMORY_WORDS 4096
+
+static uint32_t memory[MEMORY_WORDS];
+
+static void bench_sim(unsigned long transactions, unsigned int write_percentage)
+{
+   struct timespec start, stop;
+   unsigned long i;
+   uint32_t checksum = 0;
+   double elapsed;
+
+   clock_gettime(CLOCK_MONOTONIC, &start);
+   for(i = 0; i < transactions; ++i)
+   {
+      const int is_write = (i % 100) < write_percentage;
+      __ipc_reserve();
+      __m_ipc_operation.type = is_write ? MDPI_OP_TYPE_IF_WRITE : MDPI_OP_TYPE_IF_READ;
+      __m_ipc_operation.payload.interface.id = 0;
+      __m_ipc_operation.payload.interface.info = 0;
+      __m_ipc_operation.payload.interface.addr = (ptr_t)(i % MEMORY_WORDS);
+      __m_ipc_operation.payload.interface.bitsize = 32;
+      if(is_write)
+      {
+         memcpy(__m_ipc_operation.payload.interface.buffer, &i, sizeof(uint32_t));
+#ifdef __M_IPC_POSTED_WRITES
+         __ipc_post();
+         continue;
+#endif
+      }
+      __ipc_request();
+      __ipc_wait(MDPI_IPC_STATE_RESPONSE);
+      if(!is_write)
+      {
+         uint32_t data;
+         memcpy(&data, __m_ipc_operation.payload.interface.buffer, sizeof(uint32_t));
+         checksum = checksum * 31 + data;
+      }
+      __ipc_release();
+   }
+
+   /* The state change is served after every posted write, so it also accounts for their completion */
+   __ipc_reserve();
+   __m_ipc_operation.type = MDPI_OP_TYPE_STATE_CHANGE;
+   __m_ipc_operation.payload.sc.state = MDPI_STATE_END;
+   __m_ipc_operation.payload.sc.retval = 0;
+   __ipc_request();
+   __ipc_wait(MDPI_IPC_STATE_RESPONSE);
+   __ipc_release();
+   clock_gettime(CLOCK_MONOTONIC, &stop);
+
+   elapsed = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_nsec - start.tv_nsec) * 1e-9;
+   printf("%s: %lu transactions (%u%% writes) in %.3f s: %.0f transactions/s (checksum %08x)\n", BACKEND_NAME,
+          transactions, write_percentage, elapsed, (double)transactions / elapsed, checksum);
+   fflush(stdout);
+}
+
+static void bench_driver()
+{
+   while(1)
+   {
+      __ipc_wait(MDPI_IPC_STATE_REQUEST);
+      if(__m_ipc_operation.type == MDPI_OP_TYPE_STATE_CHANGE)
+      {
+         __ipc_response();
+         break;
+      }
+      if(__m_ipc_operation.type & MDPI_OP_TYPE_IF_READ)
+      {
+         memcpy(__m_ipc_operation.payload.interface.buffer, &memory[__m_ipc_operation.payload.interface.addr],
+                sizeof(uint32_t));
+      }
+      else
+      {
+         memcpy(&memory[__m_ipc_operation.payload.interface.addr], __m_ipc_operation.payload.interface.buffer,
+                sizeof(uint32_t));
+      }
+      __m_ipc_operation.payload.interface.info = 0;
+      __ipc_response();
+   }
+}
+
+int main(int argc, char* argv[])
+{
+   const unsigned long transactions = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+   const unsigned int write_percentage = argc > 2 ? (unsigned int)atoi(argv[2]) : 50;
+   int status;
+   pid_t sim_pid;
+
+   __ipc_init(MDPI_ENTITY_DRIVER);
+   fflush(stdout);
+   sim_pid = fork();
+   if(sim_pid == -1)
+   {
+      perror("fork");
+      return EXIT_FAILURE;
+   }
+   if(!sim_pid)
+   {
+      __m_bench_entity = MDPI_ENTITY_SIM;
+      __ipc_init(MDPI_ENTITY_SIM);
+      bench_sim(transactions, write_percentage);
+      __ipc_fini(MDPI_ENTITY_SIM);
+      _exit(EXIT_SUCCESS);
+   }
+   __ipc_init1();
+   bench_driver();
+   if(waitpid(sim_pid, &status, 0) == -1 || !WIFEXITED(status) || WEXITSTATUS(status))
+   {
+      fprintf(stderr, "Simulator process terminated with error\n");
+      return EXIT_FAILURE;
+   }
+   __ipc_fini(MDPI_ENTITY_DRIVER);
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,39 @@
+#!/bin/bash
+script=$(readlink -e $0)
+root_dir=$(dirname $script)
+
+BATCH_ARGS=("-O2" "--generate-interface=INFER" "--experimental-setup=BAMBU" "--simulate" "--simulator=VERILATOR"
+            "--top-fname=burst_kernel" "--generate-tb=$root_dir/module.c")
+
+run()
+{
+   name=$1
+   shift
+   mkdir -p m_axi_burst_$name
+   cd m_axi_burst_$name
+   timeout 2h bambu $root_dir/module.c "${BATCH_ARGS[@]}" "$@" > bambu.log 2>&1
+   return_value=$?
+   cd ..
+   if test $return_value != 0; then
+      echo "$name failed (see m_axi_burst_$name/bambu.log)"
+      exit $return_value
+   fi
+   echo "$name: $(grep -m 1 'Total cycles' m_axi_burst_$name/bambu.log | sed 's/.*: *//')" | tee -a $results
+}
+
+results=m_axi_burst_results.txt
+rm -f $results
+
+echo "# HLS synthesis, testbench generation and simulation with VERILATOR of the single-beat adapter"
+run single_beat
+echo "# HLS synthesis, testbench generation and simulation with VERILATOR of the burst adapter"
+run burst --m-axi-burst-length=4
+grep -q "Burst *: 4" m_axi_burst_burst/bambu.log || { echo "burst adapter not selected"; exit 1; }
+echo "# Without restrict the bundles may alias, so the single-beat adapter is kept"
+run no_restrict --m-axi-burst-length=4 -DRESTRICT=
+if grep -q "Burst *:" m_axi_burst_no_restrict/bambu.log; then
+   echo "burst adapter selected on aliased bundles"
+   exit 1
+fi
+echo "PASS" | tee -a $results
+exit 0
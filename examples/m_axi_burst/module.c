@@ -0,0 +1,78 @@
+#ifndef RESTRICT
+#define RESTRICT __restrict__
+#endif
+
+#define N 64
+#define N_RECORDS 16
+
+/* With a 32-bit bus and --m-axi-burst-length=4 a line is 16 bytes, so records[6].value (bytes 31-34) and
+ * records[9].value (bytes 46-49) cross a line boundary */
+struct __attribute__((packed)) record
+{
+   unsigned char tag;
+   int value;
+};
+
+#pragma HLS interface port = in mode = m_axi offset = direct bundle = gmem0
+#pragma HLS interface port = out mode = m_axi offset = direct bundle = gmem1
+#pragma HLS interface port = records mode = m_axi offset = direct bundle = gmem2
+int __attribute__((noinline))
+burst_kernel(const int* RESTRICT in, int* RESTRICT out, const struct record* RESTRICT records)
+{
+   int i, acc = 0;
+   /* sequential reads are served by the read prefetch buffer, sequential writes are combined */
+   for(i = 0; i < N; i++)
+   {
+      out[i] = in[i] * 3 + 1;
+   }
+   /* the first read hits the line still held by the write-combining buffer, which is written back first */
+   for(i = 0; i < N; i++)
+   {
+      acc = acc * 3 + out[N - 1 - i];
+   }
+   /* the unaligned fields crossing a line boundary are accessed with single beats; the writes left in the
+    * write-combining buffer are written back by the flush at the end of the function */
+   for(i = 0; i < N_RECORDS; i++)
+   {
+      out[i] += records[i].value + records[i].tag;
+   }
+   return acc;
+}
+
+#ifdef __BAMBU_SIM__
+#include <mdpi/mdpi_user.h>
+#endif
+
+int main()
+{
+   int A[N], B[N], C[N];
+   struct record R[N_RECORDS];
+   int i;
+
+   for(i = 0; i < N; i++)
+   {
+      A[i] = i;
+      B[i] = 0;
+      C[i] = 0;
+   }
+   for(i = 0; i < N_RECORDS; i++)
+   {
+      R[i].tag = (unsigned char)i;
+      R[i].value = 1000 * i - 7;
+   }
+
+#ifdef __BAMBU_SIM__
+   m_param_alloc(0, sizeof(A));
+   m_param_alloc(1, sizeof(B));
+   m_param_alloc(2, sizeof(R));
+#endif
+   burst_kernel(A, B, R);
+   /* B is read through gmem0 after being written through gmem1 by the previous call */
+#ifdef __BAMBU_SIM__
+   m_param_alloc(0, sizeof(B));
+   m_param_alloc(1, sizeof(C));
+   m_param_alloc(2, sizeof(R));
+#endif
+   burst_kernel(B, C, R);
+   return 0;
+}
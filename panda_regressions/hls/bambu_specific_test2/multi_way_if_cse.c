@@ -0,0 +1,44 @@
+/*
+ * The if-else-if chains are merged into multi-way ifs whose conditions repeat comparisons already computed by the
+ * function, so CSE replaces the conditions of the multi-way ifs after the basic block graph has been built
+ */
+int __attribute__((noinline)) classify(int a, int b, int c)
+{
+   int less = a < b;
+   int equal = a == b;
+   int r;
+   if(a < b)
+   {
+      r = b - a;
+   }
+   else if(a == b)
+   {
+      r = c;
+   }
+   else if(a - b > c)
+   {
+      r = a + c;
+   }
+   else
+   {
+      r = a - c;
+   }
+   if(less && c > 0)
+   {
+      r += 3;
+   }
+   else if(equal)
+   {
+      r -= 5;
+   }
+   else if(a < b)
+   {
+      r *= 2;
+   }
+   return r + less * 7 + equal * 11;
+}
+
+int test(int a, int b, int c)
+{
+   return classify(a, b, c) + classify(b, a, c) + classify(a, a, -c);
+}
@@ -0,0 +1,49 @@
+#!/bin/bash
+# Measure the size of the C trace written by the code instrumented for the discrepancy analysis and the time spent to
+# parse it on the CHStone benchmarks.
+# Set BAMBU_BASELINE to a bambu writing the textual trace to compare against it: the results are written in
+# output_CHStone-discrepancy-trace/results.csv as benchmark,tool,trace bytes,parse seconds,total seconds
+abs_script=$(readlink -e $0)
+dir_script=$(dirname $abs_script)
+BENCHMARKS_ROOT="$dir_script/../../examples/CHStone/CHStone"
+if [[ -z "$BAMBU" ]]; then
+   BAMBU="bambu"
+fi
+rm -fr output_CHStone-discrepancy-trace
+mkdir output_CHStone-discrepancy-trace
+cd output_CHStone-discrepancy-trace
+results=$(pwd)/results.csv
+echo "benchmark,tool,trace_bytes,parse_seconds,total_seconds" > $results
+tools=("current:$BAMBU")
+if [[ -n "$BAMBU_BASELINE" ]]; then
+   tools+=("baseline:$BAMBU_BASELINE")
+fi
+return_value=0
+for benchmark in adpcm/adpcm.c aes/aes.c blowfish/bf.c dfadd/dfadd.c dfdiv/dfdiv.c dfmul/dfmul.c dfsin/dfsin.c \
+   gsm/gsm.c jpeg/main.c mips/mips.c motion/mpeg2.c sha/sha_driver.c; do
+   name=$(basename $(dirname $benchmark))
+   for tool in "${tools[@]}"; do
+      label=${tool%%:*}
+      mkdir -p $name/$label
+      cd $name/$label
+      start=$(date +%s.%N)
+      ${tool#*:} -O2 -lm --simulate --experimental-setup=BAMBU --expose-globals --discrepancy --std=gnu89 -v2 \
+         $BENCHMARKS_ROOT/$benchmark > bambu.log 2>&1
+      status=$?
+      end=$(date +%s.%N)
+      if test $status != 0; then
+         echo "$name: $label bambu failed (see $name/$label/bambu.log)"
+         return_value=1
+         cd ../..
+         continue
+      fi
+      trace=$(find . -name '*_discrepancy.data' | head -n 1)
+      trace_bytes=$(stat -c %s "$trace" 2> /dev/null)
+      parse_seconds=$(sed -n 's/.*Parsed C trace file .* in \([0-9.]*\) seconds.*/\1/p' bambu.log | head -n 1)
+      echo "$name,$label,${trace_bytes:-NA},${parse_seconds:-NA},$(echo "$end - $start" | bc)" >> $results
+      cd ../..
+   done
+done
+cd ..
+column -s, -t < $results
+exit $return_value
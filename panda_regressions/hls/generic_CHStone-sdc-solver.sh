@@ -0,0 +1,16 @@
+#!/bin/bash
+
+script_dir="$(dirname $(readlink -e $0))"
+ggo_require_compiler=1
+. $script_dir/generic_getopt.sh
+
+BATCH_ARGS=("--simulate" "-O3" "-fwhole-program" "--speculative-sdc-scheduling" "--clock-period=15" "-D'printf(fmt, ...)='" "--channels-type=MEM_ACC_NN" "--experimental-setup=BAMBU")
+OUT_SUFFIX="${compiler}_CHStone-sdc-solver"
+BENCHMARKS_ROOT="${script_dir}/../../examples/CHStone/CHStone"
+
+python3 $script_dir/../../etc/scripts/test_panda.py --tool=bambu \
+   --args="--configuration-name=${compiler}-O3-wp-NN-SDC-GLPK --ilp-solver=GLPK ${BATCH_ARGS[*]}" \
+   --args="--configuration-name=${compiler}-O3-wp-NN-SDC-NATIVE --ilp-solver=SDC ${BATCH_ARGS[*]}" \
+   -l${BENCHMARKS_ROOT}/../chstone_list \
+   -o "out_${OUT_SUFFIX}" -b${BENCHMARKS_ROOT} \
+   --name="${OUT_SUFFIX}" "$@"
@@ -0,0 +1,41 @@
+#!/bin/bash
+# Check that module binding gives the same datapath when the clique coverings of the different resource types are
+# solved concurrently (--flow-jobs) and when they are solved serially
+abs_script=$(readlink -e $0)
+dir_script=$(dirname $abs_script)
+BENCHMARKS_ROOT="$dir_script/../../examples/CHStone/CHStone"
+if test -f output_test_flow_jobs_binding/finished; then
+   exit 0
+fi
+if [[ -z "$BAMBU" ]]; then
+   BAMBU="bambu"
+fi
+rm -fr output_test_flow_jobs_binding
+mkdir output_test_flow_jobs_binding
+cd output_test_flow_jobs_binding
+return_value=0
+for benchmark in adpcm/adpcm.c dfmul/dfmul.c dfsin/dfsin.c gsm/gsm.c mips/mips.c; do
+   name=$(basename $benchmark .c)
+   for jobs in 1 4; do
+      mkdir -p $name/jobs_$jobs
+      cd $name/jobs_$jobs
+      $BAMBU -O3 -fwhole-program "-D'printf(fmt, ...)='" --top-fname=main --flow-jobs=$jobs \
+         $BENCHMARKS_ROOT/$benchmark > bambu.log 2>&1
+      if test $? != 0; then
+         echo "$name: bambu failed with --flow-jobs=$jobs"
+         exit 1
+      fi
+      cd ../..
+   done
+   # the header comments contain the generation date
+   if ! diff <(grep -v '^//' $name/jobs_1/main.v) <(grep -v '^//' $name/jobs_4/main.v) > $name/binding.diff; then
+      echo "$name: serial and concurrent module binding differ (see $name/binding.diff)"
+      return_value=1
+   fi
+done
+cd ..
+if test $return_value != 0; then
+   exit $return_value
+fi
+touch output_test_flow_jobs_binding/finished
+exit 0
@@ -0,0 +1,37 @@
+#!/bin/bash
+# Check that a second run with the same host profiling cache reuses the profile stored by the first one, even if the
+# two runs use different temporary directories
+abs_script=$(readlink -e $0)
+dir_script=$(dirname $abs_script)
+BENCHMARKS_ROOT="$dir_script/../../examples/CHStone/CHStone"
+if test -f output_test_host_profiling_cache/finished; then
+   exit 0
+fi
+if [[ -z "$BAMBU" ]]; then
+   BAMBU="bambu"
+fi
+rm -fr output_test_host_profiling_cache
+mkdir output_test_host_profiling_cache
+cd output_test_host_profiling_cache
+for run in first second; do
+   mkdir $run
+   cd $run
+   $BAMBU -O2 "-D'printf(fmt, ...)='" --host-profiling --host-profiling-cache=../cache -v2 \
+      $BENCHMARKS_ROOT/adpcm/adpcm.c > bambu.log 2>&1
+   if test $? != 0; then
+      echo "adpcm: bambu failed in the $run run"
+      exit 1
+   fi
+   cd ..
+done
+if ! grep -q "Host profiling cache miss" first/bambu.log; then
+   echo "adpcm: the first run did not miss the empty cache"
+   exit 1
+fi
+if ! grep -q "Host profiling cache hit" second/bambu.log || grep -q "Host profiling cache miss" second/bambu.log; then
+   echo "adpcm: the second run did not hit the cache (see second/bambu.log)"
+   exit 1
+fi
+cd ..
+touch output_test_host_profiling_cache/finished
+exit 0
@@ -0,0 +1,44 @@
+#!/bin/bash
+# Check the minimum initiation interval reported by --loop-ii-analysis for the innermost loop of the matrix
+# multiplication examples: the integer accumulation is chained in a single cycle, the floating point one is bound by
+# the latency of the adder and makes the target II=1 not achievable
+abs_script=$(readlink -e $0)
+dir_script=$(dirname $abs_script)
+EXAMPLES_ROOT="$dir_script/../../examples"
+if test -f output_test_loop_ii_analysis/finished; then
+   exit 0
+fi
+if [[ -z "$BAMBU" ]]; then
+   BAMBU="bambu"
+fi
+rm -fr output_test_loop_ii_analysis
+mkdir output_test_loop_ii_analysis
+cd output_test_loop_ii_analysis
+for example in mm mm_float; do
+   mkdir $example
+   cd $example
+   $BAMBU -O3 --top-fname=mm --loop-ii-analysis=mm=1 --channels-type=MEM_ACC_NN \
+      $EXAMPLES_ROOT/$example/module.c > bambu.log 2>&1
+   if test $? != 0; then
+      echo "$example: bambu failed (see $example/bambu.log)"
+      exit 1
+   fi
+   cd ..
+done
+mm_line=$(grep -m 1 "of mm: target II=1" mm/bambu.log)
+if [[ ! "$mm_line" =~ RecMII=1\) ]]; then
+   echo "mm: unexpected analysis of the innermost loop: $mm_line"
+   exit 1
+fi
+mm_float_line=$(grep -m 1 "of mm: target II=1" mm_float/bambu.log)
+if [[ ! "$mm_float_line" =~ RecMII=([0-9]+)\) ]] || test ${BASH_REMATCH[1]} -le 1; then
+   echo "mm_float: unexpected analysis of the innermost loop: $mm_float_line"
+   exit 1
+fi
+if ! grep -q "Target initiation interval 1 of loop .* of mm is not achievable" mm_float/bambu.log; then
+   echo "mm_float: missing warning on the target initiation interval"
+   exit 1
+fi
+cd ..
+touch output_test_loop_ii_analysis/finished
+exit 0
@@ -0,0 +1,60 @@
+#include "fsm_description.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+namespace
+{
+   /// textual form as printed by to_string: transitions without guards have an empty guard list
+   const char* fsm_text = "S_0 reset start clock;\n"
+                          "1=S_1>4<5;\n"
+                          "S_0 1000 : 1 S_1 0100 :  S_0 0000; \n"
+                          "S_1 01-0 : &0|&2,- S_2 0010 : -,-3|36893488147419103232 S_0 0002 :  S_1 0100; \n"
+                          "S_2 0001 :  S_0 1000; \n";
+} // namespace
+
+BOOST_AUTO_TEST_CASE(fsm_description_round_trip)
+{
+   const auto fsm = fsm_description::parse(fsm_text);
+   BOOST_REQUIRE_EQUAL(fsm_text, fsm->to_string());
+   BOOST_REQUIRE_EQUAL("S_0", fsm->get_reset_state());
+   BOOST_REQUIRE_EQUAL("clock", fsm->clock_port);
+   BOOST_REQUIRE_EQUAL(3, fsm->states.size());
+   BOOST_REQUIRE(fsm->bypass_signals.at(1).at("S_1") == std::set<unsigned int>({4, 5}));
+
+   const auto& S_1 = fsm->states.at(1);
+   BOOST_REQUIRE_EQUAL(fsm_output_vector::DONT_CARE, S_1.outputs.get(2));
+   BOOST_REQUIRE_EQUAL(3, S_1.transitions.size());
+   const auto& one_hot = S_1.transitions.at(0).guards;
+   BOOST_REQUIRE_EQUAL(2, one_hot.size());
+   BOOST_REQUIRE_EQUAL(2, one_hot.at(0).terms.size());
+   BOOST_REQUIRE(one_hot.at(0).terms.at(1).is_bit_position);
+   BOOST_REQUIRE(one_hot.at(0).terms.at(1).value == 2);
+   BOOST_REQUIRE(one_hot.at(1).is_dont_care());
+
+   /// case labels wider than 64 bits are kept
+   const auto& wide = S_1.transitions.at(1).guards.at(1).terms;
+   BOOST_REQUIRE_EQUAL(2, wide.size());
+   BOOST_REQUIRE(!wide.at(0).is_bit_position);
+   BOOST_REQUIRE(wide.at(0).value == -3);
+   BOOST_REQUIRE(wide.at(1).value == integer_cst_t(1) << 65);
+   BOOST_REQUIRE_EQUAL(fsm_output_vector::UNDEFINED, S_1.transitions.at(1).outputs.get(3));
+   BOOST_REQUIRE(S_1.transitions.at(2).guards.empty());
+}
+
+BOOST_AUTO_TEST_CASE(fsm_guard_parse)
+{
+   fsm_guard guard;
+   guard.terms.push_back(fsm_guard::term{true, 7});
+   guard.terms.push_back(fsm_guard::term{false, -(integer_cst_t(1) << 100)});
+   BOOST_REQUIRE_EQUAL("&7|-1267650600228229401496703205376", guard.to_string());
+   BOOST_REQUIRE_EQUAL(guard.to_string(), fsm_guard::parse(guard.to_string()).to_string());
+   BOOST_REQUIRE(fsm_guard::parse("-").is_dont_care());
+
+   /// malformed guards are reported as errors
+   for(const auto malformed : {"", "x", "1|", "&", "&-1", "1-2", "--1", "|3"})
+   {
+      BOOST_CHECK_THROW(fsm_guard::parse(malformed), std::string);
+   }
+}
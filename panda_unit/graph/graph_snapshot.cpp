@@ -0,0 +1,69 @@
+#include "graph_snapshot.hpp"
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/filtered_graph.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+namespace
+{
+   using test_graph = boost::adjacency_list<boost::listS, boost::listS, boost::bidirectionalS, boost::no_property,
+                                            boost::property<boost::edge_weight_t, int>>;
+
+   /// keeps only the edges with positive weight
+   struct positive_edge
+   {
+      const test_graph* g = nullptr;
+
+      bool operator()(const boost::graph_traits<test_graph>::edge_descriptor& e) const
+      {
+         return boost::get(boost::edge_weight, *g, e) > 0;
+      }
+   };
+} // namespace
+
+BOOST_AUTO_TEST_CASE(graph_snapshot_filtered_view)
+{
+   test_graph g;
+   std::vector<boost::graph_traits<test_graph>::vertex_descriptor> v;
+   for(auto i = 0; i < 4; ++i)
+   {
+      v.push_back(boost::add_vertex(g));
+   }
+   boost::add_edge(v[0], v[2], 1, g);
+   boost::add_edge(v[0], v[1], 1, g);
+   boost::add_edge(v[1], v[3], 0, g);
+   boost::add_edge(v[2], v[3], 1, g);
+   boost::add_edge(v[3], v[0], -1, g);
+   boost::add_edge(v[1], v[2], 1, g);
+
+   using view_t = boost::filtered_graph<test_graph, positive_edge>;
+   const view_t view(g, positive_edge{&g});
+   const GraphSnapshot<view_t> snapshot(view);
+   const auto& csr = snapshot.CGetGraph();
+
+   BOOST_REQUIRE_EQUAL(4U, snapshot.GetNumVertices());
+   BOOST_REQUIRE_EQUAL(4U, boost::num_edges(csr));
+   for(auto i = 0U; i < 4; ++i)
+   {
+      BOOST_REQUIRE(snapshot.GetVertex(snapshot.GetIndex(v[i])) == v[i]);
+      BOOST_REQUIRE_EQUAL(i, snapshot.GetIndex(v[i]));
+   }
+
+   /// out edges keep the order of the view
+   std::vector<std::size_t> targets;
+   for(const auto e : boost::make_iterator_range(boost::out_edges(snapshot.GetIndex(v[0]), csr)))
+   {
+      targets.push_back(boost::target(e, csr));
+      BOOST_REQUIRE(boost::source(snapshot.GetEdge(e), g) == v[0]);
+      BOOST_REQUIRE(boost::target(snapshot.GetEdge(e), g) == v[boost::target(e, csr)]);
+   }
+   BOOST_REQUIRE((targets == std::vector<std::size_t>{2, 1}));
+
+   BOOST_REQUIRE_EQUAL(1U, boost::out_degree(snapshot.GetIndex(v[1]), csr));
+   BOOST_REQUIRE_EQUAL(0U, boost::out_degree(snapshot.GetIndex(v[3]), csr));
+   BOOST_REQUIRE_EQUAL(2U, boost::in_degree(snapshot.GetIndex(v[2]), csr));
+   BOOST_REQUIRE_EQUAL(1U, boost::in_degree(snapshot.GetIndex(v[3]), csr));
+   BOOST_REQUIRE_EQUAL(0U, boost::in_degree(snapshot.GetIndex(v[0]), csr));
+}
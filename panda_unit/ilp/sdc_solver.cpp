@@ -0,0 +1,133 @@
+#include "sdc_solver.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <string>
+
+namespace
+{
+   /// adds the row x_a - x_b (sign) rhs
+   void add_difference(sdc_solver& solver, int a, int b, double rhs, meilp_solver::ilp_sign sign,
+                       const std::string& name)
+   {
+      std::map<int, double> coeffs;
+      coeffs[a] = 1.0;
+      coeffs[b] = -1.0;
+      solver.add_row(coeffs, rhs, sign, name);
+   }
+
+   std::map<int, double> solution(const sdc_solver& solver)
+   {
+      std::map<int, double> vars;
+      solver.get_vars_solution(vars);
+      return vars;
+   }
+} // namespace
+
+BOOST_AUTO_TEST_CASE(sdc_solver_feasible)
+{
+   sdc_solver solver;
+   solver.make(4);
+   for(auto i = 0; i < 4; ++i)
+   {
+      solver.set_int(i);
+   }
+   /// x1 >= x0 + 1, x2 >= x0 + 2.5, x3 >= x1 + 1, x3 >= x2, x3 - x0 <= 4
+   add_difference(solver, 1, 0, 1.0, meilp_solver::G, "d01");
+   add_difference(solver, 2, 0, 2.5, meilp_solver::G, "d02");
+   add_difference(solver, 3, 1, 1.0, meilp_solver::G, "d13");
+   add_difference(solver, 3, 2, 0.0, meilp_solver::G, "d23");
+   add_difference(solver, 3, 0, 4.0, meilp_solver::L, "latency");
+   std::map<int, double> objective;
+   objective[3] = 1.0;
+   solver.objective_add(objective, meilp_solver::min);
+   solver.set_lowbo(0, 1.0);
+
+   BOOST_REQUIRE_EQUAL(0, solver.solve_ilp());
+   auto vars = solution(solver);
+   BOOST_REQUIRE_EQUAL(1.0, vars.at(0));
+   BOOST_REQUIRE_EQUAL(2.0, vars.at(1));
+   /// integer variables are rounded up to the least feasible integer
+   BOOST_REQUIRE_EQUAL(4.0, vars.at(2));
+   BOOST_REQUIRE_EQUAL(4.0, vars.at(3));
+
+   /// the relaxation keeps the fractional value
+   BOOST_REQUIRE_EQUAL(0, solver.solve());
+   vars = solution(solver);
+   BOOST_REQUIRE_EQUAL(3.5, vars.at(2));
+   BOOST_REQUIRE_EQUAL(3.5, vars.at(3));
+   BOOST_REQUIRE_EQUAL(5, solver.get_number_constraints());
+   BOOST_REQUIRE_EQUAL(4, solver.get_number_variables());
+}
+
+BOOST_AUTO_TEST_CASE(sdc_solver_infeasible)
+{
+   /// positive cycle: x1 >= x0 + 1 and x0 >= x1
+   sdc_solver cycle;
+   cycle.make(2);
+   add_difference(cycle, 1, 0, 1.0, meilp_solver::G, "forward");
+   add_difference(cycle, 0, 1, 0.0, meilp_solver::G, "backward");
+   BOOST_REQUIRE_EQUAL(1, cycle.solve());
+
+   /// the least solution violates the upper bound of x1
+   sdc_solver bounded;
+   bounded.make(2);
+   add_difference(bounded, 1, 0, 3.0, meilp_solver::G, "delay");
+   bounded.set_upbo(1, 2.0);
+   BOOST_REQUIRE_EQUAL(1, bounded.solve());
+   bounded.set_upbo(1, 3.0);
+   BOOST_REQUIRE_EQUAL(0, bounded.solve());
+
+   /// a constant row forcing a variable below zero cannot be satisfied with non-negative variables
+   sdc_solver negative;
+   negative.make(1);
+   std::map<int, double> coeffs;
+   coeffs[0] = 1.0;
+   negative.add_row(coeffs, -1.0, meilp_solver::L, "negative");
+   BOOST_REQUIRE_EQUAL(1, negative.solve());
+}
+
+BOOST_AUTO_TEST_CASE(sdc_solver_warm_start)
+{
+   const auto build = [](sdc_solver& solver, bool all_rows) {
+      solver.make(5);
+      for(auto i = 0; i < 4; ++i)
+      {
+         add_difference(solver, i + 1, i, 1.0, meilp_solver::G, "chain" + std::to_string(i));
+      }
+      if(all_rows)
+      {
+         add_difference(solver, 2, 0, 5.0, meilp_solver::G, "resource");
+         add_difference(solver, 4, 1, 6.0, meilp_solver::G, "delay");
+      }
+   };
+
+   sdc_solver warm;
+   build(warm, false);
+   BOOST_REQUIRE_EQUAL(0, warm.solve_ilp());
+   BOOST_REQUIRE_EQUAL(4.0, solution(warm).at(4));
+
+   /// rows added after a solve restart from the previous solution
+   add_difference(warm, 2, 0, 5.0, meilp_solver::G, "resource");
+   add_difference(warm, 4, 1, 6.0, meilp_solver::G, "delay");
+   BOOST_REQUIRE_EQUAL(0, warm.solve_ilp());
+
+   sdc_solver cold;
+   build(cold, true);
+   BOOST_REQUIRE_EQUAL(0, cold.solve_ilp());
+   BOOST_REQUIRE(solution(warm) == solution(cold));
+   BOOST_REQUIRE_EQUAL(7.0, solution(warm).at(4));
+
+   /// a relaxed lower bound invalidates the warm solution
+   warm.set_lowbo(0, 2.0);
+   BOOST_REQUIRE_EQUAL(0, warm.solve_ilp());
+   BOOST_REQUIRE_EQUAL(9.0, solution(warm).at(4));
+   warm.set_lowbo(0, 0.0);
+   BOOST_REQUIRE_EQUAL(0, warm.solve_ilp());
+   BOOST_REQUIRE(solution(warm) == solution(cold));
+
+   /// a row closing a positive cycle is detected on the warm re-solve too
+   add_difference(warm, 0, 4, 0.0, meilp_solver::G, "cycle");
+   BOOST_REQUIRE_EQUAL(1, warm.solve_ilp());
+}
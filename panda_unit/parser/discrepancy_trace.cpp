@@ -0,0 +1,182 @@
+#include "parse_discrepancy.hpp"
+
+#include "Discrepancy.hpp"
+#include "UnfoldedCallInfo.hpp"
+#include "UnfoldedFunctionInfo.hpp"
+#include "discrepancy_trace.hpp"
+#include "fileIO.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+   class trace_writer
+   {
+      std::string data;
+
+      void append_le(uint64_t value, unsigned int n_bytes)
+      {
+         for(unsigned int i = 0; i < n_bytes; ++i)
+         {
+            data.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+         }
+      }
+
+    public:
+      trace_writer() : data(DISCREPANCY_TRACE_MAGIC, DISCREPANCY_TRACE_MAGIC_SIZE)
+      {
+      }
+
+      trace_writer& record(discrepancy_trace_record_kind kind, unsigned int id, uint64_t value)
+      {
+         append_le(kind, 4);
+         append_le(id, 4);
+         append_le(value, 8);
+         return *this;
+      }
+
+      /// an operation record followed by the raw bytes of the assigned value
+      trace_writer& op(unsigned int id, uint64_t context, const std::vector<unsigned char>& bytes)
+      {
+         record(DISCR_TRACE_OP, id, context);
+         data.append(bytes.begin(), bytes.end());
+         return *this;
+      }
+
+      /// drops the last bytes, to check the detection of truncated traces
+      trace_writer& truncate(size_t n_bytes)
+      {
+         data.resize(data.size() - n_bytes);
+         return *this;
+      }
+
+      void write(const std::filesystem::path& filename) const
+      {
+         std::ofstream trace(filename, std::ios::binary);
+         trace << data;
+      }
+   };
+
+   DiscrepancyOpInfo op_info(unsigned int op_id, unsigned int bitsize)
+   {
+      DiscrepancyOpInfo info{};
+      info.stg_fun_id = 10;
+      info.op_id = op_id;
+      info.bitsize = bitsize;
+      return info;
+   }
+
+   /// main (function 10) calls function 20 from call statement 5
+   DiscrepancyRef make_discrepancy()
+   {
+      DiscrepancyRef Discr(new Discrepancy());
+      auto& ucg = Discr->DiscrepancyCallGraph;
+      Discr->unfolded_root_v = ucg.AddVertex(NodeInfoRef(new UnfoldedFunctionInfo(10)));
+      const auto called_v = ucg.AddVertex(NodeInfoRef(new UnfoldedFunctionInfo(20)));
+      ucg.AddEdge(Discr->unfolded_root_v, called_v, EdgeInfoRef(new UnfoldedCallInfo(5)));
+      Discr->unfolded_v_to_scope[Discr->unfolded_root_v] = "top/";
+      Discr->unfolded_v_to_scope[called_v] = "top/f20/";
+      Discr->c_op_descriptors.emplace_back(op_info(1, 12), 12);
+      Discr->c_op_descriptors.emplace_back(op_info(2, 33), 33);
+      return Discr;
+   }
+
+   DiscrepancyRef parse(const trace_writer& writer)
+   {
+      const auto trace_file = unique_path(std::filesystem::temp_directory_path() / "discrepancy.%%%%%%.bin");
+      writer.write(trace_file);
+      auto Discr = make_discrepancy();
+      try
+      {
+         parse_discrepancy(trace_file.string(), Discr);
+      }
+      catch(...)
+      {
+         std::filesystem::remove(trace_file);
+         throw;
+      }
+      std::filesystem::remove(trace_file);
+      return Discr;
+   }
+} // namespace
+
+BOOST_AUTO_TEST_CASE(discrepancy_binary_trace)
+{
+   trace_writer writer;
+   writer.record(DISCR_TRACE_ROOT_CONTEXT, 0, 100)
+       .record(DISCR_TRACE_VARDECL, 1, 0x1000)
+       .record(DISCR_TRACE_CONTEXT, 10, 200)
+       .record(DISCR_TRACE_BB, 10, 2)
+       /// the bits above the bitsize in the last byte are ignored
+       .op(0, 200, {0x34, 0xFA})
+       .record(DISCR_TRACE_CALL, 5, 0)
+       .record(DISCR_TRACE_CONTEXT, 20, 300)
+       .record(DISCR_TRACE_VARDECL, 2, 0x2000)
+       .record(DISCR_TRACE_BB, 20, 1)
+       .op(1, 300, {0x01, 0x00, 0x00, 0x80, 0x01})
+       .record(DISCR_TRACE_CONTEXT_END, 0, 0)
+       .record(DISCR_TRACE_BB, 10, 3)
+       .op(0, 200, {0xFF, 0x0F})
+       .record(DISCR_TRACE_CONTEXT_END, 0, 0)
+       .record(DISCR_TRACE_CONTEXT_END, 0, 0);
+   const auto Discr = parse(writer);
+
+   /// every context starts from the address map of its caller
+   BOOST_REQUIRE_EQUAL(3, Discr->c_addr_map.size());
+   BOOST_REQUIRE_EQUAL(1, Discr->c_addr_map.at(100).size());
+   BOOST_REQUIRE_EQUAL(0x1000, Discr->c_addr_map.at(100).at(1));
+   BOOST_REQUIRE_EQUAL(1, Discr->c_addr_map.at(200).size());
+   BOOST_REQUIRE_EQUAL(0x1000, Discr->c_addr_map.at(200).at(1));
+   BOOST_REQUIRE_EQUAL(2, Discr->c_addr_map.at(300).size());
+   BOOST_REQUIRE_EQUAL(0x1000, Discr->c_addr_map.at(300).at(1));
+   BOOST_REQUIRE_EQUAL(0x2000, Discr->c_addr_map.at(300).at(2));
+
+   /// the called context is matched on the call id and the called function
+   BOOST_REQUIRE_EQUAL(2, Discr->context_to_scope.size());
+   BOOST_REQUIRE_EQUAL("top/", Discr->context_to_scope.at(200));
+   BOOST_REQUIRE_EQUAL("top/f20/", Discr->context_to_scope.at(300));
+
+   BOOST_REQUIRE_EQUAL(2, Discr->c_control_flow_trace.size());
+   BOOST_REQUIRE(Discr->c_control_flow_trace.at(10).at(200) == std::list<unsigned int>({2, 3}));
+   BOOST_REQUIRE(Discr->c_control_flow_trace.at(20).at(300) == std::list<unsigned int>({1}));
+
+   BOOST_REQUIRE_EQUAL(2, Discr->c_op_trace.size());
+   const auto& first = Discr->c_op_trace.at(Discr->c_op_descriptors.at(0).first);
+   BOOST_REQUIRE_EQUAL(2, first.size());
+   BOOST_REQUIRE_EQUAL(200, first.front().first);
+   BOOST_REQUIRE_EQUAL("101000110100", first.front().second);
+   BOOST_REQUIRE_EQUAL(200, first.back().first);
+   BOOST_REQUIRE_EQUAL("111111111111", first.back().second);
+   const auto& second = Discr->c_op_trace.at(Discr->c_op_descriptors.at(1).first);
+   BOOST_REQUIRE_EQUAL(1, second.size());
+   BOOST_REQUIRE_EQUAL(300, second.front().first);
+   BOOST_REQUIRE_EQUAL("110000000000000000000000000000001", second.front().second);
+}
+
+BOOST_AUTO_TEST_CASE(discrepancy_binary_trace_malformed)
+{
+   const auto base = [] {
+      trace_writer writer;
+      writer.record(DISCR_TRACE_ROOT_CONTEXT, 0, 100).record(DISCR_TRACE_CONTEXT, 10, 200);
+      return writer;
+   };
+
+   /// truncated record and truncated operation value
+   BOOST_CHECK_THROW(parse(base().record(DISCR_TRACE_BB, 10, 1).truncate(4)), std::string);
+   BOOST_CHECK_THROW(parse(base().op(1, 200, {0x01, 0x00, 0x00, 0x80, 0x01}).truncate(1)), std::string);
+   /// unknown descriptor and unknown record kind
+   BOOST_CHECK_THROW(parse(base().op(2, 200, {0x00})), std::string);
+   BOOST_CHECK_THROW(parse(base().record(static_cast<discrepancy_trace_record_kind>(8), 0, 0)), std::string);
+   /// a record outside of any context
+   BOOST_CHECK_THROW(parse(trace_writer().record(DISCR_TRACE_BB, 10, 1)), std::string);
+   /// a call to a function that is not called from that call statement
+   BOOST_CHECK_THROW(parse(base().record(DISCR_TRACE_CALL, 5, 0).record(DISCR_TRACE_CONTEXT, 30, 300)), std::string);
+}
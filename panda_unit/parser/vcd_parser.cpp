@@ -0,0 +1,109 @@
+#include "vcd_parser.hpp"
+
+#include "fileIO.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace
+{
+   const auto no_end = std::numeric_limits<unsigned long long>::max();
+
+   /**
+    * VCD with scalar, vector, per-bit vector and real signals, a nested scope, a comment and a same-time override
+    */
+   const char* small_vcd = "$date today $end\n"
+                           "$version test $end\n"
+                           "$timescale 1ps $end\n"
+                           "$scope module top $end\n"
+                           "$var wire 1 ! clock $end\n"
+                           "$var wire 4 \" data [3:0] $end\n"
+                           "$var wire 1 # bus [1] $end\n"
+                           "$var wire 1 $ bus [0] $end\n"
+                           "$var real 64 % level $end\n"
+                           "$scope module sub $end\n"
+                           "$var reg 1 & done $end\n"
+                           "$upscope $end\n"
+                           "$upscope $end\n"
+                           "$enddefinitions $end\n"
+                           "$comment initial values $end\n"
+                           "#0\n"
+                           "$dumpvars\n"
+                           "0!\n"
+                           "bX010 \"\n"
+                           "0#\n"
+                           "z$\n"
+                           "r0.5 %\n"
+                           "X&\n"
+                           "$end\n"
+                           "#5\n"
+                           "1!\n"
+                           "b1Z \"\n"
+                           "#10\n"
+                           "0!\n"
+                           "1#\n"
+                           "1$\n"
+                           "r1.25 %\n"
+                           "1&\n"
+                           "#10\n"
+                           "0&\n"
+                           "#15\n"
+                           "1!\n"
+                           "b1111 \"\n"
+                           "0$\n"
+                           "#20\n"
+                           "0!\n";
+
+   void check_trace(const vcd_signal_trace& trace, const std::vector<sig_variation>& expected)
+   {
+      BOOST_REQUIRE_EQUAL(expected.size(), trace.size());
+      auto it = trace.begin();
+      for(const auto& variation : expected)
+      {
+         BOOST_REQUIRE_EQUAL(variation.time_stamp, it->time_stamp);
+         BOOST_REQUIRE_EQUAL(variation.value, it->value);
+         BOOST_REQUIRE_EQUAL(variation.duration, it->duration);
+         ++it;
+      }
+      BOOST_REQUIRE(it == trace.end());
+      /// backward decoding gives the same variations
+      for(auto rit = expected.rbegin(); rit != expected.rend(); ++rit)
+      {
+         --it;
+         BOOST_REQUIRE_EQUAL(rit->time_stamp, it->time_stamp);
+         BOOST_REQUIRE_EQUAL(rit->value, it->value);
+      }
+      BOOST_REQUIRE(it == trace.begin());
+   }
+} // namespace
+
+BOOST_AUTO_TEST_CASE(vcd_parser_small_file)
+{
+   const auto vcd_file = unique_path(std::filesystem::temp_directory_path() / "small.%%%%%%.vcd");
+   {
+      std::ofstream vcd(vcd_file);
+      vcd << small_vcd;
+   }
+   vcd_parser::vcd_filter_t filter;
+   filter["top/"] = {"clock", "data", "bus", "level"};
+   filter["top/sub/"] = {"done"};
+   vcd_parser parser(0);
+   const auto traces = parser.parse_vcd(vcd_file.string(), filter);
+   std::filesystem::remove(vcd_file);
+
+   /// expected traces are the ones of the std::list based parser, with X and Z normalized to lowercase and without the
+   /// duplicate initial variation it added for every extra vcd id of a per-bit vector
+   const auto& top = traces.at("top/");
+   check_trace(top.at("clock"), {{0, "0", 5}, {5, "1", 5}, {10, "0", 5}, {15, "1", 5}, {20, "0", no_end}});
+   check_trace(top.at("data"), {{0, "x010", 5}, {5, "001z", 10}, {15, "1111", no_end}});
+   check_trace(top.at("bus"), {{0, "0z", 10}, {10, "11", 5}, {15, "10", no_end}});
+   check_trace(top.at("level"),
+               {{0, "00000000000000000000000000000000000000000000000000000000000000.5", 10},
+                {10, "0000000000000000000000000000000000000000000000000000000000001.25", no_end}});
+   check_trace(traces.at("top/sub/").at("done"), {{0, "x", 10}, {10, "0", no_end}});
+}
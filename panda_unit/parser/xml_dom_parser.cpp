@@ -0,0 +1,110 @@
+#include "xml_dom_parser.hpp"
+
+#include "fileIO.hpp"
+#include "simple_indent.hpp"
+#include "xml_attribute.hpp"
+#include "xml_document.hpp"
+#include "xml_element.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+   std::string print(const XMLDomParser& parser)
+   {
+      BOOST_REQUIRE(parser);
+      std::stringstream ss;
+      simple_indent PP('<', '>', 2);
+      parser.get_document()->print(ss, false, &PP);
+      return ss.str();
+   }
+
+   void write(const std::filesystem::path& filename, const std::string& content)
+   {
+      std::ofstream file(filename);
+      file << content;
+   }
+
+   std::filesystem::path single_snapshot(const std::filesystem::path& cache_directory)
+   {
+      std::filesystem::path snapshot;
+      for(const auto& entry : std::filesystem::directory_iterator(cache_directory))
+      {
+         BOOST_REQUIRE(snapshot.empty());
+         snapshot = entry.path();
+      }
+      BOOST_REQUIRE_EQUAL(".xbin", snapshot.extension().string());
+      return snapshot;
+   }
+} // namespace
+
+BOOST_AUTO_TEST_CASE(xml_snapshot_round_trip)
+{
+   const auto directory = unique_path(std::filesystem::temp_directory_path() / "xml_snapshot.%%%%%%");
+   std::filesystem::create_directories(directory);
+   const auto source = (directory / "library.xml").string();
+   const auto cache = directory / "cache";
+   write(source, "<?xml version=\"1.0\"?>\n"
+                 "<technology>\n"
+                 "  <library name=\"STD\">\n"
+                 "    <cell name=\"ADD\" area=\"1.5\"><operation operation_name=\"plus_expr\"/></cell>\n"
+                 "    <cell name=\"MUL\" area=\"3\">mul&amp;text</cell>\n"
+                 "  </library>\n"
+                 "</technology>\n");
+
+   XMLDomParser plain(source);
+   plain.Exec();
+
+   /// the first parse stores the snapshot, the second one is rebuilt from it without rewriting it
+   XMLDomParser miss(source);
+   miss.Exec(cache);
+   const auto snapshot = single_snapshot(cache);
+   const auto snapshot_time = std::filesystem::last_write_time(snapshot);
+   XMLDomParser hit(source);
+   hit.Exec(cache);
+   BOOST_REQUIRE(snapshot_time == std::filesystem::last_write_time(snapshot));
+   BOOST_REQUIRE_EQUAL(print(plain), print(miss));
+   BOOST_REQUIRE_EQUAL(print(plain), print(hit));
+   /// line numbers are part of the snapshot
+   const auto* root = hit.get_document()->get_root_node();
+   BOOST_REQUIRE_EQUAL("technology", root->get_name());
+   BOOST_REQUIRE_EQUAL(plain.get_document()->get_root_node()->get_line(), root->get_line());
+   std::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(xml_snapshot_invalidation)
+{
+   const auto directory = unique_path(std::filesystem::temp_directory_path() / "xml_snapshot.%%%%%%");
+   std::filesystem::create_directories(directory);
+   const auto source = (directory / "device.xml").string();
+   const auto cache = directory / "cache";
+   write(source, "<device><vendor value=\"Xilinx\"/></device>\n");
+   XMLDomParser first(source);
+   first.Exec(cache);
+   const auto snapshot = single_snapshot(cache);
+
+   /// same size, different content: the checksum invalidates the snapshot
+   write(source, "<device><vendor value=\"Altera\"/></device>\n");
+   XMLDomParser changed(source);
+   changed.Exec(cache);
+   const auto* vendor = dynamic_cast<const xml_element*>(
+       changed.get_document()->get_root_node()->get_children().front().get());
+   BOOST_REQUIRE(vendor);
+   BOOST_REQUIRE_EQUAL("Altera", vendor->get_attribute("value")->get_value());
+   BOOST_REQUIRE(snapshot == single_snapshot(cache));
+
+   /// a corrupted snapshot is ignored and replaced
+   write(snapshot, "PXMLBIN garbage");
+   XMLDomParser corrupted(source);
+   corrupted.Exec(cache);
+   BOOST_REQUIRE_EQUAL(print(changed), print(corrupted));
+   XMLDomParser restored(source);
+   restored.Exec(cache);
+   BOOST_REQUIRE_EQUAL(print(changed), print(restored));
+   std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,62 @@
+#include "minimum_initiation_interval.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace
+{
+   const double clock_period = 10.0;
+
+   /**
+    * Innermost loop of examples/mm/module.c and examples/mm_float/module.c (sum_mult += in_a[i][k] * in_b[k][j]) in
+    * topological order: 0 phi of k, 1 phi of sum_mult, 2 load of in_a, 3 load of in_b, 4 multiplication, 5
+    * accumulation, 6 increment of k
+    */
+   const std::vector<std::pair<size_t, size_t>> mm_dependences = {{0, 2}, {0, 3}, {2, 4}, {3, 4},
+                                                                  {4, 5}, {1, 5}, {0, 6}};
+   const std::vector<std::pair<size_t, size_t>> mm_carried_dependences = {{5, 1}, {6, 0}};
+} // namespace
+
+BOOST_AUTO_TEST_CASE(resource_mii)
+{
+   BOOST_REQUIRE_EQUAL(1, ResourceMII({}));
+   /// two loads on the two ports of a memory, one pipelined multiplier
+   BOOST_REQUIRE_EQUAL(1, ResourceMII({{2, 2}, {1, 1}}));
+   /// the two loads of mm on a single port memory
+   BOOST_REQUIRE_EQUAL(2, ResourceMII({{2, 1}, {1, 1}}));
+   /// the busy cycles are rounded up to the next multiple of the instances
+   BOOST_REQUIRE_EQUAL(3, ResourceMII({{5, 2}, {3, 3}}));
+   /// a non-pipelined 4-cycle divider used twice
+   BOOST_REQUIRE_EQUAL(8, ResourceMII({{8, 1}, {2, 2}}));
+}
+
+BOOST_AUTO_TEST_CASE(recurrence_mii_mm)
+{
+   /// integer mm: 2-cycle loads, 3-cycle multiplier, chained additions of 2.5ns
+   const std::vector<double> int_delays = {0.0, 0.0, 20.0, 20.0, 30.0, 2.5, 2.5};
+   BOOST_REQUIRE_EQUAL(1, RecurrenceMII(int_delays, mm_dependences, mm_carried_dependences, clock_period));
+
+   /// mm_float: the accumulation is a 4-cycle floating point adder, which closes the recurrence of sum_mult alone
+   const std::vector<double> float_delays = {0.0, 0.0, 20.0, 20.0, 30.0, 40.0, 2.5};
+   BOOST_REQUIRE_EQUAL(4, RecurrenceMII(float_delays, mm_dependences, mm_carried_dependences, clock_period));
+
+   /// the loads and the multiplication do not depend on sum_mult, so they are not part of its recurrence
+   BOOST_REQUIRE_EQUAL(1, RecurrenceMII(int_delays, mm_dependences, {{5, 1}}, clock_period));
+}
+
+BOOST_AUTO_TEST_CASE(recurrence_mii_chaining)
+{
+   /// s = ((s + a) + b) + c: 0 phi of s and three chained additions of 3ns
+   const std::vector<std::pair<size_t, size_t>> chain = {{0, 1}, {1, 2}, {2, 3}};
+   BOOST_REQUIRE_EQUAL(1, RecurrenceMII({0.0, 3.0, 3.0, 3.0}, chain, {{3, 0}}, clock_period));
+   /// a fourth addition does not fit in the clock period
+   BOOST_REQUIRE_EQUAL(2, RecurrenceMII({0.0, 3.0, 3.0, 3.0, 3.0}, {{0, 1}, {1, 2}, {2, 3}, {3, 4}}, {{4, 0}},
+                                        clock_period));
+   /// the longest path through a reconvergent chain closes the recurrence
+   BOOST_REQUIRE_EQUAL(3, RecurrenceMII({0.0, 25.0, 3.0, 2.0}, {{0, 1}, {0, 2}, {1, 3}, {2, 3}}, {{3, 0}},
+                                        clock_period));
+   /// a loop-carried dependence whose source is not reached from its target is not a recurrence
+   BOOST_REQUIRE_EQUAL(1, RecurrenceMII({0.0, 0.0, 50.0}, {{0, 2}}, {{2, 1}}, clock_period));
+}
@@ -2,6 +2,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <chrono>
+#include <vector>
+
 BOOST_AUTO_TEST_CASE(apint_limits)
 {
    BOOST_REQUIRE_EQUAL(std::numeric_limits<uint8_t>::max(), APInt::getMaxValue(8));
@@ -202,3 +205,80 @@ BOOST_AUTO_TEST_CASE(apint_minBitwidth)
    BOOST_REQUIRE_EQUAL(65, APInt(UINT64_MAX).minBitwidth(true));
    BOOST_REQUIRE_EQUAL(512, ((APInt(1) << 512) - 1).minBitwidth(false));
 }
+
+BOOST_AUTO_TEST_CASE(apint_inline_boundary)
+{
+   const APInt max128 = (APInt(1) << 127) - 1;
+   const APInt min128 = -(APInt(1) << 127);
+   const APInt::number nmax128 = (APInt::number(1) << 127) - 1;
+
+   BOOST_REQUIRE_EQUAL(APInt(nmax128 + 1), max128 + 1);
+   BOOST_REQUIRE_EQUAL(APInt(-nmax128 - 2), min128 - 1);
+   BOOST_REQUIRE_EQUAL(APInt(nmax128 + 1), -min128);
+   BOOST_REQUIRE_EQUAL(APInt(nmax128 + 1), min128.abs());
+   BOOST_REQUIRE_EQUAL(APInt(nmax128 + 1), min128 / -1);
+   BOOST_REQUIRE_EQUAL(0, min128 % -1);
+   BOOST_REQUIRE_EQUAL(APInt(nmax128 * nmax128), max128 * max128);
+   BOOST_REQUIRE_EQUAL(max128, (max128 + 1) - 1);
+   BOOST_REQUIRE_EQUAL(max128, ((max128 << 70) >> 70));
+   BOOST_REQUIRE_EQUAL(-1, min128 >> 200);
+   BOOST_REQUIRE_EQUAL(0, max128 >> 200);
+   BOOST_REQUIRE_LT(max128, max128 + 1);
+   BOOST_REQUIRE_LT(min128 - 1, min128);
+   BOOST_REQUIRE_LT(min128 - 1, max128 + 1);
+   BOOST_REQUIRE_NE(APInt(0), max128 + 1);
+
+   APInt a = 0;
+   a.bit_set(127);
+   BOOST_REQUIRE_EQUAL(max128 + 1, a);
+   BOOST_REQUIRE(a.bit_tst(127));
+   BOOST_REQUIRE(!a.bit_tst(128));
+   a.bit_clr(127);
+   BOOST_REQUIRE_EQUAL(0, a);
+   BOOST_REQUIRE_EQUAL(0, (max128 + 1).extOrTrunc(127, true));
+   BOOST_REQUIRE_EQUAL(-1, max128.extOrTrunc(127, true));
+   BOOST_REQUIRE_EQUAL(min128, (max128 + 1).extOrTrunc(128, true));
+   BOOST_REQUIRE_EQUAL(max128 + 1, min128.extOrTrunc(128, false));
+   BOOST_REQUIRE_EQUAL(128, (max128 + 1).minBitwidth(false));
+   BOOST_REQUIRE_EQUAL(128, min128.minBitwidth(true));
+}
+
+BOOST_AUTO_TEST_CASE(apint_inline_benchmark)
+{
+   constexpr auto iterations = 200000;
+   std::vector<long long> operands;
+   operands.reserve(256);
+   for(auto i = 0LL; i < 256; ++i)
+   {
+      operands.push_back((i * 2654435761LL) % 100003 - 50000);
+   }
+
+   const auto start_number = std::chrono::steady_clock::now();
+   APInt::number acc_number = 0;
+   for(auto i = 0; i < iterations; ++i)
+   {
+      const APInt::number lhs = operands[static_cast<size_t>(i) % operands.size()];
+      const APInt::number rhs = operands[static_cast<size_t>(i + 1) % operands.size()];
+      acc_number += (lhs * rhs + (lhs >> 3)) & 0xFFFFF;
+      acc_number -= lhs < rhs ? rhs - lhs : lhs - rhs;
+   }
+   const auto end_number = std::chrono::steady_clock::now();
+
+   const auto start_apint = std::chrono::steady_clock::now();
+   APInt acc_apint = 0;
+   for(auto i = 0; i < iterations; ++i)
+   {
+      const APInt lhs = operands[static_cast<size_t>(i) % operands.size()];
+      const APInt rhs = operands[static_cast<size_t>(i + 1) % operands.size()];
+      acc_apint += (lhs * rhs + (lhs >> 3)) & 0xFFFFF;
+      acc_apint -= lhs < rhs ? rhs - lhs : lhs - rhs;
+   }
+   const auto end_apint = std::chrono::steady_clock::now();
+
+   BOOST_REQUIRE_EQUAL(APInt(acc_number), acc_apint);
+   BOOST_TEST_MESSAGE(
+       "APInt::number: "
+       << std::chrono::duration_cast<std::chrono::microseconds>(end_number - start_number).count() << "us, APInt: "
+       << std::chrono::duration_cast<std::chrono::microseconds>(end_apint - start_apint).count() << "us, sizeof "
+       << sizeof(APInt::number) << " vs " << sizeof(APInt) << " bytes");
+}
@@ -0,0 +1,107 @@
+#include "bit_lattice.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+BOOST_AUTO_TEST_CASE(bitstring_container)
+{
+   bitstring bs;
+   BOOST_REQUIRE(bs.empty());
+   bs.push_front(bit_lattice::ONE);
+   bs.push_back(bit_lattice::ZERO);
+   bs.push_front(bit_lattice::X);
+   bs.push_back(bit_lattice::U);
+   BOOST_REQUIRE_EQUAL("X10U", bitstring_to_string(bs));
+   BOOST_REQUIRE(bit_lattice::X == bs.front());
+   BOOST_REQUIRE(bit_lattice::U == bs.back());
+   BOOST_REQUIRE(bit_lattice::ZERO == bs.at(2));
+   BOOST_REQUIRE_THROW(bs.at(4), std::out_of_range);
+   bs.set(3, bit_lattice::ONE);
+   BOOST_REQUIRE_EQUAL("X101", bitstring_to_string(bs));
+   bs.insert(bs.begin() + 1, 2, bit_lattice::U);
+   BOOST_REQUIRE_EQUAL("XUU101", bitstring_to_string(bs));
+   bs.erase(bs.begin(), bs.begin() + 3);
+   BOOST_REQUIRE_EQUAL("101", bitstring_to_string(bs));
+   bs.pop_front();
+   bs.pop_back();
+   BOOST_REQUIRE_EQUAL("0", bitstring_to_string(bs));
+
+   std::string reversed;
+   const auto word = string_to_bitstring("1X0U");
+   for(auto it = word.crbegin(); it != word.crend(); ++it)
+   {
+      reversed += bitstring_to_string(bitstring(1, *it));
+   }
+   BOOST_REQUIRE_EQUAL("U0X1", reversed);
+}
+
+BOOST_AUTO_TEST_CASE(bitstring_wide)
+{
+   /// grow past several storage words from both ends
+   std::string expected;
+   bitstring bs;
+   for(auto i = 0U; i < 300; ++i)
+   {
+      const auto v = static_cast<bit_lattice>(i % 4);
+      if(i % 3)
+      {
+         bs.push_front(v);
+         expected.insert(expected.begin(), bitstring_to_string(bitstring(1, v)).front());
+      }
+      else
+      {
+         bs.push_back(v);
+         expected.push_back(bitstring_to_string(bitstring(1, v)).front());
+      }
+   }
+   BOOST_REQUIRE_EQUAL(expected, bitstring_to_string(bs));
+   BOOST_REQUIRE(string_to_bitstring(expected) == bs);
+   for(auto i = 0U; i < 70; ++i)
+   {
+      bs.pop_back();
+   }
+   BOOST_REQUIRE_EQUAL(expected.substr(0, 230), bitstring_to_string(bs));
+   /// the released free space is reused by push_back
+   for(auto i = 0U; i < 500; ++i)
+   {
+      bs.push_back(bit_lattice::ONE);
+   }
+   BOOST_REQUIRE_EQUAL(expected.substr(0, 230) + std::string(500, '1'), bitstring_to_string(bs));
+   BOOST_REQUIRE(bitstring(bs) == string_to_bitstring(bitstring_to_string(bs)));
+   BOOST_REQUIRE(bitstring(130, bit_lattice::ONE).is_constant());
+   auto almost = bitstring(130, bit_lattice::ZERO);
+   almost.set(1, bit_lattice::X);
+   BOOST_REQUIRE(!almost.is_constant());
+}
+
+BOOST_AUTO_TEST_CASE(bitstring_sup_inf)
+{
+   const bit_lattice values[] = {bit_lattice::U, bit_lattice::ZERO, bit_lattice::ONE, bit_lattice::X};
+   bitstring a, b;
+   for(const auto va : values)
+   {
+      for(const auto vb : values)
+      {
+         a.push_front(va);
+         b.push_front(vb);
+      }
+   }
+   auto s = a;
+   s |= b;
+   auto i = a;
+   i &= b;
+   for(auto k = 0U; k < a.size(); ++k)
+   {
+      BOOST_REQUIRE(bit_sup(a.at(k), b.at(k)) == s.at(k));
+      BOOST_REQUIRE(bit_inf(a.at(k), b.at(k)) == i.at(k));
+   }
+
+   BOOST_REQUIRE_EQUAL("X",
+                       bitstring_to_string(sup(string_to_bitstring("0"), string_to_bitstring("1"), 1, false, true)));
+   BOOST_REQUIRE_EQUAL("0X",
+                       bitstring_to_string(sup(string_to_bitstring("01"), string_to_bitstring("0U0"), 3, true, false)));
+   BOOST_REQUIRE_EQUAL("1",
+                       bitstring_to_string(inf(string_to_bitstring("0X1"), string_to_bitstring("001"), 3, false,
+                                               false)));
+}
@@ -0,0 +1,75 @@
+#include "fileIO.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace
+{
+   std::string read(const std::filesystem::path& filename)
+   {
+      std::ifstream file(filename);
+      return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+   }
+
+   size_t count_entries(const std::filesystem::path& directory)
+   {
+      return static_cast<size_t>(std::distance(std::filesystem::directory_iterator(directory),
+                                               std::filesystem::directory_iterator()));
+   }
+} // namespace
+
+BOOST_AUTO_TEST_CASE(content_digest)
+{
+   /// reference values of the 128-bit FNV-1a hash
+   BOOST_REQUIRE_EQUAL("6c62272e07bb014262b821756295c58d", ContentDigest(""));
+   BOOST_REQUIRE_EQUAL("d228cb696f1a8caf78912b704e4a8964", ContentDigest("a"));
+   BOOST_REQUIRE_NE(ContentDigest("key\n1"), ContentDigest("key\n2"));
+}
+
+BOOST_AUTO_TEST_CASE(store_cache_entry)
+{
+   const auto cache = unique_path(std::filesystem::temp_directory_path() / "cache.%%%%%%");
+   const auto write_directory = [](const std::string& content) {
+      return [content](const std::filesystem::path& staging) {
+         std::filesystem::create_directories(staging);
+         std::ofstream(staging / "key.txt") << content;
+      };
+   };
+
+   /// the parent directory is created and only the entry is left in it
+   const auto entry = cache / ContentDigest("first");
+   BOOST_REQUIRE(StoreCacheEntry(entry, write_directory("first")));
+   BOOST_REQUIRE_EQUAL("first", read(entry / "key.txt"));
+   BOOST_REQUIRE_EQUAL(1, count_entries(cache));
+
+   /// the first writer wins: an existing directory entry is kept, since another run may be reading it
+   BOOST_REQUIRE(StoreCacheEntry(entry, write_directory("second")));
+   BOOST_REQUIRE_EQUAL("first", read(entry / "key.txt"));
+   BOOST_REQUIRE_EQUAL(1, count_entries(cache));
+
+   /// file entries are kept as well
+   const auto file_entry = cache / "snapshot.bin";
+   for(const auto& content : {"old", "new"})
+   {
+      BOOST_REQUIRE(StoreCacheEntry(file_entry,
+                                    [&](const std::filesystem::path& staging) { std::ofstream(staging) << content; }));
+   }
+   BOOST_REQUIRE_EQUAL("old", read(file_entry));
+   BOOST_REQUIRE_EQUAL(2, count_entries(cache));
+
+   /// a failure while writing removes the partial entry and is propagated
+   const auto failed = cache / ContentDigest("failed");
+   BOOST_CHECK_THROW(StoreCacheEntry(failed,
+                                     [](const std::filesystem::path& staging) {
+                                        std::filesystem::create_directories(staging);
+                                        throw std::string("write error");
+                                     }),
+                     std::string);
+   BOOST_REQUIRE(!std::filesystem::exists(failed));
+   BOOST_REQUIRE_EQUAL(2, count_entries(cache));
+   std::filesystem::remove_all(cache);
+}
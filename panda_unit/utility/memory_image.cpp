@@ -0,0 +1,81 @@
+#include "memory_image.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+
+BOOST_AUTO_TEST_CASE(memory_image_packing)
+{
+   memory_image image;
+   image.append(0x5ULL, 3);
+   image.append_binary("11111");
+   image.append(integer_cst_t(-2), 12);
+   image.append_zeros(4);
+   image.append(0x1ULL, 1);
+   BOOST_REQUIRE_EQUAL(4, image.size());
+   BOOST_REQUIRE_EQUAL(0xFD, image.data()[0]);
+   BOOST_REQUIRE_EQUAL(0xFE, image.data()[1]);
+   BOOST_REQUIRE_EQUAL(0x0F, image.data()[2]);
+   BOOST_REQUIRE_EQUAL(0x01, image.data()[3]);
+
+   image.align(4);
+   BOOST_REQUIRE_EQUAL(4, image.size());
+   image.append(0xABULL, 8);
+   image.extend(6);
+   BOOST_REQUIRE_EQUAL(6, image.size());
+
+   std::stringstream hex;
+   image.write_hex(hex, 4);
+   BOOST_REQUIRE_EQUAL("010ffefd\n00ab\n", hex.str());
+
+   std::stringstream bin_a, bin_b;
+   image.write_binary(bin_a, &bin_b, 2);
+   BOOST_REQUIRE_EQUAL("1111111011111101\n0000000010101011\n", bin_a.str());
+   BOOST_REQUIRE_EQUAL("0000000100001111\n0000000000000000\n", bin_b.str());
+}
+
+BOOST_AUTO_TEST_CASE(memory_image_wide_values)
+{
+   memory_image image;
+   image.append(integer_cst_t(1) << 100, 104);
+   image.append(integer_cst_t(-1), 70);
+   BOOST_REQUIRE_EQUAL(22, image.size());
+   BOOST_REQUIRE_EQUAL(0x10, image.data()[12]);
+   BOOST_REQUIRE_EQUAL(0xFF, image.data()[13]);
+   BOOST_REQUIRE_EQUAL(0x3F, image.data()[21]);
+}
+
+BOOST_AUTO_TEST_CASE(memory_image_rom_4MB)
+{
+   constexpr auto n_words = (4ULL << 20) / 4;
+   const auto start = std::chrono::steady_clock::now();
+   memory_image image;
+   for(unsigned long long i = 0; i < n_words; ++i)
+   {
+      image.append(integer_cst_t(i * 2654435761ULL), 32);
+   }
+   std::stringstream raw;
+   image.write_raw(raw);
+   std::stringstream mem;
+   image.write_binary(mem, nullptr, 4);
+   const auto elapsed =
+       std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+   BOOST_TEST_MESSAGE("4 MB memory image built and written in " << elapsed << " ms");
+
+   BOOST_REQUIRE_EQUAL(4ULL << 20, image.size());
+   const auto raw_bytes = raw.str();
+   BOOST_REQUIRE_EQUAL(4ULL << 20, raw_bytes.size());
+   for(unsigned long long i = 0; i < n_words; i += 4099)
+   {
+      const auto expected = static_cast<unsigned int>(i * 2654435761ULL);
+      unsigned int value = 0;
+      for(auto b = 0U; b < 4; ++b)
+      {
+         value |= static_cast<unsigned int>(static_cast<unsigned char>(raw_bytes[i * 4 + b])) << (8 * b);
+      }
+      BOOST_REQUIRE_EQUAL(expected, value);
+   }
+   BOOST_REQUIRE_EQUAL(n_words * 33, mem.str().size());
+}
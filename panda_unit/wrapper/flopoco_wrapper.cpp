@@ -0,0 +1,91 @@
+#include "flopoco_wrapper.hpp"
+
+#include "fileIO.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace
+{
+   std::string read(const std::filesystem::path& filename)
+   {
+      std::ifstream file(filename);
+      return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+   }
+
+   void write(const std::filesystem::path& filename, const std::string& content)
+   {
+      std::ofstream file(filename);
+      file << content;
+   }
+
+   size_t count_entries(const std::filesystem::path& directory)
+   {
+      return static_cast<size_t>(std::distance(std::filesystem::directory_iterator(directory),
+                                               std::filesystem::directory_iterator()));
+   }
+
+   /// generates a 32-bit adder as HDL_manager does and returns the code of the unit followed by the common components
+   std::string generate_adder(const std::filesystem::path& cache, const std::string& frequency,
+                              unsigned int& pipeline_depth)
+   {
+      flopoco_wrapper wrapper(0, "Virtex-7", cache.string());
+      wrapper.add_FU("FPAdder", 32, 32, "fp_add", frequency);
+      std::string unit_file;
+      BOOST_REQUIRE_EQUAL(0, wrapper.writeVHDL("fp_add", 32, 32, frequency, unit_file));
+      pipeline_depth = wrapper.get_FUPipelineDepth("fp_add", 32, 32, frequency);
+      const auto common_file = wrapper.writeVHDLcommon();
+      return read(unit_file) + (common_file.empty() ? std::string() : read(common_file));
+   }
+
+   std::filesystem::path single_entry(const std::filesystem::path& cache)
+   {
+      BOOST_REQUIRE_EQUAL(1, count_entries(cache));
+      return std::filesystem::directory_iterator(cache)->path();
+   }
+} // namespace
+
+BOOST_AUTO_TEST_CASE(flopoco_cache_round_trip)
+{
+   const auto directory = unique_path(std::filesystem::temp_directory_path() / "flopoco_cache.%%%%%%");
+   std::filesystem::create_directories(directory);
+   const auto cwd = std::filesystem::current_path();
+   std::filesystem::current_path(directory);
+   const auto cache = directory / "cache";
+
+   /// the generated unit is stored together with its common components
+   unsigned int generated_depth = 0;
+   const auto generated = generate_adder(cache, "100", generated_depth);
+   BOOST_REQUIRE_GT(generated_depth, 0U);
+   const auto entry = single_entry(cache);
+   BOOST_REQUIRE(std::filesystem::exists(entry / "unit.vhdl"));
+
+   /// the second run is served by the cache: the marker added to the stored code shows up in the output
+   const std::string marker = "-- loaded from the FloPoCo cache\n";
+   write(entry / "unit.vhdl", marker + read(entry / "unit.vhdl"));
+   unsigned int cached_depth = 0;
+   const auto cached = generate_adder(cache, "100", cached_depth);
+   BOOST_REQUIRE_EQUAL(marker + generated, cached);
+   BOOST_REQUIRE_EQUAL(generated_depth, cached_depth);
+   BOOST_REQUIRE_EQUAL(1, count_entries(cache));
+
+   /// a different frequency selects a different pipeline, so it misses and stores a new entry
+   unsigned int other_depth = 0;
+   BOOST_REQUIRE(generate_adder(cache, "400", other_depth).find(marker) == std::string::npos);
+   BOOST_REQUIRE_EQUAL(2, count_entries(cache));
+
+   /// an entry stored by another version of the framework misses
+   const auto key = read(entry / "key.txt");
+   const auto version_begin = key.find(' ') + 1;
+   write(entry / "key.txt", key.substr(0, version_begin) + "0.0.0" + key.substr(key.find(' ', version_begin)));
+   unsigned int regenerated_depth = 0;
+   BOOST_REQUIRE(generate_adder(cache, "100", regenerated_depth).find(marker) == std::string::npos);
+   BOOST_REQUIRE_EQUAL(generated_depth, regenerated_depth);
+
+   std::filesystem::current_path(cwd);
+   std::filesystem::remove_all(directory);
+}
@@ -227,6 +227,14 @@
 #define OPT_INLINE_FUNCTIONS (1 + OPT_SHARED_INPUT_REGISTERS)
 #define OPT_AXI_BURST_TYPE (1 + OPT_INLINE_FUNCTIONS)
 #define OPT_GENERATE_COMPONENTS_LIBRARY (1 + OPT_AXI_BURST_TYPE)
+#define OPT_FLOW_JOBS (1 + OPT_GENERATE_COMPONENTS_LIBRARY)
+#define OPT_FRONTEND_CACHE (1 + OPT_FLOW_JOBS)
+#define OPT_TECHNOLOGY_CACHE (1 + OPT_FRONTEND_CACHE)
+#define OPT_FRONTEND_JOBS (1 + OPT_TECHNOLOGY_CACHE)
+#define OPT_FLOW_TRACE (1 + OPT_FRONTEND_JOBS)
+#define OPT_HOST_PROFILING_CACHE (1 + OPT_FLOW_TRACE)
+#define OPT_LOOP_II_ANALYSIS (1 + OPT_HOST_PROFILING_CACHE)
+#define OPT_M_AXI_BURST_LENGTH (1 + OPT_LOOP_II_ANALYSIS)
 
 /// constant correspond to the "parametric list based option"
 #define PAR_LIST_BASED_OPT "parametric-list-based"
@@ -299,6 +307,16 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "    --C-no-parse=<file>\n"
       << "        Specify a comma-separated list of C files used only during the\n"
       << "        co-simulation phase.\n\n"
+      << "    --frontend-cache=<dir>\n"
+      << "        Store the IR produced by the front-end compiler in <dir> and reuse it\n"
+      << "        in later runs on the same sources with the same compiler options,\n"
+      << "        skipping front-end compilation and IR parsing of the single files.\n\n"
+      << "    --frontend-jobs[=num_jobs]\n"
+      << "        Compile and parse multiple source files concurrently using up to\n"
+      << "        num_jobs front-end invocations (default=1, i.e., serial execution;\n"
+      << "        without argument the number of available cores is used).\n"
+      << "        With clang and multiple sources, the files are compiled concurrently\n"
+      << "        and then linked serially.\n\n"
       << std::endl;
 
    PrintGccOptionsUsage(os);
@@ -307,6 +325,13 @@ void BambuParameter::PrintHelp(std::ostream& os) const
    os << "  Target:\n\n"
       << "    --target-file=file, -b<file>\n"
       << "        Specify an XML description of the target device.\n\n"
+      << "    --technology-cache=<dir>\n"
+      << "        Store in <dir> a binary snapshot of the parsed technology and device\n"
+      << "        libraries and load it in later runs instead of parsing the XML files.\n"
+      << "        A snapshot is discarded when the checksum of its source file changes.\n"
+      << "        The floating-point operators generated by FloPoCo are stored in the\n"
+      << "        flopoco subdirectory and reused when the same operator is requested\n"
+      << "        for the same device family and target frequency.\n\n"
       << "    --generate-interface=<type>\n"
       << "        Wrap the top level module with an external interface.\n"
       << "        Possible values for <type> and related interfaces:\n"
@@ -335,12 +360,30 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "        Perform scheduling by using speculative SDC.\n"
       << "        The speculative SDC is more conservative, in case \n"
       << "        --panda-parameter=enable-conservative-sdc=1 is passed.\n\n"
+      << "    --ilp-solver=<solver>\n"
+      << "        Set the solver used by SDC scheduling. Possible values for <solver> are:\n"
+#if HAVE_GLPK
+      << "            GLPK     - GNU Linear Programming Kit\n"
+#endif
+#if HAVE_COIN_OR
+      << "            COIN_OR  - COIN-OR Branch and Cut solver\n"
+#endif
+#if HAVE_LP_SOLVE
+      << "            LP_SOLVE - lp_solve solver\n"
+#endif
+      << "            SDC      - native difference constraints solver\n\n"
 #endif
       << "    --pipelining,-p=<func_name>[=<init_interval>][,<func_name>[=<init_interval>]]*\n"
       << "        Perform pipelining of comma separated list of specified functions with optional \n"
       << "        initiation interval (default II=1).\n"
       << "        To pipeline softfloat operators it is possible to specify the __float_<op_name> prefix \n"
       << "        or simply __float to pipeline all softfloat library.\n\n"
+      << "    --loop-ii-analysis=<func_name>[:<loop_id>]=<init_interval>\n"
+      << "                       [,<func_name>[:<loop_id>]=<init_interval>]*\n"
+      << "        Report the minimum initiation interval allowed by the allocated resources (ResMII) and by\n"
+      << "        the loop-carried dependences (RecMII) of the innermost loops of the specified functions (of\n"
+      << "        the single loop whose header is basic block <loop_id> when given), and warn when it is larger\n"
+      << "        than the given initiation interval. This is an analysis only: loops are not pipelined.\n\n"
       << "    --fixed-scheduling=<file>\n"
       << "        Provide scheduling as an XML file.\n\n"
       << "    --no-chaining\n"
@@ -358,6 +401,8 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "            COLORING            - use simple coloring algorithm\n"
       << "            WEIGHTED_COLORING   - use weighted coloring algorithm\n"
       << "            CHORDAL_COLORING    - use chordal coloring algorithm\n"
+      << "            LINEAR_SCAN         - use linear scan of the live ranges (optimal\n"
+      << "                                  for interval conflict graphs, no graph built)\n"
       << "            BIPARTITE_MATCHING  - use bipartite matching algorithm\n"
       << "            TTT_CLIQUE_COVERING - use a weighted clique covering algorithm\n"
       << "            UNIQUE_BINDING      - unique binding algorithm\n"
@@ -518,7 +563,18 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "            DSPS            - number of DSPs\n"
       << "            FREQUENCY       - Maximum target frequency\n"
       << "            PERIOD          - Actual clock period\n"
-      << "            REGISTERS       - number of registers\n"
+      << "            REGISTERS       - number of registers\n\n"
+      << "    --evaluation-mode=<mode>\n"
+      << "        Select how the evaluation objectives are computed. It requires\n"
+      << "        --evaluation. Supported modes are:\n"
+      << "            EXACT           - RTL synthesis and simulation (default)\n"
+      << "            ESTIMATE        - Fast estimation from the HLS results: area from the\n"
+      << "                              bound units, registers and multiplexers, period\n"
+      << "                              from the chained operations, cycles from the state\n"
+      << "                              transition graph and --host-profiling data.\n"
+      << "                              Supports AREA, AREAxTIME, TIME, TOTAL_TIME, CYCLES,\n"
+      << "                              TOTAL_CYCLES, CLOCK_SLACK, FREQUENCY, PERIOD and\n"
+      << "                              REGISTERS.\n"
       << "\n"
       << std::endl;
 
@@ -791,9 +847,28 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "        Set maximum execution time (in seconds) for ILP solvers. (infinite).\n\n";
 #endif
 #if HAVE_HOST_PROFILING_BUILT
-   os << "    --host-profiling\n"
-      << "        Perform host-profiling.\n\n";
+   os << "    --host-profiling[=extended]\n"
+      << "        Perform host-profiling. The extended mode also collects the number of\n"
+      << "        executions of each control flow edge and the histogram of the trip\n"
+      << "        counts of each loop.\n\n"
+      << "    --host-profiling-cache=<dir>\n"
+      << "        Store the host profiling results in <dir> and reuse them in later runs\n"
+      << "        with the same instrumented program and the same execution arguments.\n"
+      << "        Changes to input files read by the program are not detected.\n\n";
 #endif
+   os << "    --flow-jobs[=num_threads]\n"
+      << "        Execute independent function-level analysis steps of the design flow\n"
+      << "        concurrently on num_threads worker threads (default=1, i.e., serial\n"
+      << "        execution; without argument the number of available cores is used).\n"
+      << "        The same workers solve the clique covering problems of the different\n"
+      << "        resource types during module binding; a covering whose inputs are\n"
+      << "        changed by the ones applied before it is solved again, so the binding\n"
+      << "        is the same as in the serial execution.\n\n";
+   os << "    --flow-trace=<file>\n"
+      << "        Record the timeline of the design flow (step executions, dependence\n"
+      << "        recomputations and invalidations) in <file> using the Chrome Trace\n"
+      << "        Event format, which can be inspected with chrome://tracing or Perfetto.\n"
+      << "        The trace is written also when the flow fails, marking the failed step.\n\n";
    os << "    --disable-bitvalue-ipa\n"
       << "        Disable inter-procedural bitvalue analysis.\n\n";
    os << "    --enable-function-proxy\n"
@@ -822,6 +897,14 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "        Specify the type of AXI burst when performing single beat operations:\n"
       << "              FIXED        - fixed type burst (default)\n"
       << "              INCREMENTAL  - incremental type burst\n\n";
+   os << "    --m-axi-burst-length=<beats>\n"
+      << "        Enable the inference of multi-beat AXI bursts on m_axi interfaces without a cache: when\n"
+      << "        consecutive or small-strided accesses are detected in loops, the interface is implemented by an\n"
+      << "        adapter with a read prefetch buffer and a write-combining buffer of <beats> bus words\n"
+      << "        (power of two between 2 and 256).\n"
+      << "        The read buffer is not updated by the writes done through other m_axi bundles, so when a\n"
+      << "        function has more than one m_axi bundle the adapter is used only for the bundles whose\n"
+      << "        pointer parameters are all restrict qualified.\n\n";
    os << std::endl;
 
    // Checks and debugging options
@@ -984,6 +1067,7 @@ int BambuParameter::Exec()
       {"resource-constraints", required_argument, nullptr, 'c'},
       /// evaluation options
       {"evaluation", optional_argument, nullptr, OPT_EVALUATION},
+      {"evaluation-mode", required_argument, nullptr, OPT_EVALUATION_MODE},
       {"timing-violation", no_argument, nullptr, OPT_TIMING_VIOLATION},
       {"assert-debug", no_argument, nullptr, 0},
       {"device-name", required_argument, nullptr, OPT_DEVICE_NAME},
@@ -1060,7 +1144,7 @@ int BambuParameter::Exec()
       {"mem-delay-read", required_argument, nullptr, OPT_MEM_DELAY_READ},
       {"mem-delay-write", required_argument, nullptr, OPT_MEM_DELAY_WRITE},
       {"tb-queue-size", required_argument, nullptr, OPT_TB_QUEUE_SIZE},
-      {"host-profiling", no_argument, nullptr, OPT_HOST_PROFILING},
+      {"host-profiling", optional_argument, nullptr, OPT_HOST_PROFILING},
       {"disable-bitvalue-ipa", no_argument, nullptr, OPT_DISABLE_BITVALUE_IPA},
       {"discrepancy", no_argument, nullptr, OPT_DISCREPANCY},
       {"discrepancy-force-uninitialized", no_argument, nullptr, OPT_DISCREPANCY_FORCE},
@@ -1099,6 +1183,14 @@ int BambuParameter::Exec()
       {"shared-input-registers", no_argument, nullptr, OPT_SHARED_INPUT_REGISTERS},
       {"inline-fname", required_argument, nullptr, OPT_INLINE_FUNCTIONS},
       {"generate-components-library", no_argument, nullptr, OPT_GENERATE_COMPONENTS_LIBRARY},
+      {"flow-jobs", optional_argument, nullptr, OPT_FLOW_JOBS},
+      {"frontend-cache", required_argument, nullptr, OPT_FRONTEND_CACHE},
+      {"technology-cache", required_argument, nullptr, OPT_TECHNOLOGY_CACHE},
+      {"frontend-jobs", optional_argument, nullptr, OPT_FRONTEND_JOBS},
+      {"flow-trace", required_argument, nullptr, OPT_FLOW_TRACE},
+      {"host-profiling-cache", required_argument, nullptr, OPT_HOST_PROFILING_CACHE},
+      {"loop-ii-analysis", required_argument, nullptr, OPT_LOOP_II_ANALYSIS},
+      {"m-axi-burst-length", required_argument, nullptr, OPT_M_AXI_BURST_LENGTH},
       GCC_LONG_OPTIONS,
       {nullptr, 0, nullptr, 0}
    };
@@ -1169,6 +1261,40 @@ int BambuParameter::Exec()
             }
             break;
          }
+#if HAVE_ILP_BUILT
+         case OPT_ILP_SOLVER:
+         {
+            const std::string solver(optarg);
+#if HAVE_GLPK
+            if(solver == "GLPK")
+            {
+               setOption(OPT_ilp_solver, meilp_solver::GLPK);
+               break;
+            }
+#endif
+#if HAVE_COIN_OR
+            if(solver == "COIN_OR")
+            {
+               setOption(OPT_ilp_solver, meilp_solver::COIN_OR);
+               break;
+            }
+#endif
+#if HAVE_LP_SOLVE
+            if(solver == "LP_SOLVE")
+            {
+               setOption(OPT_ilp_solver, meilp_solver::LP_SOLVE);
+               break;
+            }
+#endif
+            if(solver == "SDC")
+            {
+               setOption(OPT_ilp_solver, meilp_solver::SDC);
+               break;
+            }
+            THROW_ERROR("BadParameters: unknown ilp solver " + solver);
+            break;
+         }
+#endif
          case OPT_STG:
          {
             setOption(OPT_stg, true);
@@ -1190,6 +1316,10 @@ int BambuParameter::Exec()
             {
                setOption(OPT_register_allocation_algorithm, HLSFlowStep_Type::CHORDAL_COLORING_REGISTER_BINDING);
             }
+            else if(std::string(optarg) == "LINEAR_SCAN")
+            {
+               setOption(OPT_register_allocation_algorithm, HLSFlowStep_Type::LINEAR_SCAN_REGISTER_BINDING);
+            }
             else if(std::string(optarg) == "WEIGHTED_COLORING")
             {
                setOption(OPT_register_allocation_algorithm, HLSFlowStep_Type::WEIGHTED_CLIQUE_REGISTER_BINDING);
@@ -1286,41 +1416,31 @@ int BambuParameter::Exec()
                   objective_string += ",TOTAL_CYCLES";
                }
             }
-            if(optarg == nullptr)
+            /// the default objectives depend on the evaluation mode, which may be given later: they are added by
+            /// CheckParameters
+            setOption("evaluation_default_objectives", optarg == nullptr);
+            if(optarg != nullptr)
             {
-               if(getOption<Evaluation_Mode>(OPT_evaluation_mode) == Evaluation_Mode::EXACT)
-               {
-                  std::string to_add =
-#if HAVE_LIBRARY_CHARACTERIZATION_BUILT
-                      "AREAxTIME,"
-                      "AREA,"
-                      "REGISTERS,"
-                      "DSPS,"
-                      "BRAMS,"
-                      "DRAMS,"
-                      "PERIOD,"
-                      "CLOCK_SLACK,"
-                      "FREQUENCY,"
-                      "TIME,"
-                      "TOTAL_TIME,"
-                      "CYCLES,"
-                      "TOTAL_CYCLES"
-#else
-                      "CYCLES"
-#endif
-                      ;
-                  add_evaluation_objective_string(objective_string, to_add);
-               }
-               else
-               {
-                  THROW_ERROR("BadParameters: invalid evaluation mode");
-               }
+               add_evaluation_objective_string(objective_string, std::string(optarg));
+            }
+            setOption(OPT_evaluation_objectives, objective_string);
+            break;
+         }
+         case OPT_EVALUATION_MODE:
+         {
+            const std::string evaluation_mode(optarg);
+            if(evaluation_mode == "EXACT")
+            {
+               setOption(OPT_evaluation_mode, Evaluation_Mode::EXACT);
+            }
+            else if(evaluation_mode == "ESTIMATE")
+            {
+               setOption(OPT_evaluation_mode, Evaluation_Mode::ESTIMATE);
             }
             else
             {
-               add_evaluation_objective_string(objective_string, std::string(optarg));
+               THROW_ERROR("BadParameters: invalid evaluation mode " + evaluation_mode);
             }
-            setOption(OPT_evaluation_objectives, objective_string);
             break;
          }
          case OPT_SIMULATE:
@@ -1500,6 +1620,16 @@ int BambuParameter::Exec()
             }
             break;
          }
+         case OPT_LOOP_II_ANALYSIS:
+         {
+            if(!std::regex_match(std::string(optarg),
+                                 std::regex("^([^,:=]+(:\\d+)?=[1-9]\\d*)(,[^,:=]+(:\\d+)?=[1-9]\\d*)*$")))
+            {
+               THROW_ERROR("BadParameters: loop initiation interval analysis format not valid: " + std::string(optarg));
+            }
+            setOption(OPT_loop_ii_analysis, optarg);
+            break;
+         }
          case OPT_SERIALIZE_MEMORY_ACCESSES:
          {
             setOption(OPT_gcc_serialize_memory_accesses, true);
@@ -1897,6 +2027,19 @@ int BambuParameter::Exec()
          case OPT_HOST_PROFILING:
          {
             setOption(OPT_profiling_method, HostProfiling_Method::PM_BBP);
+            if(optarg)
+            {
+               if(std::string(optarg) != "extended")
+               {
+                  THROW_ERROR("BadParameters: unknown host profiling mode " + std::string(optarg));
+               }
+               setOption(OPT_host_profiling_extended, true);
+            }
+            break;
+         }
+         case OPT_HOST_PROFILING_CACHE:
+         {
+            setOption(OPT_host_profiling_cache, std::filesystem::absolute(optarg).string());
             break;
          }
 #endif
@@ -2026,6 +2169,17 @@ int BambuParameter::Exec()
             };
             break;
          }
+         case OPT_M_AXI_BURST_LENGTH:
+         {
+            const auto burst_length = std::stoul(optarg);
+            if(burst_length < 2 || burst_length > 256 || (burst_length & (burst_length - 1)))
+            {
+               THROW_ERROR("BadParameters: m_axi burst length must be a power of two between 2 and 256: " +
+                           std::string(optarg));
+            }
+            setOption(OPT_m_axi_burst_length, burst_length);
+            break;
+         }
          case OPT_ACCEPT_NONZERO_RETURN:
          {
             setOption(OPT_no_return_zero, true);
@@ -2113,6 +2267,45 @@ int BambuParameter::Exec()
             }
             break;
          }
+         case OPT_FLOW_JOBS:
+         {
+            if(optarg)
+            {
+               setOption(OPT_flow_jobs, std::string(optarg));
+            }
+            else
+            {
+               setOption(OPT_flow_jobs, std::to_string(std::thread::hardware_concurrency()));
+            }
+            break;
+         }
+         case OPT_FRONTEND_CACHE:
+         {
+            setOption(OPT_frontend_cache, std::filesystem::absolute(optarg).string());
+            break;
+         }
+         case OPT_TECHNOLOGY_CACHE:
+         {
+            setOption(OPT_technology_cache, std::filesystem::absolute(optarg).string());
+            break;
+         }
+         case OPT_FRONTEND_JOBS:
+         {
+            if(optarg)
+            {
+               setOption(OPT_frontend_jobs, std::string(optarg));
+            }
+            else
+            {
+               setOption(OPT_frontend_jobs, std::to_string(std::thread::hardware_concurrency()));
+            }
+            break;
+         }
+         case OPT_FLOW_TRACE:
+         {
+            setOption(OPT_flow_trace, std::filesystem::absolute(optarg).string());
+            break;
+         }
          case OPT_XILINX_ROOT:
          {
             setOption(OPT_xilinx_root, std::string(optarg));
@@ -2881,10 +3074,61 @@ void BambuParameter::CheckParameters()
    setOption(OPT_chaining_algorithm, HLSFlowStep_Type::SCHED_CHAINING);
 
    /// evaluation options
+   /// --evaluation and --simulate are the only other options selecting EXACT or ESTIMATE mode
+   const auto evaluation_mode = getOption<Evaluation_Mode>(OPT_evaluation_mode);
+   if(!getOption<bool>(OPT_evaluation) &&
+      (evaluation_mode == Evaluation_Mode::EXACT || evaluation_mode == Evaluation_Mode::ESTIMATE))
+   {
+      THROW_ERROR("BadParameters: --evaluation-mode requires --evaluation");
+   }
    if(getOption<bool>(OPT_evaluation))
    {
       THROW_ASSERT(isOption(OPT_evaluation_objectives), "missing evaluation objectives");
       auto objective_string = getOption<std::string>(OPT_evaluation_objectives);
+      if(isOption("evaluation_default_objectives") && getOption<bool>("evaluation_default_objectives"))
+      {
+         if(getOption<Evaluation_Mode>(OPT_evaluation_mode) == Evaluation_Mode::EXACT)
+         {
+            std::string to_add =
+#if HAVE_LIBRARY_CHARACTERIZATION_BUILT
+                "AREAxTIME,"
+                "AREA,"
+                "REGISTERS,"
+                "DSPS,"
+                "BRAMS,"
+                "DRAMS,"
+                "PERIOD,"
+                "CLOCK_SLACK,"
+                "FREQUENCY,"
+                "TIME,"
+                "TOTAL_TIME,"
+                "CYCLES,"
+                "TOTAL_CYCLES"
+#else
+                "CYCLES"
+#endif
+                ;
+            add_evaluation_objective_string(objective_string, to_add);
+         }
+         else if(getOption<Evaluation_Mode>(OPT_evaluation_mode) == Evaluation_Mode::ESTIMATE)
+         {
+            add_evaluation_objective_string(objective_string, "AREAxTIME,"
+                                                              "AREA,"
+                                                              "REGISTERS,"
+                                                              "PERIOD,"
+                                                              "CLOCK_SLACK,"
+                                                              "FREQUENCY,"
+                                                              "TIME,"
+                                                              "TOTAL_TIME,"
+                                                              "CYCLES,"
+                                                              "TOTAL_CYCLES");
+         }
+         else
+         {
+            THROW_ERROR("BadParameters: invalid evaluation mode");
+         }
+         setOption(OPT_evaluation_objectives, objective_string);
+      }
       THROW_ASSERT(!objective_string.empty(), "");
       auto objective_vector = string_to_container<std::vector<std::string>>(objective_string, ",");
 
@@ -2947,6 +3191,19 @@ void BambuParameter::CheckParameters()
             THROW_ERROR("BadParameters: evaluation mode EXACT does not support the selected evaluation objectives.");
          }
       }
+      else if(getOption<Evaluation_Mode>(OPT_evaluation_mode) == Evaluation_Mode::ESTIMATE)
+      {
+         const auto is_valid_evaluation_mode = [](const std::string& s) -> bool {
+            return s == "AREA" || s == "AREAxTIME" || s == "TIME" || s == "TOTAL_TIME" || s == "CYCLES" ||
+                   s == "TOTAL_CYCLES" || s == "CLOCK_SLACK" || s == "FREQUENCY" || s == "PERIOD" ||
+                   s == "REGISTERS";
+         };
+         if(!all_of(objective_vector.begin(), objective_vector.end(), is_valid_evaluation_mode))
+         {
+            THROW_ERROR(
+                "BadParameters: evaluation mode ESTIMATE does not support the selected evaluation objectives.");
+         }
+      }
       else
       {
          THROW_ERROR("BadParameters: invalid evaluation mode");
@@ -3807,10 +4064,13 @@ void BambuParameter::SetDefaults()
    setOption(OPT_fp_format, "");
    setOption(OPT_fp_format_propagate, false);
    setOption(OPT_parallel_backend, false);
+   setOption(OPT_flow_jobs, 1);
+   setOption(OPT_frontend_jobs, 1);
 
 #if HAVE_HOST_PROFILING_BUILT
    setOption(OPT_exec_argv, STR_CST_string_separator);
    setOption(OPT_profiling_method, HostProfiling_Method::PM_NONE);
+   setOption(OPT_host_profiling_extended, false);
    setOption(OPT_host_compiler, CompilerWrapper::getDefaultCompiler());
 #endif
    setOption(OPT_clock_period, 10.0);
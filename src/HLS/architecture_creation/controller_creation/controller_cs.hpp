@@ -60,7 +60,7 @@ class controller_cs : public fsm_controller
 
    void add_selector_register_file_port(structural_objectRef circuit, structural_managerRef SM);
 
-   void add_correct_transition_memory(const std::string& state_representation, structural_managerRef SM) override;
+   void add_correct_transition_memory(const fsm_descriptionConstRef& fsm, structural_managerRef SM) override;
 };
 
 #endif // CONTROLLER_CS_H
@@ -51,6 +51,7 @@
 #include "custom_set.hpp"
 #include "dbgPrintHelper.hpp"
 #include "exceptions.hpp"
+#include "fsm_description.hpp"
 #include "fu_binding.hpp"
 #include "function_behavior.hpp"
 #include "funit_obj.hpp"
@@ -121,12 +122,12 @@ DesignFlowStep_Status fsm_controller::InternalExec()
    this->add_common_ports(circuit, SM);
 
    PRINT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "Creating state machine representations...");
-   std::string state_representation;
-   this->create_state_machine(state_representation);
-   add_correct_transition_memory(state_representation, SM); // if CS is activated some register are memory
+   const fsm_descriptionRef fsm(new fsm_description());
+   this->create_state_machine(*fsm);
+   add_correct_transition_memory(fsm, SM); // if CS is activated some register are memory
 
    PRINT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "Machine encoding");
-   PRINT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, state_representation);
+   PRINT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, fsm->to_string());
    PRINT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "****");
 
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Circuit created without errors!");
@@ -136,21 +137,22 @@ DesignFlowStep_Status fsm_controller::InternalExec()
    return DesignFlowStep_Status::SUCCESS;
 }
 
-static std::string input_vector_to_string(const std::vector<long long int>& to_be_printed, bool with_comma)
+static fsm_output_vector to_output_vector(fsm_output_vector::output_value done_value,
+                                           const std::vector<long long int>& values)
 {
-   std::string output;
-   for(unsigned int i = 0; i < to_be_printed.size(); i++)
+   fsm_output_vector output(values.size() + 1);
+   output.set(0, done_value);
+   for(unsigned int i = 0; i < values.size(); i++)
    {
-      output += (to_be_printed[i] == default_COND ? "-" : std::to_string(to_be_printed[i]));
-      if(i != (to_be_printed.size() - 1) && with_comma)
-      {
-         output += ",";
-      }
+      THROW_ASSERT(values[i] == default_COND || (values[i] >= 0 && values[i] <= 2),
+                   "unexpected output value " + STR(values[i]));
+      output.set(i + 1, values[i] == default_COND ? fsm_output_vector::DONT_CARE :
+                                                    static_cast<fsm_output_vector::output_value>(values[i]));
    }
    return output;
 }
 
-void fsm_controller::create_state_machine(std::string& parse)
+void fsm_controller::create_state_machine(fsm_description& fsm)
 {
    INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "-->Create state machine");
    const auto stg = HLS->STG->CGetStg();
@@ -167,9 +169,10 @@ void fsm_controller::create_state_machine(std::string& parse)
    THROW_ASSERT(boost::out_degree(entry, *stg) == 1, "Non deterministic initial state");
    /// Getting first state (initial one). It will be also first state for resetting
    const auto first_state = boost::target(*boost::out_edges(entry, *stg).first, *stg);
-   /// adding reset state to machine encoding
-   parse += stg->CGetStateInfo(first_state)->name + " " + RESET_PORT_NAME + " " + START_PORT_NAME + " " +
-            CLOCK_PORT_NAME + ";\n";
+   /// adding reset, start and clock ports to machine encoding; the reset state is the first one added
+   fsm.reset_port = RESET_PORT_NAME;
+   fsm.start_port = START_PORT_NAME;
+   fsm.clock_port = CLOCK_PORT_NAME;
 
    const auto& selectors = HLS->Rconn->GetSelectors();
 
@@ -476,46 +479,13 @@ void fsm_controller::create_state_machine(std::string& parse)
    INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Computed default output of each state");
 
    /// write bypass assignments
-   bool first_io = true;
    for(const auto& vio : bypass_signals)
    {
-      if(first_io)
-      {
-         first_io = false;
-      }
-      else
-      {
-         parse += ":";
-      }
-      parse += STR(vio.first) + "=";
-      bool first_vi = true;
       for(const auto& vi : vio.second)
       {
-         if(first_vi)
-         {
-            first_vi = false;
-         }
-         else
-         {
-            parse += ",";
-         }
-         parse += stg->CGetStateInfo(vi.first)->name + ">";
-         bool first_i = true;
-         for(const auto& i : vi.second)
-         {
-            if(first_i)
-            {
-               first_i = false;
-            }
-            else
-            {
-               parse += "<";
-            }
-            parse += STR(i);
-         }
+         fsm.bypass_signals[vio.first][stg->CGetStateInfo(vi.first)->name] = vi.second;
       }
    }
-   parse += ";\n";
 
    analyzed_loops.clear();
 
@@ -537,7 +507,10 @@ void fsm_controller::create_state_machine(std::string& parse)
          }
          INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "-->Analyzing state " + stg->CGetStateInfo(v)->name);
 
-         parse += stg->CGetStateInfo(v)->name + " 0" + input_vector_to_string(present_state[v], false);
+         fsm.states.emplace_back();
+         auto& fsm_st = fsm.states.back();
+         fsm_st.name = stg->CGetStateInfo(v)->name;
+         fsm_st.outputs = to_output_vector(fsm_output_vector::ZERO, present_state[v]);
 
          std::list<EdgeDescriptor> sorted;
          EdgeDescriptor default_edge;
@@ -582,7 +555,9 @@ void fsm_controller::create_state_machine(std::string& parse)
             INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level,
                            "-->Considering successor state " + stg->CGetStateInfo(boost::target(e, *stg))->name);
             INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "---Number of inputs is " + std::to_string(in_num));
-            std::vector<std::string> in(in_num, "-");
+            fsm_transition transition;
+            auto& in = transition.guards;
+            in.resize(in_num);
 
             INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Analyzing condition");
             auto transitionType = stg->CGetTransitionInfo(e)->get_type();
@@ -594,15 +569,17 @@ void fsm_controller::create_state_machine(std::string& parse)
             {
                auto op = stg->CGetTransitionInfo(e)->get_operation();
                THROW_ASSERT(cond_ports.find(op) != cond_ports.end(), "the port is missing");
-               THROW_ASSERT(in[cond_ports.find(op)->second] == "-", "two different values for the same condition port");
-               in[cond_ports.find(op)->second] = "1";
+               THROW_ASSERT(in[cond_ports.find(op)->second].is_dont_care(),
+                            "two different values for the same condition port");
+               in[cond_ports.find(op)->second].terms.push_back(fsm_guard::term{false, 1});
             }
             else if(transitionType == FALSE_COND)
             {
                auto op = stg->CGetTransitionInfo(e)->get_operation();
                THROW_ASSERT(cond_ports.find(op) != cond_ports.end(), "the port is missing");
-               THROW_ASSERT(in[cond_ports.find(op)->second] == "-", "two different values for the same condition port");
-               in[cond_ports.find(op)->second] = "0";
+               THROW_ASSERT(in[cond_ports.find(op)->second].is_dont_care(),
+                            "two different values for the same condition port");
+               in[cond_ports.find(op)->second].terms.push_back(fsm_guard::term{false, 0});
             }
             else if(transitionType == ALL_FINISHED)
             {
@@ -611,17 +588,17 @@ void fsm_controller::create_state_machine(std::string& parse)
                {
                   auto op = *(ops.begin());
                   THROW_ASSERT(cond_ports.find(op) != cond_ports.end(), "the port is missing");
-                  THROW_ASSERT(in[cond_ports.find(op)->second] == "-",
+                  THROW_ASSERT(in[cond_ports.find(op)->second].is_dont_care(),
                                "two different values for the same condition port");
-                  in[cond_ports.find(op)->second] = "1";
+                  in[cond_ports.find(op)->second].terms.push_back(fsm_guard::term{false, 1});
                }
                else
                {
                   auto state = stg->CGetTransitionInfo(e)->get_ref_state();
                   THROW_ASSERT(mu_ports.find(state) != mu_ports.end(), "the port is missing");
-                  THROW_ASSERT(in[mu_ports.find(state)->second] == "-",
+                  THROW_ASSERT(in[mu_ports.find(state)->second].is_dont_care(),
                                "two different values for the same condition port");
-                  in[mu_ports.find(state)->second] = "1";
+                  in[mu_ports.find(state)->second].terms.push_back(fsm_guard::term{false, 1});
                }
             }
             else if(transitionType == NOT_ALL_FINISHED)
@@ -631,50 +608,34 @@ void fsm_controller::create_state_machine(std::string& parse)
                {
                   auto op = *(ops.begin());
                   THROW_ASSERT(cond_ports.find(op) != cond_ports.end(), "the port is missing");
-                  THROW_ASSERT(in[cond_ports.find(op)->second] == "-",
+                  THROW_ASSERT(in[cond_ports.find(op)->second].is_dont_care(),
                                "two different values for the same condition port");
-                  in[cond_ports.find(op)->second] = "0";
+                  in[cond_ports.find(op)->second].terms.push_back(fsm_guard::term{false, 0});
                }
                else
                {
                   auto state = stg->CGetTransitionInfo(e)->get_ref_state();
                   THROW_ASSERT(mu_ports.find(state) != mu_ports.end(), "the port is missing");
-                  THROW_ASSERT(in[mu_ports.find(state)->second] == "-",
+                  THROW_ASSERT(in[mu_ports.find(state)->second].is_dont_care(),
                                "two different values for the same condition port");
-                  in[mu_ports.find(state)->second] = "0";
+                  in[mu_ports.find(state)->second].terms.push_back(fsm_guard::term{false, 0});
                }
             }
             else if(transitionType == CASE_COND)
             {
                auto op = stg->CGetTransitionInfo(e)->get_operation();
                THROW_ASSERT(cond_ports.find(op) != cond_ports.end(), "the port is missing");
-               THROW_ASSERT(in[cond_ports.find(op)->second] == "-", "two different values for the same condition port");
-               std::string value = in[cond_ports.find(op)->second];
-               THROW_ASSERT(value == "-", "two different values for the same condition port");
+               auto& value = in[cond_ports.find(op)->second];
+               THROW_ASSERT(value.is_dont_care(), "two different values for the same condition port");
                auto labels = stg->CGetTransitionInfo(e)->get_labels();
                for(auto label : labels)
                {
-                  if(value == "-")
-                  {
-                     value = get_guard_value(TreeM, label, op, data);
-                  }
-                  else
-                  {
-                     value += "|" + get_guard_value(TreeM, label, op, data);
-                  }
+                  get_guard_value(TreeM, label, op, data, value);
                }
                if(stg->CGetTransitionInfo(e)->get_has_default())
                {
-                  if(value == "-")
-                  {
-                     value = STR(default_COND);
-                  }
-                  else
-                  {
-                     value += "|" + STR(default_COND);
-                  }
+                  value.terms.push_back(fsm_guard::term{false, default_COND});
                }
-               in[cond_ports.find(op)->second] = value;
             }
             else
             {
@@ -682,19 +643,6 @@ void fsm_controller::create_state_machine(std::string& parse)
             }
             INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Analyzed conditions");
 
-            parse += " : ";
-            for(auto in_it = in.begin(); in_it != in.end(); ++in_it)
-            {
-               if(in_it == in.begin())
-               {
-                  parse += *in_it;
-               }
-               else
-               {
-                  parse += "," + *in_it;
-               }
-            }
-
             vertex tgt = boost::target(e, *stg);
             bool last_transition = tgt == HLS->STG->get_exit_state();
             vertex next_state = last_transition ? first_state : tgt;
@@ -788,30 +736,29 @@ void fsm_controller::create_state_machine(std::string& parse)
                }
             }
 
-            parse += " " + stg->CGetStateInfo(next_state)->name + " " + (assert_done_port ? "1" : "-") +
-                     input_vector_to_string(transition_outputs, false);
+            transition.next_state = stg->CGetStateInfo(next_state)->name;
+            transition.outputs = to_output_vector(
+                assert_done_port ? fsm_output_vector::ONE : fsm_output_vector::DONT_CARE, transition_outputs);
+            fsm_st.transitions.push_back(std::move(transition));
             INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--");
          }
 
-         parse += "; ";
-
-         parse += "\n";
          INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Analyzed state " + stg->CGetStateInfo(v)->name);
       }
    }
 
    INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Created state machine");
-   INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "---Finite_state_machine representation\n" + parse);
+   INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "---Finite_state_machine representation\n" + fsm.to_string());
 }
 
-std::string fsm_controller::get_guard_value(const tree_managerRef TM, const unsigned int index, vertex op,
-                                            const OpGraphConstRef data)
+void fsm_controller::get_guard_value(const tree_managerRef TM, const unsigned int index, vertex op,
+                                     const OpGraphConstRef data, fsm_guard& guard)
 {
    if((GET_TYPE(data, op) & TYPE_MULTIIF) != 0)
    {
       unsigned int node_id = data->CGetOpNodeInfo(op)->GetNodeId();
       unsigned int pos = tree_helper::get_multi_way_if_pos(TM, node_id, index);
-      return "&" + STR(pos);
+      guard.terms.push_back(fsm_guard::term{true, pos});
    }
    else
    {
@@ -829,29 +776,20 @@ std::string fsm_controller::get_guard_value(const tree_managerRef TM, const unsi
       }
       if(high_result == 0)
       {
-         return STR(low_result);
+         guard.terms.push_back(fsm_guard::term{false, low_result});
       }
       else
       {
-         std::string res_string;
          for(auto current_value = low_result; current_value <= high_result; ++current_value)
          {
-            if(current_value == low_result)
-            {
-               res_string = STR(current_value);
-            }
-            else
-            {
-               res_string += "|" + STR(current_value);
-            }
+            guard.terms.push_back(fsm_guard::term{false, current_value});
          }
-         return res_string;
       }
    }
 }
 
-void fsm_controller::add_correct_transition_memory(const std::string& state_representation, structural_managerRef SM)
+void fsm_controller::add_correct_transition_memory(const fsm_descriptionConstRef& fsm, structural_managerRef SM)
 {
    structural_objectRef circuit = SM->get_circ();
-   SM->add_NP_functionality(circuit, NP_functionality::FSM, state_representation);
+   SM->add_NP_functionality(circuit, NP_functionality::FSM, fsm);
 }
@@ -48,20 +48,22 @@
 
 REF_FORWARD_DECL(tree_manager);
 CONSTREF_FORWARD_DECL(OpGraph);
+CONSTREF_FORWARD_DECL(fsm_description);
+struct fsm_guard;
 
 class fsm_controller : public ControllerCreatorBaseStep
 {
    /**
-    * Generates the string representation of the FSM
+    * Generates the structured representation of the FSM
     */
-   void create_state_machine(std::string& parse);
+   void create_state_machine(fsm_description& fsm);
 
    /**
-    * Returns the value of the guard value of a case_label_expr
+    * Adds to guard the values of a case_label_expr
     * default is not managed
     */
-   std::string get_guard_value(const tree_managerRef TM, const unsigned int index, vertex op,
-                               const OpGraphConstRef data);
+   void get_guard_value(const tree_managerRef TM, const unsigned int index, vertex op, const OpGraphConstRef data,
+                        fsm_guard& guard);
 
    /**
     * Execute the step
@@ -72,9 +74,9 @@ class fsm_controller : public ControllerCreatorBaseStep
  protected:
    /**
     * Set the correct NP functionality
-    * @param state_representation is the state representation of the FSM
+    * @param fsm is the FSM
     */
-   virtual void add_correct_transition_memory(const std::string& state_representation, structural_managerRef SM);
+   virtual void add_correct_transition_memory(const fsm_descriptionConstRef& fsm, structural_managerRef SM);
 
  public:
    /**
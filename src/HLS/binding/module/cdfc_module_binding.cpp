@@ -76,6 +76,7 @@
 #include "storage_value_insertion.hpp"
 #include "technology_manager.hpp"
 #include "technology_node.hpp"
+#include "thread_pool.hpp"
 #include "tree_helper.hpp"
 #include "tree_manager.hpp"
 #include "tree_node.hpp"
@@ -87,6 +88,7 @@
 #include <cmath>
 #include <deque>
 #include <filesystem>
+#include <future>
 #include <iosfwd>
 #include <limits>
 #include <list>
@@ -1639,6 +1641,9 @@ DesignFlowStep_Status cdfc_module_binding::InternalExec()
          START_TIME(falseloop_cputime);
       }
 
+      /// the workers available when --flow-jobs has been requested
+      const auto flow_pool = design_flow_manager.lock()->CGetThreadPool();
+
       unsigned int k = 2;
       std::deque<cdfc_edge> candidate_edges;
       CustomUnorderedSet<vertex> no_cycles;
@@ -1648,20 +1653,57 @@ DesignFlowStep_Status cdfc_module_binding::InternalExec()
       do
       {
          restart = false;
+         std::vector<vertex> round_candidates;
          for(const auto candidate : all_candidate_vertices)
          {
             if(no_cycles.find(candidate) != no_cycles.end())
             {
                continue;
             }
-            cdfc_vertex start = s2c[candidate];
-
+            const auto start = s2c.at(candidate);
             if(cd_levels[boost::get(boost::vertex_index, *CG, start)] != 0 && boost::in_degree(start, *CG) != 0)
             {
-               bool found_a_loop;
+               round_candidates.push_back(candidate);
+            }
+            else
+            {
+               no_cycles.insert(candidate);
+            }
+         }
+         size_t next_candidate = 0;
+         while(next_candidate < round_candidates.size())
+         {
+            /// With a worker pool, a chunk of candidates is searched concurrently on the current graph: the results are
+            /// valid up to the first candidate having a loop, since the removal of its edges modifies the graph
+            const auto chunk_size =
+                flow_pool ? std::min(flow_pool->size(), round_candidates.size() - next_candidate) : size_t(1);
+            std::vector<std::deque<cdfc_edge>> chunk_edges(chunk_size);
+            std::vector<std::future<bool>> chunk_searches;
+            if(flow_pool)
+            {
+               for(size_t i = 0; i < chunk_size; ++i)
+               {
+                  const auto start = s2c.at(round_candidates.at(next_candidate + i));
+                  auto& edges = chunk_edges.at(i);
+                  chunk_searches.push_back(flow_pool->Submit(
+                      [this, start, k, &cdfc, &CG, &edges]() { return false_loop_search(start, k, cdfc, CG, edges); }));
+               }
+               for(auto& chunk_search : chunk_searches)
+               {
+                  chunk_search.wait();
+               }
+            }
+            size_t chunk_index = 0;
+            for(; chunk_index < chunk_size; ++chunk_index)
+            {
+               const auto candidate = round_candidates.at(next_candidate + chunk_index);
+               const auto start = s2c.at(candidate);
                INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
                               "-->Search loops starting from -> " + GET_NAME(sdg, candidate) + " iteration " + STR(k));
-               found_a_loop = false_loop_search(start, k, cdfc, CG, candidate_edges);
+               candidate_edges = std::move(chunk_edges.at(chunk_index));
+               bool found_a_loop = flow_pool ? chunk_searches.at(chunk_index).get() :
+                                               false_loop_search(start, k, cdfc, CG, candidate_edges);
+               const auto removed_edges = found_a_loop;
                if(!found_a_loop)
                {
                   no_cycles.insert(candidate);
@@ -1751,11 +1793,14 @@ DesignFlowStep_Status cdfc_module_binding::InternalExec()
                               "<--Searched loops starting from -> " + GET_NAME(sdg, candidate) + " iteration " +
                                   STR(k));
                THROW_ASSERT(candidate_edges.empty(), "candidate_cycle has to be empty");
+               if(removed_edges)
+               {
+                  /// the remaining results of the chunk have been computed on the old graph
+                  ++chunk_index;
+                  break;
+               }
             }
-            else
-            {
-               no_cycles.insert(candidate);
-            }
+            next_candidate += chunk_index;
          }
          ++k;
       } while(restart);
@@ -1844,6 +1889,373 @@ DesignFlowStep_Status cdfc_module_binding::InternalExec()
       double total_area_muxes_best = 0;
       double total_DSPs_best = 0;
 
+      /// Data of the covering problem of each resource type, in the order of the serial algorithm; allocation
+      /// information caches its answers, so all the queries are performed here before any covering is solved
+      struct partition_info
+      {
+         const decltype(partitions)::value_type* partition;
+         std::string res_name;
+         std::string fu_name;
+         unsigned long long fu_prec;
+         double controller_delay;
+         double area_resource;
+         double local_mux_time;
+         CliqueCovering_Algorithm clique_covering_method;
+         bool disabling_slack_cond0;
+         bool disabling_slack_based_binding;
+         bool cond1;
+         bool cond2;
+         unsigned int number_fu;
+         unsigned int number_channels;
+         bool is_readonly_memory_unit;
+         bool is_shared_memory_unit;
+      };
+      std::vector<partition_info> partition_infos;
+      for(const auto& partition : partitions)
+      {
+         THROW_ASSERT(partition.second.size() > 1, "bad projection");
+         partition_info info;
+         info.partition = &partition;
+         const double mux_time = MODULE_BINDING_MUX_MARGIN * allocation_information->estimate_mux_time(partition.first);
+         info.controller_delay = allocation_information->EstimateControllerDelay();
+         const double resource_area = allocation_information->compute_normalized_area(partition.first);
+         info.fu_prec = allocation_information->get_prec(partition.first);
+         info.fu_name = allocation_information->get_string_name(partition.first);
+
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                        "---controller_delay: " + STR(info.controller_delay) +
+                            " resource normalized area=" + STR(resource_area));
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                        "---mux_time: " + STR(mux_time) +
+                            " area_mux=" + STR(allocation_information->estimate_mux_area(partition.first)));
+
+         info.number_fu = allocation_information->get_number_fu(partition.first);
+         info.number_channels = allocation_information->get_number_channels(partition.first);
+         info.is_readonly_memory_unit = allocation_information->is_readonly_memory_unit(partition.first);
+         info.disabling_slack_cond0 =
+             ((info.number_channels >= 1) and
+              (!info.is_readonly_memory_unit ||
+               (!parameters->isOption(OPT_rom_duplication) || !parameters->getOption<bool>(OPT_rom_duplication))));
+         info.clique_covering_method = [&]() {
+            if(info.disabling_slack_cond0)
+            {
+               PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
+                             "DISABLING STD clique covering algorithm. Forced to BIPARTITE_MATCHING");
+               return CliqueCovering_Algorithm::BIPARTITE_MATCHING;
+            }
+            return GetPointer<const CDFCModuleBindingSpecialization>(hls_flow_step_specialization)
+                ->clique_covering_algorithm;
+         }();
+
+         info.res_name = allocation_information->get_fu_name(partition.first).first;
+         const auto lib_name = HLS->HLS_D->get_technology_manager()->get_library(info.res_name);
+         info.disabling_slack_based_binding = info.disabling_slack_cond0 || lib_name == WORK_LIBRARY ||
+                                              lib_name == PROXY_LIBRARY || info.number_fu != INFINITE_UINT;
+         THROW_ASSERT(lib_name != PROXY_LIBRARY || 1 == info.number_fu, "unexpected condition");
+         info.local_mux_time =
+             (info.disabling_slack_based_binding ? -std::numeric_limits<double>::infinity() : mux_time);
+         info.cond1 = compute_condition1(lib_name, allocation_information, info.local_mux_time, partition.first);
+         info.cond2 = compute_condition2(info.cond1, info.fu_prec, resource_area, small_normalized_resource_area);
+         info.area_resource = allocation_information->get_area(partition.first) +
+                              100 * allocation_information->get_DSPs(partition.first);
+
+         /// Specify the minimum number of resources in case we have to use all the memory ports.
+         /// That is relevant for memories attached to the bus
+         /// Private memories should use the minimum number of ports to minimize the total area.
+         unsigned var = allocation_information->is_direct_access_memory_unit(partition.first) ?
+                            (allocation_information->is_memory_unit(partition.first) ?
+                                 allocation_information->get_memory_var(partition.first) :
+                                 allocation_information->get_proxy_memory_var(partition.first)) :
+                            0;
+         info.is_shared_memory_unit = var && !HLSMgr->Rmem->is_private_memory(var);
+         partition_infos.push_back(info);
+      }
+      const auto dot_directory = parameters->getOption<std::filesystem::path>(OPT_dot_directory) / functionName;
+      if(parameters->getOption<bool>(OPT_print_dot))
+      {
+         std::filesystem::create_directories(dot_directory);
+      }
+
+      /// Build and solve the clique covering problem of a resource type; it only reads the current binding and the
+      /// given slack and starting times, so different resource types can be solved concurrently
+      const auto solve_partition = [&](const partition_info& info,
+                                       const CustomUnorderedMap<vertex, double>& slack_view,
+                                       const CustomUnorderedMap<vertex, double>& starting_view) {
+         const auto& partition = *info.partition;
+         /// build the clique covering solver
+         auto module_clique = clique_covering<vertex>::create_solver(info.clique_covering_method,
+                                                                     static_cast<unsigned>(partition.second.size()));
+         /// add vertex to the clique covering solver
+         for(const auto v : partition.second)
+         {
+            const auto op_info = sdg->CGetOpNodeInfo(c2s[boost::get(boost::vertex_index, *CG, v)]);
+            const auto el1_name = op_info->vertex_name + "(" + op_info->GetOperation() + ")";
+            module_clique->add_vertex(c2s[boost::get(boost::vertex_index, *CG, v)], el1_name);
+         }
+
+         if(info.clique_covering_method == CliqueCovering_Algorithm::BIPARTITE_MATCHING)
+         {
+            CustomUnorderedMap<vertex, size_t> v2id;
+            size_t max_id = 0, curr_id;
+            for(const auto v : partition.second)
+            {
+               const auto& running_states =
+                   HLS->Rliv->get_state_where_run(c2s[boost::get(boost::vertex_index, *CG, v)]);
+               for(const auto state : running_states)
+               {
+                  const auto v2id_it = v2id.find(state);
+                  if(v2id_it == v2id.end())
+                  {
+                     curr_id = max_id;
+                     v2id[state] = max_id;
+                     ++max_id;
+                  }
+                  else
+                  {
+                     curr_id = v2id_it->second;
+                  }
+                  module_clique->add_subpartitions(curr_id, c2s[boost::get(boost::vertex_index, *CG, v)]);
+               }
+            }
+         }
+
+         /// add the edges
+         cdfc_edge_iterator cg_ei, cg_ei_end;
+         const cdfc_graphConstRef CG_subgraph(new cdfc_graph(
+             *cdfc_bulk_graph, cdfc_graph_edge_selector<boost_cdfc_graph>(COMPATIBILITY_EDGE, &*cdfc_bulk_graph),
+             cdfc_graph_vertex_selector<boost_cdfc_graph>(&partition.second)));
+         for(boost::tie(cg_ei, cg_ei_end) = boost::edges(*CG_subgraph); cg_ei != cg_ei_end; ++cg_ei)
+         {
+            vertex src = c2s[boost::get(boost::vertex_index, *CG_subgraph, boost::source(*cg_ei, *CG_subgraph))];
+            vertex tgt = c2s[boost::get(boost::vertex_index, *CG_subgraph, boost::target(*cg_ei, *CG_subgraph))];
+#if HAVE_UNORDERED
+            if(src > tgt)
+            {
+#else
+            if(dfg->CGetOpNodeInfo(src)->vertex_name > dfg->CGetOpNodeInfo(tgt)->vertex_name)
+            {
+#endif
+               continue; /// only one edge is needed to build the undirected compatibility graph
+            }
+            const auto w = weight_computation(info.cond1, info.cond2, src, tgt, info.local_mux_time, dfg, fu,
+                                              slack_view, starting_view,
+#ifdef HC_APPROACH
+                                              hc,
+#endif
+                                              con_rel, info.controller_delay, info.fu_prec);
+            if(w > 0)
+            {
+               module_clique->add_edge(src, tgt, w);
+            }
+            else
+            {
+               THROW_ASSERT(!info.disabling_slack_based_binding, "unexpected condition");
+            }
+         }
+         if(parameters->getOption<bool>(OPT_print_dot))
+         {
+            module_clique->writeDot(dot_directory / ("MB_" + info.fu_name + ".dot"));
+         }
+
+         if(info.number_fu != INFINITE_UINT)
+         {
+            THROW_ASSERT(info.number_channels == 0 || info.number_channels == info.number_fu, "unexpected condition");
+            PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
+                          "Defining resource constraints for  : " + info.fu_name + " to " + STR(info.number_fu));
+            module_clique->suggest_min_resources(info.number_channels);
+            if(info.number_channels > 0)
+            {
+               module_clique->max_resources(info.number_channels);
+            }
+         }
+
+         if(info.is_shared_memory_unit)
+         {
+            module_clique->min_resources(info.number_channels);
+         }
+
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                        "Starting clique covering on a graph with " + STR(partition.second.size()) + " vertices for " +
+                            info.fu_name);
+
+         /// performing clique covering
+         if(info.disabling_slack_based_binding)
+         {
+            PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
+                          "Disabled slack based clique covering for: " + info.res_name);
+            {
+               no_check_clique<vertex> cq;
+               module_clique->exec(no_filter_clique<vertex>(), cq);
+            }
+            INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
+                           "Number of cliques covering the graph: " + STR(module_clique->num_vertices()) + " for " +
+                               info.fu_name);
+            if(module_clique->num_vertices() == 0 ||
+               (info.number_channels >= 1 && module_clique->num_vertices() > info.number_channels))
+            {
+               if(info.disabling_slack_cond0)
+               {
+                  PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
+                                "Restarting with WEIGHTED_COLORING: " + info.res_name);
+               }
+               else
+               {
+                  PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
+                                "Restarting with BIPARTITE_MATCHING: " + info.res_name);
+               }
+               module_clique = clique_covering<vertex>::create_solver(
+                   (info.disabling_slack_cond0 ? CliqueCovering_Algorithm::WEIGHTED_COLORING :
+                                                 CliqueCovering_Algorithm::BIPARTITE_MATCHING),
+                   static_cast<unsigned>(partition.second.size()));
+               for(const auto v : partition.second)
+               {
+                  const auto el1_name =
+                      GET_NAME(sdg, c2s[boost::get(boost::vertex_index, *CG, v)]) + "(" +
+                      sdg->CGetOpNodeInfo(c2s[boost::get(boost::vertex_index, *CG, v)])->GetOperation() + ")";
+                  module_clique->add_vertex(c2s[boost::get(boost::vertex_index, *CG, v)], el1_name);
+               }
+               {
+                  CustomUnorderedMap<vertex, size_t> v2id;
+                  size_t max_id = 0, curr_id;
+                  for(const auto v : partition.second)
+                  {
+                     const CustomOrderedSet<vertex>& running_states =
+                         HLS->Rliv->get_state_where_run(c2s[boost::get(boost::vertex_index, *CG, v)]);
+                     for(const auto state : running_states)
+                     {
+                        const auto v2di_it = v2id.find(state);
+                        if(v2di_it == v2id.end())
+                        {
+                           curr_id = max_id;
+                           v2id[state] = max_id;
+                           ++max_id;
+                        }
+                        else
+                        {
+                           curr_id = v2di_it->second;
+                        }
+                        module_clique->add_subpartitions(curr_id, c2s[boost::get(boost::vertex_index, *CG, v)]);
+                     }
+                  }
+               }
+               const cdfc_graphConstRef CG_subgraph0(
+                   new cdfc_graph(*cdfc_bulk_graph,
+                                  cdfc_graph_edge_selector<boost_cdfc_graph>(COMPATIBILITY_EDGE, &*cdfc_bulk_graph),
+                                  cdfc_graph_vertex_selector<boost_cdfc_graph>(&partition.second)));
+               for(boost::tie(cg_ei, cg_ei_end) = boost::edges(*CG_subgraph0); cg_ei != cg_ei_end; ++cg_ei)
+               {
+                  const auto src =
+                      c2s[boost::get(boost::vertex_index, *CG_subgraph0, boost::source(*cg_ei, *CG_subgraph0))];
+                  const auto tgt =
+                      c2s[boost::get(boost::vertex_index, *CG_subgraph0, boost::target(*cg_ei, *CG_subgraph0))];
+#if HAVE_UNORDERED
+                  if(src > tgt)
+#else
+                  if(dfg->CGetOpNodeInfo(src)->vertex_name > dfg->CGetOpNodeInfo(tgt)->vertex_name)
+#endif
+                  {
+                     continue; /// only one edge is needed to build the undirected compatibility graph
+                  }
+                  const auto w = weight_computation(info.cond1, info.cond2, src, tgt, info.local_mux_time, dfg, fu,
+                                                    slack_view, starting_view,
+#ifdef HC_APPROACH
+                                                    hc,
+#endif
+                                                    con_rel, info.controller_delay, info.fu_prec);
+                  if(w > 0)
+                  {
+                     module_clique->add_edge(src, tgt, w);
+                  }
+                  else
+                  {
+                     THROW_ERROR("unexpected condition");
+                  }
+               }
+               if(info.number_fu != INFINITE_UINT)
+               {
+                  THROW_ASSERT(info.number_channels == 0 || info.number_channels == info.number_fu,
+                               "unexpected condition");
+
+                  module_clique->suggest_min_resources(info.number_channels);
+                  if(info.number_channels > 0)
+                  {
+                     module_clique->max_resources(info.number_channels);
+                  }
+               }
+
+               if(info.is_shared_memory_unit)
+               {
+                  module_clique->min_resources(info.number_channels);
+               }
+               {
+                  no_check_clique<vertex> cq;
+                  module_clique->exec(no_filter_clique<vertex>(), cq);
+               }
+               if(info.number_fu != INFINITE_UINT)
+               {
+                  THROW_ASSERT(info.number_channels == 0 || info.number_channels == info.number_fu,
+                               "unexpected condition");
+                  if(info.number_channels > 0 && module_clique->num_vertices() > info.number_channels &&
+                     !info.is_readonly_memory_unit)
+                  {
+                     THROW_ERROR("Something of wrong happen: no feasible solution exist for module binding: " +
+                                 info.res_name + "[" + STR(module_clique->num_vertices()) + "]");
+                  }
+               }
+            }
+         }
+         else
+         {
+            module_register_binding_spec mrbs;
+            module_binding_check<vertex> cq(info.fu_prec, info.area_resource, HLS, HLSMgr, slack_view, starting_view,
+                                            info.controller_delay, mrbs);
+            module_clique->exec(slack_based_filtering(slack_view, starting_view, info.controller_delay, info.fu_prec,
+                                                      HLS, HLSMgr, info.area_resource, con_rel),
+                                cq);
+         }
+         return module_clique;
+      };
+
+      /// Return the data read by the clique covering of a resource type which the coverings of the other resource
+      /// types can change: the slack and starting times of its operations and, as in estimate_muxes, the binding of
+      /// the operations producing their operands and using their results
+      const auto covering_inputs = [&](const partition_info& info) {
+         const auto has_register_done = HLS->Rreg && HLS->Rreg->size() != 0;
+         std::vector<double> inputs;
+         const auto add_binding = [&](const vertex op) {
+            const auto index = fu->get_index(op);
+            inputs.push_back(index);
+            if(index != INFINITE_UINT)
+            {
+               inputs.push_back(fu->get_assign(op));
+            }
+         };
+         for(const auto v : info.partition->second)
+         {
+            const auto op = c2s[boost::get(boost::vertex_index, *CG, v)];
+            inputs.push_back(slack_time.find(op)->second);
+            inputs.push_back(starting_time.find(op)->second);
+            for(const auto& port_connections : con_rel.find(op)->second)
+            {
+               for(const auto& connection : port_connections)
+               {
+                  if(connection.first == no_phi_chained || (connection.first != no_def && !has_register_done))
+                  {
+                     add_binding(connection.second.second);
+                  }
+               }
+            }
+            for(const auto& oe : fdfg->CGetOutEdges(op))
+            {
+               if(fdfg->GetSelector(oe) & (DFG_SCA_SELECTOR | FB_DFG_SCA_SELECTOR))
+               {
+                  add_binding(boost::target(oe, *fdfg));
+               }
+            }
+         }
+         return inputs;
+      };
+
       for(unsigned int iteration = 0; iteration < number_of_iterations; ++iteration)
       {
          INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Running iteration " + STR(iteration));
@@ -1895,305 +2307,49 @@ DesignFlowStep_Status cdfc_module_binding::InternalExec()
          {
             START_TIME(clique_iteration_cputime);
          }
-         for(const auto& partition : partitions)
+         /// With a worker pool, the covering problems of the different resource types are solved concurrently
+         /// against the binding and the slack and starting times of the beginning of the iteration. The solutions are
+         /// applied in the serial order, and a covering whose inputs have been changed by the solutions applied before
+         /// it is solved again, so the result is the one of the serial execution whatever the number of workers
+         std::vector<refcount<clique_covering<vertex>>> coverings;
+         std::vector<std::vector<double>> coverings_inputs;
+         if(flow_pool && partition_infos.size() > 1)
          {
-            THROW_ASSERT(partition.second.size() > 1, "bad projection");
-            auto vert_it_end = partition.second.end();
-            const double mux_time =
-                MODULE_BINDING_MUX_MARGIN * allocation_information->estimate_mux_time(partition.first);
-            double controller_delay = allocation_information->EstimateControllerDelay();
-            double resource_area = allocation_information->compute_normalized_area(partition.first);
-            auto fu_prec = allocation_information->get_prec(partition.first);
-
-            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
-                           "---controller_delay: " + STR(controller_delay) +
-                               " resource normalized area=" + STR(resource_area));
-            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
-                           "---mux_time: " + STR(mux_time) +
-                               " area_mux=" + STR(allocation_information->estimate_mux_area(partition.first)));
-
-            const auto disabling_slack_cond0 =
-                ((allocation_information->get_number_channels(partition.first) >= 1) and
-                 (!allocation_information->is_readonly_memory_unit(partition.first) ||
-                  (!parameters->isOption(OPT_rom_duplication) || !parameters->getOption<bool>(OPT_rom_duplication))));
-            const auto clique_covering_method = [&]() {
-               if(disabling_slack_cond0)
-               {
-                  PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
-                                "DISABLING STD clique covering algorithm. Forced to BIPARTITE_MATCHING");
-                  return CliqueCovering_Algorithm::BIPARTITE_MATCHING;
-               }
-               return GetPointer<const CDFCModuleBindingSpecialization>(hls_flow_step_specialization)
-                   ->clique_covering_algorithm;
-            }();
-
-            const auto res_name = allocation_information->get_fu_name(partition.first).first;
-            const auto lib_name = HLS->HLS_D->get_technology_manager()->get_library(res_name);
-            const auto disabling_slack_based_binding =
-                disabling_slack_cond0 || lib_name == WORK_LIBRARY || lib_name == PROXY_LIBRARY ||
-                allocation_information->get_number_fu(partition.first) != INFINITE_UINT;
-            THROW_ASSERT(lib_name != PROXY_LIBRARY || 1 == allocation_information->get_number_fu(partition.first),
-                         "unexpected condition");
-
-            /// build the clique covering solver
-            auto module_clique = clique_covering<vertex>::create_solver(clique_covering_method,
-                                                                        static_cast<unsigned>(partition.second.size()));
-            /// add vertex to the clique covering solver
-            for(const auto v : partition.second)
-            {
-               const auto op_info = sdg->CGetOpNodeInfo(c2s[boost::get(boost::vertex_index, *CG, v)]);
-               const auto el1_name = op_info->vertex_name + "(" + op_info->GetOperation() + ")";
-               module_clique->add_vertex(c2s[boost::get(boost::vertex_index, *CG, v)], el1_name);
-            }
-
-            if(clique_covering_method == CliqueCovering_Algorithm::BIPARTITE_MATCHING)
-            {
-               CustomUnorderedMap<vertex, size_t> v2id;
-               size_t max_id = 0, curr_id;
-               for(const auto v : partition.second)
-               {
-                  const auto& running_states =
-                      HLS->Rliv->get_state_where_run(c2s[boost::get(boost::vertex_index, *CG, v)]);
-                  for(const auto state : running_states)
-                  {
-                     const auto v2id_it = v2id.find(state);
-                     if(v2id_it == v2id.end())
-                     {
-                        curr_id = max_id;
-                        v2id[state] = max_id;
-                        ++max_id;
-                     }
-                     else
-                     {
-                        curr_id = v2id_it->second;
-                     }
-                     module_clique->add_subpartitions(curr_id, c2s[boost::get(boost::vertex_index, *CG, v)]);
-                  }
-               }
-            }
-            double local_mux_time =
-                (disabling_slack_based_binding ? -std::numeric_limits<double>::infinity() : mux_time);
-            const auto cond1 = compute_condition1(lib_name, allocation_information, local_mux_time, partition.first);
-            const auto cond2 = compute_condition2(cond1, fu_prec, resource_area, small_normalized_resource_area);
-
-            /// add the edges
-            cdfc_edge_iterator cg_ei, cg_ei_end;
-            const cdfc_graphConstRef CG_subgraph(new cdfc_graph(
-                *cdfc_bulk_graph, cdfc_graph_edge_selector<boost_cdfc_graph>(COMPATIBILITY_EDGE, &*cdfc_bulk_graph),
-                cdfc_graph_vertex_selector<boost_cdfc_graph>(&partition.second)));
-            for(boost::tie(cg_ei, cg_ei_end) = boost::edges(*CG_subgraph); cg_ei != cg_ei_end; ++cg_ei)
-            {
-               vertex src = c2s[boost::get(boost::vertex_index, *CG_subgraph, boost::source(*cg_ei, *CG_subgraph))];
-               vertex tgt = c2s[boost::get(boost::vertex_index, *CG_subgraph, boost::target(*cg_ei, *CG_subgraph))];
-#if HAVE_UNORDERED
-               if(src > tgt)
-               {
-#else
-               if(dfg->CGetOpNodeInfo(src)->vertex_name > dfg->CGetOpNodeInfo(tgt)->vertex_name)
-               {
-#endif
-                  continue; /// only one edge is needed to build the undirected compatibility graph
-               }
-               _w = weight_computation(cond1, cond2, src, tgt, local_mux_time, dfg, fu, slack_time, starting_time,
-#ifdef HC_APPROACH
-                                       hc,
-#endif
-                                       con_rel, controller_delay, fu_prec);
-               if(_w > 0)
-               {
-                  module_clique->add_edge(src, tgt, _w);
-               }
-               else
-               {
-                  THROW_ASSERT(!disabling_slack_based_binding, "unexpected condition");
-               }
-            }
-            if(parameters->getOption<bool>(OPT_print_dot))
+            std::vector<std::future<refcount<clique_covering<vertex>>>> covering_results;
+            for(const auto& info : partition_infos)
             {
-               const auto output_directory =
-                   parameters->getOption<std::filesystem::path>(OPT_dot_directory) / functionName;
-               std::filesystem::create_directories(output_directory);
-               const auto file_name =
-                   output_directory / ("MB_" + allocation_information->get_string_name(partition.first) + ".dot");
-               module_clique->writeDot(file_name);
+               coverings_inputs.push_back(covering_inputs(info));
+               covering_results.push_back(flow_pool->Submit(
+                   [&solve_partition, &info, &slack_time, &starting_time]() -> refcount<clique_covering<vertex>> {
+                      return solve_partition(info, slack_time, starting_time);
+                   }));
             }
-
-            if(allocation_information->get_number_fu(partition.first) != INFINITE_UINT)
+            /// All the workers have to be completed before any solution (or exception) is considered
+            for(auto& covering_result : covering_results)
             {
-               THROW_ASSERT(allocation_information->get_number_channels(partition.first) == 0 ||
-                                allocation_information->get_number_channels(partition.first) ==
-                                    allocation_information->get_number_fu(partition.first),
-                            "unexpected condition");
-               PRINT_DBG_MEX(
-                   DEBUG_LEVEL_VERBOSE, debug_level,
-                   "Defining resource constraints for  : " + allocation_information->get_string_name(partition.first) +
-                       " to " + STR(allocation_information->get_number_fu(partition.first)));
-               module_clique->suggest_min_resources(allocation_information->get_number_channels(partition.first));
-               if(allocation_information->get_number_channels(partition.first) > 0)
-               {
-                  module_clique->max_resources(allocation_information->get_number_channels(partition.first));
-               }
+               covering_result.wait();
             }
-
-            /// Specify the minimum number of resources in case we have to use all the memory ports.
-            /// That is relevant for memories attached to the bus
-            /// Private memories should use the minimum number of ports to minimize the total area.
-            unsigned var = allocation_information->is_direct_access_memory_unit(partition.first) ?
-                               (allocation_information->is_memory_unit(partition.first) ?
-                                    allocation_information->get_memory_var(partition.first) :
-                                    allocation_information->get_proxy_memory_var(partition.first)) :
-                               0;
-            if(var && !HLSMgr->Rmem->is_private_memory(var))
+            for(auto& covering_result : covering_results)
             {
-               module_clique->min_resources(allocation_information->get_number_channels(partition.first));
+               coverings.push_back(covering_result.get());
             }
-
-            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
-                           "Starting clique covering on a graph with " + STR(partition.second.size()) +
-                               " vertices for " + allocation_information->get_string_name(partition.first));
-
-            /// performing clique covering
-            if(disabling_slack_based_binding)
-            {
-               PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Disabled slack based clique covering for: " + res_name);
-               {
-                  no_check_clique<vertex> cq;
-                  module_clique->exec(no_filter_clique<vertex>(), cq);
-               }
-               INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
-                              "Number of cliques covering the graph: " + STR(module_clique->num_vertices()) + " for " +
-                                  allocation_information->get_string_name(partition.first));
-               if(module_clique->num_vertices() == 0 ||
-                  (allocation_information->get_number_channels(partition.first) >= 1 &&
-                   module_clique->num_vertices() > allocation_information->get_number_channels(partition.first)))
-               {
-                  if(disabling_slack_cond0)
-                  {
-                     PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Restarting with WEIGHTED_COLORING: " + res_name);
-                  }
-                  else
-                  {
-                     PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Restarting with BIPARTITE_MATCHING: " + res_name);
-                  }
-                  module_clique = clique_covering<vertex>::create_solver(
-                      (disabling_slack_cond0 ? CliqueCovering_Algorithm::WEIGHTED_COLORING :
-                                               CliqueCovering_Algorithm::BIPARTITE_MATCHING),
-                      static_cast<unsigned>(partition.second.size()));
-                  for(auto vert_it = partition.second.begin(); vert_it != vert_it_end; ++vert_it)
-                  {
-                     const auto el1_name =
-                         GET_NAME(sdg, c2s[boost::get(boost::vertex_index, *CG, *vert_it)]) + "(" +
-                         sdg->CGetOpNodeInfo(c2s[boost::get(boost::vertex_index, *CG, *vert_it)])->GetOperation() + ")";
-                     module_clique->add_vertex(c2s[boost::get(boost::vertex_index, *CG, *vert_it)], el1_name);
-                  }
-                  {
-                     CustomUnorderedMap<vertex, size_t> v2id;
-                     size_t max_id = 0, curr_id;
-                     for(const auto v : partition.second)
-                     {
-                        const CustomOrderedSet<vertex>& running_states =
-                            HLS->Rliv->get_state_where_run(c2s[boost::get(boost::vertex_index, *CG, v)]);
-                        for(const auto state : running_states)
-                        {
-                           const auto v2di_it = v2id.find(state);
-                           if(v2di_it == v2id.end())
-                           {
-                              curr_id = max_id;
-                              v2id[state] = max_id;
-                              ++max_id;
-                           }
-                           else
-                           {
-                              curr_id = v2di_it->second;
-                           }
-                           module_clique->add_subpartitions(curr_id, c2s[boost::get(boost::vertex_index, *CG, v)]);
-                        }
-                     }
-                  }
-                  const cdfc_graphConstRef CG_subgraph0(
-                      new cdfc_graph(*cdfc_bulk_graph,
-                                     cdfc_graph_edge_selector<boost_cdfc_graph>(COMPATIBILITY_EDGE, &*cdfc_bulk_graph),
-                                     cdfc_graph_vertex_selector<boost_cdfc_graph>(&partition.second)));
-                  for(boost::tie(cg_ei, cg_ei_end) = boost::edges(*CG_subgraph0); cg_ei != cg_ei_end; ++cg_ei)
-                  {
-                     const auto src =
-                         c2s[boost::get(boost::vertex_index, *CG_subgraph0, boost::source(*cg_ei, *CG_subgraph0))];
-                     const auto tgt =
-                         c2s[boost::get(boost::vertex_index, *CG_subgraph0, boost::target(*cg_ei, *CG_subgraph0))];
-#if HAVE_UNORDERED
-                     if(src > tgt)
-#else
-                     if(dfg->CGetOpNodeInfo(src)->vertex_name > dfg->CGetOpNodeInfo(tgt)->vertex_name)
-#endif
-                     {
-                        continue; /// only one edge is needed to build the undirected compatibility graph
-                     }
-                     _w = weight_computation(cond1, cond2, src, tgt, local_mux_time, dfg, fu, slack_time, starting_time,
-#ifdef HC_APPROACH
-                                             hc,
-#endif
-                                             con_rel, controller_delay, fu_prec);
-                     if(_w > 0)
-                     {
-                        module_clique->add_edge(src, tgt, _w);
-                     }
-                     else
-                     {
-                        THROW_ERROR("unexpected condition");
-                     }
-                  }
-                  if(allocation_information->get_number_fu(partition.first) != INFINITE_UINT)
-                  {
-                     THROW_ASSERT(allocation_information->get_number_channels(partition.first) == 0 ||
-                                      allocation_information->get_number_channels(partition.first) ==
-                                          allocation_information->get_number_fu(partition.first),
-                                  "unexpected condition");
-
-                     module_clique->suggest_min_resources(allocation_information->get_number_channels(partition.first));
-                     if(allocation_information->get_number_channels(partition.first) > 0)
-                     {
-                        module_clique->max_resources(allocation_information->get_number_channels(partition.first));
-                     }
-                  }
-
-                  /// Specify the minimum number of resources in case we have to use all the memory ports.
-                  /// That is relevant for memories attached to the bus
-                  /// Private memories should use the minimum number of ports to minimize the total area.
-                  if(var && !HLSMgr->Rmem->is_private_memory(var))
-                  {
-                     module_clique->min_resources(allocation_information->get_number_channels(partition.first));
-                  }
-                  {
-                     no_check_clique<vertex> cq;
-                     module_clique->exec(no_filter_clique<vertex>(), cq);
-                  }
-                  if(allocation_information->get_number_fu(partition.first) != INFINITE_UINT)
-                  {
-                     THROW_ASSERT(allocation_information->get_number_channels(partition.first) == 0 ||
-                                      allocation_information->get_number_channels(partition.first) ==
-                                          allocation_information->get_number_fu(partition.first),
-                                  "unexpected condition");
-                     if(allocation_information->get_number_channels(partition.first) > 0 &&
-                        module_clique->num_vertices() > allocation_information->get_number_channels(partition.first) &&
-                        !allocation_information->is_readonly_memory_unit(partition.first))
-                     {
-                        THROW_ERROR("Something of wrong happen: no feasible solution exist for module binding: " +
-                                    res_name + "[" + STR(module_clique->num_vertices()) + "]");
-                     }
-                  }
-               }
-            }
-            else
+         }
+         for(size_t partition_index = 0; partition_index < partition_infos.size(); ++partition_index)
+         {
+            const auto& info = partition_infos.at(partition_index);
+            const auto& partition = *info.partition;
+            const auto is_stale_covering =
+                !coverings.empty() && covering_inputs(info) != coverings_inputs.at(partition_index);
+            if(is_stale_covering)
             {
-               const auto area_resource = allocation_information->get_area(partition.first) +
-                                          100 * allocation_information->get_DSPs(partition.first);
-               module_register_binding_spec mrbs;
-               module_binding_check<vertex> cq(fu_prec, area_resource, HLS, HLSMgr, slack_time, starting_time,
-                                               controller_delay, mrbs);
-               module_clique->exec(slack_based_filtering(slack_time, starting_time, controller_delay, fu_prec, HLS,
-                                                         HLSMgr, area_resource, con_rel),
-                                   cq);
+               INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "---Solving again the covering of " + info.fu_name);
             }
+            const auto module_clique = coverings.empty() || is_stale_covering ?
+                                           solve_partition(info, slack_time, starting_time) :
+                                           coverings.at(partition_index);
+            const auto disabling_slack_based_binding = info.disabling_slack_based_binding;
+            const auto controller_delay = info.controller_delay;
+            const auto fu_prec = info.fu_prec;
             INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
                            "Number of cliques covering the graph: " + STR(module_clique->num_vertices()) + " for " +
                                allocation_information->get_string_name(partition.first));
@@ -2623,11 +2779,11 @@ int cdfc_module_binding::weight_computation(bool cond1, bool cond2, vertex v1, v
 #endif
                                             ,
                                             const CustomUnorderedMap<vertex, double>& slack_time,
-                                            CustomUnorderedMap<vertex, double>& starting_time,
+                                            const CustomUnorderedMap<vertex, double>& starting_time,
 #ifdef HC_APPROACH
                                             spec_hierarchical_clustering& hc,
 #endif
-                                            connection_relation& con_rel, double controller_delay,
+                                            const connection_relation& con_rel, double controller_delay,
                                             unsigned long long prec)
 {
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
@@ -384,11 +384,11 @@ class cdfc_module_binding : public fu_binding_creator
    int weight_computation(bool cond1, bool cond2, vertex v1, vertex v2, const double mux_time,
                           const OpGraphConstRef fdfg, const fu_bindingConstRef fu,
                           const CustomUnorderedMap<vertex, double>& slack_time,
-                          CustomUnorderedMap<vertex, double>& starting_time,
+                          const CustomUnorderedMap<vertex, double>& starting_time,
 #ifdef HC_APPROACH
                           spec_hierarchical_clustering& hc,
 #endif
-                          connection_relation& con_rel, double controller_delay, unsigned long long prec);
+                          const connection_relation& con_rel, double controller_delay, unsigned long long prec);
 
    void update_slack_starting_time(const OpGraphConstRef fdfg, OpVertexSet& sorted_vertices,
                                    CustomUnorderedMap<vertex, double>& slack_time,
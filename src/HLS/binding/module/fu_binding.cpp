@@ -104,6 +104,7 @@
 /// utility include
 #include "fileIO.hpp"
 #include "math_function.hpp"
+#include "memory_image.hpp"
 #include "string_manipulation.hpp"
 
 const unsigned int fu_binding::UNKNOWN = std::numeric_limits<unsigned int>::max();
@@ -2469,27 +2470,21 @@ void fu_binding::specialize_memory_unit(const HLS_managerRef HLSMgr, const hlsRe
    fu_module->SetParameter("READ_ONLY_MEMORY", HLSMgr->Rmem->is_read_only_variable(ar) ? "1" : "0");
 }
 
-void fu_binding::fill_array_ref_memory(std::ostream& init_file_a, std::ostream& init_file_b, unsigned int ar,
-                                       unsigned long long& vec_size, unsigned long long& elts_size, const memoryRef mem,
-                                       tree_managerConstRef TM, bool is_sds, unsigned long long bitsize_align)
+/**
+ * Compute the layout of the memory storing a variable
+ * @param TM is the tree manager
+ * @param ar_node is the variable
+ * @param vec_size is the number of elements of the variable
+ * @param elts_size is the element size in bits
+ * @param element_align is the precision of the elements of a vector variable (0 otherwise)
+ * @return the type of the variable
+ */
+static tree_nodeConstRef get_array_ref_layout(const tree_managerConstRef& TM, const tree_nodeRef& ar_node,
+                                              unsigned long long& vec_size, unsigned long long& elts_size,
+                                              unsigned long long& element_align)
 {
-   init_file_b.put(0);
-   const auto is_memory_splitted = init_file_b.good();
-   init_file_b.seekp(std::ios_base::beg);
-
-   const auto ar_node = TM->GetTreeNode(ar);
-   tree_nodeRef init_node;
-   const auto vd = GetPointer<const var_decl>(ar_node);
-   if(vd && vd->init)
-   {
-      init_node = vd->init;
-   }
-   else if(GetPointer<const string_cst>(ar_node))
-   {
-      init_node = ar_node;
-   }
    const auto array_type_node = tree_helper::CGetType(ar_node);
-   unsigned long long element_align = 0;
+   element_align = 0;
    if(tree_helper::IsArrayEquivType(array_type_node))
    {
       std::vector<unsigned long long> dims;
@@ -2523,253 +2518,186 @@ void fu_binding::fill_array_ref_memory(std::ostream& init_file_a, std::ostream&
       THROW_ERROR("Type not supported: " + array_type_node->get_kind_text());
    }
    THROW_ASSERT(elts_size && vec_size, "");
-   if(is_sds)
+   return array_type_node;
+}
+
+/**
+ * Return the initializer of a variable, or nullptr when the memory has to be zero initialized
+ * @param ar_node is the variable
+ */
+static tree_nodeRef get_array_ref_init(const tree_nodeRef& ar_node)
+{
+   tree_nodeRef init_node;
+   const auto vd = GetPointer<const var_decl>(ar_node);
+   if(vd && vd->init)
    {
-      bitsize_align = elts_size;
+      init_node = vd->init;
    }
-   else
+   else if(GetPointer<const string_cst>(ar_node))
    {
-      elts_size = get_aligned_bitsize(elts_size, 8ULL);
+      init_node = ar_node;
    }
-
-   const auto nbyte_on_memory = bitsize_align / 8;
-
    if(init_node &&
       ((GetPointer<constructor>(init_node) && GetPointerS<constructor>(init_node)->list_of_idx_valu.size()) ||
        (GetPointer<string_cst>(init_node) && GetPointerS<string_cst>(init_node)->strg.size()) ||
        (!GetPointer<constructor>(init_node) && !GetPointer<string_cst>(init_node))))
    {
-      std::vector<std::string> init_string;
-      write_init(TM, ar_node, init_node, init_string, mem, element_align);
-      if(is_sds && (element_align == 0 || elts_size == element_align))
+      return init_node;
+   }
+   return nullptr;
+}
+
+void fu_binding::fill_array_ref_memory(std::ostream& init_file_a, std::ostream& init_file_b, unsigned int ar,
+                                       unsigned long long& vec_size, unsigned long long& elts_size, const memoryRef mem,
+                                       tree_managerConstRef TM, bool is_sds, unsigned long long bitsize_align)
+{
+   init_file_b.put(0);
+   const auto is_memory_splitted = init_file_b.good();
+   init_file_b.seekp(std::ios_base::beg);
+
+   if(!is_sds)
+   {
+      memory_image image;
+      fill_array_ref_memory(image, ar, vec_size, elts_size, mem, TM, bitsize_align);
+      image.write_binary(init_file_a, is_memory_splitted ? &init_file_b : nullptr, bitsize_align / 8);
+      return;
+   }
+   THROW_ASSERT(!is_memory_splitted, "unexpected condition");
+
+   const auto ar_node = TM->GetTreeNode(ar);
+   unsigned long long element_align;
+   const auto array_type_node = get_array_ref_layout(TM, ar_node, vec_size, elts_size, element_align);
+   const auto init_node = get_array_ref_init(ar_node);
+   if(!init_node)
+   {
+      for(unsigned int i = 0; i < vec_size; ++i)
       {
-         THROW_ASSERT(!is_memory_splitted, "unexpected condition");
-         for(const auto& init_value : init_string)
-         {
-            THROW_ASSERT(elts_size, "unexpected condition");
-            if(elts_size != init_value.size() && (init_value.size() % elts_size == 0))
-            {
-               const auto n_elmts = init_value.size() / elts_size;
-               for(auto index = 0u; index < n_elmts; ++index)
-               {
-                  init_file_a << init_value.substr(init_value.size() - elts_size - index * elts_size, elts_size)
-                              << std::endl;
-               }
-            }
-            else
-            {
-               init_file_a << init_value << std::endl;
-            }
-         }
+         init_file_a << std::string(elts_size, '0') << std::endl;
       }
-      else
+   }
+   else if(element_align == 0 || elts_size == element_align)
+   {
+      std::vector<std::string> init_string;
+      write_init(TM, ar_node, init_node, init_string, mem, element_align);
+      for(const auto& init_value : init_string)
       {
-         std::vector<std::string> eightbit_string;
-         std::string bits_offset = "";
-         for(unsigned int l = 0; l < init_string.size(); ++l)
-         {
-            if(init_string[l].size() < 8 && init_string.size() == 1)
-            {
-               std::string res = init_string[l];
-               while(res.size() < 8)
-               {
-                  res = "0" + res;
-               }
-               eightbit_string.push_back(res);
-            }
-            else
-            {
-               std::string local_binary_string;
-               size_t local_data_bitsize;
-               size_t data_bitsize = init_string[l].size();
-               if(bits_offset.size())
-               {
-                  if(static_cast<int>(data_bitsize) - 8 + static_cast<int>(bits_offset.size()) >= 0)
-                  {
-                     local_data_bitsize = data_bitsize - (8 - bits_offset.size());
-                     eightbit_string.push_back(
-                         init_string[l].substr(data_bitsize - (8 - bits_offset.size()), 8 - bits_offset.size()) +
-                         bits_offset);
-                     local_binary_string = init_string[l].substr(0, local_data_bitsize);
-                     bits_offset = "";
-                  }
-                  else
-                  {
-                     local_data_bitsize = 0;
-                     bits_offset = init_string[l] + bits_offset;
-                  }
-               }
-               else
-               {
-                  local_binary_string = init_string[l];
-                  local_data_bitsize = data_bitsize;
-               }
-               for(unsigned int base_index = 0; base_index < local_data_bitsize; base_index = base_index + 8)
-               {
-                  if((static_cast<int>(local_data_bitsize) - 8 - static_cast<int>(base_index)) >= 0)
-                  {
-                     eightbit_string.push_back(local_binary_string.substr(local_data_bitsize - 8 - base_index, 8));
-                  }
-                  else
-                  {
-                     bits_offset = local_binary_string.substr(0, local_data_bitsize - base_index);
-                  }
-               }
-            }
-         }
-         if(bits_offset.size())
-         {
-            std::string tail_padding;
-            for(auto tail_padding_ind = bits_offset.size(); tail_padding_ind < 8; ++tail_padding_ind)
-            {
-               tail_padding += "0";
-            }
-            tail_padding = tail_padding + bits_offset;
-            eightbit_string.push_back(tail_padding);
-         }
-         if(eightbit_string.size() % nbyte_on_memory != 0)
-         {
-            for(size_t l = eightbit_string.size() % nbyte_on_memory; l < nbyte_on_memory; ++l)
-            {
-               eightbit_string.push_back("00000000");
-            }
-         }
-         if((tree_helper::SizeAlloc(array_type_node) / 8U) > eightbit_string.size())
-         {
-            size_t tail_bytes = (tree_helper::SizeAlloc(array_type_node) / 8U) - eightbit_string.size();
-            for(size_t l = 0; l < tail_bytes; ++l)
-            {
-               eightbit_string.push_back("00000000");
-            }
-         }
-
-         std::string str_bit;
-         bool is_even = true;
-         unsigned int counter;
-         for(unsigned int l = 0; l < eightbit_string.size();)
+         THROW_ASSERT(elts_size, "unexpected condition");
+         if(elts_size != init_value.size() && (init_value.size() % elts_size == 0))
          {
-            str_bit = "";
-            for(counter = 0; counter < nbyte_on_memory && l < eightbit_string.size(); counter++, l++)
+            const auto n_elmts = init_value.size() / elts_size;
+            for(auto index = 0u; index < n_elmts; ++index)
             {
-               str_bit = eightbit_string[l] + str_bit;
+               init_file_a << init_value.substr(init_value.size() - elts_size - index * elts_size, elts_size)
+                           << std::endl;
             }
-            if(is_even || !is_memory_splitted)
-            {
-               init_file_a << str_bit << std::endl;
-            }
-            else
-            {
-               init_file_b << str_bit << std::endl;
-            }
-            is_even = !is_even;
          }
-         if(!is_even && is_memory_splitted)
+         else
          {
-            bool need_newline_b = false;
-            for(unsigned int l = 0; l < (nbyte_on_memory * 8); ++l)
-            {
-               init_file_b << "0";
-               need_newline_b = true;
-            }
-            if(need_newline_b)
-            {
-               init_file_b << std::endl;
-            }
+            init_file_a << init_value << std::endl;
          }
       }
    }
    else
    {
-      if(is_sds)
+      /// vector elements narrower than the memory word are packed together
+      memory_image image;
+      write_init(TM, ar_node, init_node, image, mem, element_align);
+      image.align(elts_size / 8);
+      image.extend(tree_helper::SizeAlloc(array_type_node) / 8);
+      image.write_binary(init_file_a, nullptr, elts_size / 8);
+   }
+}
+
+void fu_binding::fill_array_ref_memory(memory_image& image, unsigned int ar, unsigned long long& vec_size,
+                                       unsigned long long& elts_size, const memoryRef mem, tree_managerConstRef TM,
+                                       unsigned long long bitsize_align)
+{
+   const auto ar_node = TM->GetTreeNode(ar);
+   unsigned long long element_align;
+   const auto array_type_node = get_array_ref_layout(TM, ar_node, vec_size, elts_size, element_align);
+   elts_size = get_aligned_bitsize(elts_size, 8ULL);
+   const auto nbyte_on_memory = bitsize_align / 8;
+   const auto init_node = get_array_ref_init(ar_node);
+   if(init_node)
+   {
+      write_init(TM, ar_node, init_node, image, mem, element_align);
+      image.align(nbyte_on_memory);
+      image.extend(tree_helper::SizeAlloc(array_type_node) / 8);
+   }
+   else
+   {
+      image.append_zeros(vec_size * elts_size);
+      image.align(nbyte_on_memory);
+   }
+}
+
+namespace
+{
+   /// Collects an initializer as a sequence of binary strings, one for each scalar value
+   class init_string_sink
+   {
+    private:
+      std::vector<std::string>& init_file;
+
+    public:
+      explicit init_string_sink(std::vector<std::string>& _init_file) : init_file(_init_file)
       {
-         THROW_ASSERT(!is_memory_splitted, "unexpected condition");
-         for(unsigned int i = 0; i < vec_size; ++i)
-         {
-            for(unsigned int j = 0; j < elts_size; ++j)
-            {
-               init_file_a << "0";
-            }
-            init_file_a << std::endl;
-         }
       }
-      else
+
+      void push_value(const integer_cst_t& value, unsigned long long bitsize)
       {
-         unsigned int counter = 0;
-         bool is_even = true;
-         bool need_newline_a = false;
-         bool need_newline_b = false;
-         for(unsigned int i = 0; i < vec_size; ++i)
-         {
-            for(unsigned int j = 0; j < elts_size; ++j)
-            {
-               if(is_even || !is_memory_splitted)
-               {
-                  init_file_a << "0";
-                  need_newline_a = true;
-               }
-               else
-               {
-                  init_file_b << "0";
-                  need_newline_b = true;
-               }
-               counter++;
-               if(counter % (nbyte_on_memory * 8) == 0)
-               {
-                  if(is_even || !is_memory_splitted)
-                  {
-                     init_file_a << std::endl;
-                     need_newline_a = false;
-                  }
-                  else
-                  {
-                     init_file_b << std::endl;
-                     need_newline_b = false;
-                  }
-                  is_even = !is_even;
-               }
-            }
-         }
-         if(counter % (nbyte_on_memory * 8) != 0)
-         {
-            for(auto l = counter % (nbyte_on_memory * 8); l < (nbyte_on_memory * 8); ++l)
-            {
-               if(is_even || !is_memory_splitted)
-               {
-                  init_file_a << "0";
-                  need_newline_a = true;
-               }
-               else
-               {
-                  init_file_b << "0";
-                  need_newline_b = true;
-               }
-            }
-            is_even = !is_even;
-         }
-         if(!is_even && is_memory_splitted)
-         {
-            for(unsigned int l = 0; l < (nbyte_on_memory * 8); ++l)
-            {
-               init_file_b << "0";
-               need_newline_b = true;
-            }
-         }
-         if(need_newline_a)
-         {
-            init_file_a << std::endl;
-         }
-         if(need_newline_b)
+         std::string binary;
+         binary.reserve(bitsize);
+         for(auto ind = bitsize; ind > 0; --ind)
          {
-            init_file_b << std::endl;
+            binary.push_back(value.bit_tst(static_cast<APInt::bw_t>(ind - 1)) ? '1' : '0');
          }
+         init_file.push_back(binary);
       }
-   }
-}
 
-void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_node, tree_nodeRef _init_node,
-                            std::vector<std::string>& init_file, const memoryRef mem, unsigned long long element_align)
+      void push_binary(const std::string& binary)
+      {
+         init_file.push_back(binary);
+      }
+
+      void push_zeros(unsigned long long bitsize, unsigned long long count = 1)
+      {
+         init_file.insert(init_file.end(), count, std::string(bitsize, '0'));
+      }
+   };
+
+   /// Packs an initializer directly into a memory image
+   class init_image_sink
+   {
+    private:
+      memory_image& image;
+
+    public:
+      explicit init_image_sink(memory_image& _image) : image(_image)
+      {
+      }
+
+      void push_value(const integer_cst_t& value, unsigned long long bitsize)
+      {
+         image.append(value, bitsize);
+      }
+
+      void push_binary(const std::string& binary)
+      {
+         image.append_binary(binary);
+      }
+
+      void push_zeros(unsigned long long bitsize, unsigned long long count = 1)
+      {
+         image.append_zeros(bitsize * count);
+      }
+   };
+} // namespace
+
+template <class InitSink>
+static void write_init_value(const tree_managerConstRef TreeM, tree_nodeRef var_node, tree_nodeRef _init_node,
+                             InitSink& init_sink, const memoryRef mem, unsigned long long element_align)
 {
-   std::string trimmed_value;
    const auto init_node = _init_node;
    switch(init_node->get_kind())
    {
@@ -2777,33 +2705,25 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
       {
          auto precision = tree_helper::SizeAlloc(_init_node);
          const auto rc = GetPointerS<const real_cst>(init_node);
-         std::string C_value = rc->valr;
-         trimmed_value = convert_fp_to_string(C_value, precision);
-         init_file.push_back(trimmed_value);
+         init_sink.push_binary(convert_fp_to_string(rc->valr, precision));
          break;
       }
       case integer_cst_K:
       {
-         const auto ull_value = tree_helper::GetConstValue(init_node);
-         trimmed_value = "";
          auto precision = tree_helper::SizeAlloc(_init_node);
          if(element_align)
          {
             precision = std::min(precision, element_align);
          }
-         for(auto ind = 1U; ind <= precision; ind++)
-         {
-            trimmed_value.push_back(((integer_cst_t(1) << (precision - ind)) & ull_value) ? '1' : '0');
-         }
-         init_file.push_back(trimmed_value);
+         init_sink.push_value(tree_helper::GetConstValue(init_node), precision);
          break;
       }
       case complex_cst_K:
       {
          const auto precision = tree_helper::SizeAlloc(_init_node);
          const auto cc = GetPointerS<const complex_cst>(init_node);
-         write_init(TreeM, var_node, cc->real, init_file, mem, precision / 2);
-         write_init(TreeM, var_node, cc->imag, init_file, mem, precision / 2);
+         write_init_value(TreeM, var_node, cc->real, init_sink, mem, precision / 2);
+         write_init_value(TreeM, var_node, cc->imag, init_sink, mem, precision / 2);
          break;
       }
       case constructor_K:
@@ -2882,12 +2802,12 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
 
                if(iv_it != iv_end && iv_it->first->index == (*fli)->index)
                {
-                  write_init(TreeM, iv_it->first, iv_it->second, init_file, mem, element_align);
+                  write_init_value(TreeM, iv_it->first, iv_it->second, init_sink, mem, element_align);
                   ++iv_it;
                }
                else
                {
-                  write_init(TreeM, *fli, *fli, init_file, mem, element_align);
+                  write_init_value(TreeM, *fli, *fli, init_sink, mem, element_align);
                }
 
                if(is_bitfield)
@@ -2918,7 +2838,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
                   if(nbits)
                   {
                      /// add padding
-                     init_file.push_back(std::string(nbits, '0'));
+                     init_sink.push_zeros(nbits);
                   }
                }
             }
@@ -2945,7 +2865,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
                   // fix the element precision to pass to write_init
                   element_align = tree_helper::SizeAlloc(iv_it->first);
                }
-               write_init(TreeM, iv_it->first, iv_it->second, init_file, mem, element_align);
+               write_init_value(TreeM, iv_it->first, iv_it->second, init_sink, mem, element_align);
                if(is_struct && is_bitfield)
                {
                   // reset the element_align to the main value
@@ -2974,7 +2894,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
                   if(nbits)
                   {
                      /// add padding
-                     init_file.push_back(std::string(nbits, '0'));
+                     init_sink.push_zeros(nbits);
                   }
                }
                else if(is_union)
@@ -2987,7 +2907,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
                   if(nbits)
                   {
                      /// add padding
-                     init_file.push_back(std::string(nbits, '0'));
+                     init_sink.push_zeros(nbits);
                   }
                }
             }
@@ -3010,7 +2930,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
             }
             THROW_ASSERT(num_elements >= static_cast<unsigned long long>(co->list_of_idx_valu.size()), "");
             num_elements -= static_cast<unsigned long long>(co->list_of_idx_valu.size());
-            init_file.insert(init_file.end(), num_elements, std::string(size_of_data, '0'));
+            init_sink.push_zeros(size_of_data, num_elements);
          }
          break;
       }
@@ -3054,16 +2974,10 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
          }
          for(const auto j : string_value)
          {
-            auto ull_value = static_cast<unsigned long int>(j);
-            trimmed_value = "";
-            for(auto ind = 0U; ind < elmt_bitsize; ++ind)
-            {
-               trimmed_value = trimmed_value + (((1LLU << (elmt_bitsize - ind - 1)) & ull_value) ? '1' : '0');
-            }
-            init_file.push_back(trimmed_value);
+            init_sink.push_value(integer_cst_t(static_cast<unsigned char>(j)), elmt_bitsize);
          }
          // String terminator
-         init_file.push_back(std::string(elmt_bitsize, '0'));
+         init_sink.push_zeros(elmt_bitsize);
 
          const auto type_n = tree_helper::CGetType(var_node);
          THROW_ASSERT(GetPointer<const array_type>(type_n), "expected an array_type");
@@ -3080,7 +2994,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
                         STR(string_value.size() + 1) + "-" + STR(num_elements));
          }
          num_elements -= string_value.size() + 1;
-         init_file.insert(init_file.end(), num_elements, std::string(size_of_data, '0'));
+         init_sink.push_zeros(size_of_data, num_elements);
          break;
       }
       case view_convert_expr_K:
@@ -3089,12 +3003,12 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
          const auto ue = GetPointerS<unary_expr>(init_node);
          if(GetPointer<addr_expr>(ue->op))
          {
-            write_init(TreeM, ue->op, ue->op, init_file, mem, element_align);
+            write_init_value(TreeM, ue->op, ue->op, init_sink, mem, element_align);
          }
          else if(GetPointer<integer_cst>(ue->op))
          {
             const auto precision = std::max(std::max(8ull, element_align), tree_helper::SizeAlloc(init_node));
-            write_init(TreeM, ue->op, ue->op, init_file, mem, precision);
+            write_init_value(TreeM, ue->op, ue->op, init_sink, mem, precision);
          }
          else
          {
@@ -3300,11 +3214,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
                THROW_ERROR("addr_expr pattern not supported: " + std::string(addr_expr_op->get_kind_text()) + " @" +
                            STR(addr_expr_op_idx));
          }
-         for(unsigned int ind = 0; ind < precision; ind++)
-         {
-            trimmed_value = trimmed_value + (((1LLU << (precision - ind - 1)) & ull_value) ? '1' : '0');
-         }
-         init_file.push_back(trimmed_value);
+         init_sink.push_value(integer_cst_t(ull_value), precision);
 
          break;
       }
@@ -3313,7 +3223,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
          const auto field_decl_size = tree_helper::SizeAlloc(_init_node);
          if(field_decl_size)
          {
-            init_file.push_back(std::string(field_decl_size, '0'));
+            init_sink.push_zeros(field_decl_size);
          }
          break;
       }
@@ -3322,7 +3232,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
          const auto vc = GetPointerS<vector_cst>(init_node);
          for(const auto& i : vc->list_of_valu) // vector elements
          {
-            write_init(TreeM, i, i, init_file, mem, element_align);
+            write_init_value(TreeM, i, i, init_sink, mem, element_align);
          }
          break;
       }
@@ -3405,6 +3315,20 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
    }
 }
 
+void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_node, tree_nodeRef init_node,
+                            std::vector<std::string>& init_file, const memoryRef mem, unsigned long long element_align)
+{
+   init_string_sink init_sink(init_file);
+   write_init_value(TreeM, var_node, init_node, init_sink, mem, element_align);
+}
+
+void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_node, tree_nodeRef init_node,
+                            memory_image& image, const memoryRef mem, unsigned long long element_align)
+{
+   init_image_sink init_sink(image);
+   write_init_value(TreeM, var_node, init_node, init_sink, mem, element_align);
+}
+
 tree_nodeRef getFunctionType(tree_nodeRef exp)
 {
    THROW_ASSERT(GetPointer<addr_expr>(exp) || GetPointer<ssa_name>(exp), "Input must be a ssa_name or an addr_expr");
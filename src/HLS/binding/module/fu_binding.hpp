@@ -60,6 +60,7 @@
  */
 //@{
 class funit_obj;
+class memory_image;
 class module;
 REF_FORWARD_DECL(AllocationInformation);
 REF_FORWARD_DECL(fu_binding);
@@ -391,9 +392,32 @@ class fu_binding
                                      unsigned long long& vec_size, unsigned long long& elts_size, const memoryRef mem,
                                      tree_managerConstRef TM, bool is_sds, unsigned long long bitsize_align);
 
+   /**
+    * fill the little-endian memory image of the array ref
+    * @param image is the memory image where the data is appended
+    * @param ar is the array ref variable declaration
+    * @param vec_size is the number of the element of the array
+    * @param elts_size is the element size in bits
+    * @param mem is the memory reference
+    * @param TM is the tree manager reference
+    * @param bitsize_align is the memory alignment bitsize
+    */
+   static void fill_array_ref_memory(memory_image& image, unsigned int ar, unsigned long long& vec_size,
+                                     unsigned long long& elts_size, const memoryRef mem, tree_managerConstRef TM,
+                                     unsigned long long bitsize_align);
+
+   /**
+    * Write the initializer of a variable as a sequence of binary strings, one for each scalar value
+    */
    static void write_init(const tree_managerConstRef TreeM, tree_nodeRef var_node, tree_nodeRef init_node,
                           std::vector<std::string>& init_file, const memoryRef mem,
                           unsigned long long element_precision);
+
+   /**
+    * Append the initializer of a variable to a memory image
+    */
+   static void write_init(const tree_managerConstRef TreeM, tree_nodeRef var_node, tree_nodeRef init_node,
+                          memory_image& image, const memoryRef mem, unsigned long long element_precision);
 };
 
 /**
@@ -49,10 +49,8 @@
 #include "Parameter.hpp"
 #include "dbgPrintHelper.hpp"
 
-#if BOOST_VERSION >= 106400
-#include <boost/serialization/array_wrapper.hpp>
-#endif
-#include <boost/numeric/ublas/matrix.hpp>
+#include <algorithm>
+#include <vector>
 
 /// HLS/binding/storage_value_insertion includes
 #include "storage_value_information.hpp"
@@ -75,49 +73,62 @@ void compatibility_based_register::create_compatibility_graph()
    THROW_ASSERT(HLS->Rliv, "Liveness analysis not yet computed");
    const auto CG_num_vertices = HLS->storage_value_information->get_number_of_storage_values();
    CG = new compatibility_graph(CG_num_vertices);
-   boost::numeric::ublas::matrix<bool> conflict_map(CG_num_vertices, CG_num_vertices);
-
-   boost::numeric::ublas::noalias(conflict_map) =
-       boost::numeric::ublas::zero_matrix<bool>(CG_num_vertices, CG_num_vertices);
+   /// packed conflict matrix: row i has a bit set for each storage value live together with storage value i
+   const auto row_words = (static_cast<size_t>(CG_num_vertices) + 63) / 64;
+   std::vector<unsigned long long> conflict_map(static_cast<size_t>(CG_num_vertices) * row_words, 0ULL);
    for(auto vi = 0U; vi < CG_num_vertices; ++vi)
    {
       verts.push_back(boost::vertex(vi, *CG));
    }
 
    /// compatibility graph creation
+   std::vector<unsigned long long> live_row(row_words, 0ULL);
+   std::vector<unsigned int> live_values;
    const auto& support = HLS->Rliv->get_support();
    for(const auto v : support)
    {
       const auto& live = HLS->Rliv->get_live_in(v);
       register_lower_bound = std::max(static_cast<unsigned int>(live.size()), register_lower_bound);
-      const auto k_end = live.cend();
-      for(auto k = live.cbegin(); k != k_end; ++k)
+      if(live.size() < 2)
+      {
+         continue;
+      }
+      live_values.clear();
+      for(const auto k : live)
       {
-         auto k_inner = k;
-         ++k_inner;
-         while(k_inner != k_end)
+         const auto sv = HLS->storage_value_information->get_storage_value_index(v, k);
+         THROW_ASSERT(sv < CG_num_vertices, "wrong compatibility graph index");
+         live_values.push_back(sv);
+         live_row[sv / 64] |= 1ULL << (sv % 64);
+      }
+      const auto minmax = std::minmax_element(live_values.begin(), live_values.end());
+      const auto first_word = *minmax.first / 64;
+      const auto last_word = *minmax.second / 64;
+      /// the live set is or-ed into the row of each live storage value one word at a time
+      for(const auto sv : live_values)
+      {
+         const auto row = conflict_map.data() + static_cast<size_t>(sv) * row_words;
+         for(auto word = first_word; word <= last_word; ++word)
          {
-            const auto tail = HLS->storage_value_information->get_storage_value_index(v, *k);
-            THROW_ASSERT(tail < CG_num_vertices, "wrong compatibility graph index");
-            const auto head = HLS->storage_value_information->get_storage_value_index(v, *k_inner);
-            THROW_ASSERT(head < CG_num_vertices, "wrong compatibility graph index");
-            if(tail < head)
-            {
-               conflict_map(tail, head) = true;
-            }
-            else if(tail > head)
-            {
-               conflict_map(head, tail) = true;
-            }
-            ++k_inner;
+            row[word] |= live_row[word];
          }
       }
+      for(const auto sv : live_values)
+      {
+         live_row[sv / 64] = 0ULL;
+      }
+   }
+   std::vector<unsigned long long> bitsize_class(CG_num_vertices);
+   for(auto vi = 0U; vi < CG_num_vertices; ++vi)
+   {
+      bitsize_class[vi] = HLS->storage_value_information->get_value_bitsize_class(vi);
    }
    for(auto vj = 1U; vj < CG_num_vertices; ++vj)
    {
+      const auto row = conflict_map.data() + static_cast<size_t>(vj) * row_words;
       for(auto vi = 0U; vi < vj; ++vi)
       {
-         if(!conflict_map(vi, vj) && HLS->storage_value_information->are_value_bitsize_compatible(vi, vj))
+         if(!((row[vi / 64] >> (vi % 64)) & 1ULL) && bitsize_class[vi] == bitsize_class[vj])
          {
             boost::graph_traits<compatibility_graph>::edge_descriptor e1;
             const auto edge_weight = HLS->storage_value_information->get_compatibility_weight(vi, vj);
@@ -0,0 +1,188 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file linear_scan_register.cpp
+ * @brief Class implementation of the register allocation algorithm based on linear scan of the live ranges
+ *
+ */
+#include "linear_scan_register.hpp"
+
+#include "Parameter.hpp"
+#include "behavioral_helper.hpp"
+#include "cpu_time.hpp"
+#include "custom_map.hpp"
+#include "dbgPrintHelper.hpp"
+#include "hls.hpp"
+#include "hls_manager.hpp"
+#include "liveness.hpp"
+#include "reg_binding.hpp"
+#include "storage_value_information.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+linear_scan_register::linear_scan_register(const ParameterConstRef _Param, const HLS_managerRef _HLSMgr,
+                                           unsigned int _funId, const DesignFlowManagerConstRef _design_flow_manager)
+    : reg_binding_creator(_Param, _HLSMgr, _funId, _design_flow_manager,
+                          HLSFlowStep_Type::LINEAR_SCAN_REGISTER_BINDING)
+{
+}
+
+linear_scan_register::~linear_scan_register() = default;
+
+DesignFlowStep_Status linear_scan_register::RegisterBinding()
+{
+   long step_time = 0;
+   if(output_level >= OUTPUT_LEVEL_MINIMUM && output_level <= OUTPUT_LEVEL_PEDANTIC)
+   {
+      START_TIME(step_time);
+   }
+   THROW_ASSERT(HLS->Rliv, "Liveness analysis not yet computed");
+   const auto num_values = HLS->storage_value_information->get_number_of_storage_values();
+   const auto& support = HLS->Rliv->get_support();
+
+   /// storage values live in each state and states in which each storage value is live
+   std::vector<std::vector<unsigned int>> state_values;
+   std::vector<std::vector<unsigned int>> value_states(num_values);
+   state_values.reserve(support.size());
+   for(const auto v : support)
+   {
+      const auto& live = HLS->Rliv->get_live_in(v);
+      register_lower_bound = std::max(static_cast<unsigned int>(live.size()), register_lower_bound);
+      const auto state_index = static_cast<unsigned int>(state_values.size());
+      state_values.emplace_back();
+      for(const auto k : live)
+      {
+         const auto sv = HLS->storage_value_information->get_storage_value_index(v, k);
+         THROW_ASSERT(sv < num_values, "wrong storage value index");
+         state_values.back().push_back(sv);
+         if(value_states[sv].empty() || value_states[sv].back() != state_index)
+         {
+            value_states[sv].push_back(state_index);
+         }
+      }
+   }
+
+   /// storage values are scanned by start of their live range
+   std::vector<unsigned int> scan_order;
+   scan_order.reserve(num_values);
+   for(auto sv = 0U; sv < num_values; ++sv)
+   {
+      if(!value_states[sv].empty())
+      {
+         scan_order.push_back(sv);
+      }
+   }
+   std::stable_sort(scan_order.begin(), scan_order.end(), [&](unsigned int sv1, unsigned int sv2) {
+      return value_states[sv1].front() < value_states[sv2].front();
+   });
+
+   const auto NO_REGISTER = std::numeric_limits<unsigned int>::max();
+   std::vector<unsigned int> value_register(num_values, NO_REGISTER);
+   /// registers allocated for each bitsize class, in increasing order
+   CustomUnorderedMap<unsigned long long, std::vector<unsigned int>> class_registers;
+   /// registers holding storage values in conflict with the current one are marked with its index
+   std::vector<unsigned int> register_mark;
+   for(const auto sv : scan_order)
+   {
+      for(const auto state_index : value_states[sv])
+      {
+         for(const auto other : state_values[state_index])
+         {
+            if(value_register[other] != NO_REGISTER)
+            {
+               register_mark[value_register[other]] = sv;
+            }
+         }
+      }
+      auto& candidates = class_registers[HLS->storage_value_information->get_value_bitsize_class(sv)];
+      const auto free_register = std::find_if(candidates.begin(), candidates.end(),
+                                              [&](unsigned int reg) { return register_mark[reg] != sv; });
+      if(free_register != candidates.end())
+      {
+         value_register[sv] = *free_register;
+      }
+      else
+      {
+         value_register[sv] = static_cast<unsigned int>(register_mark.size());
+         register_mark.push_back(NO_REGISTER);
+         candidates.push_back(value_register[sv]);
+      }
+   }
+   const auto num_registers = static_cast<unsigned int>(register_mark.size());
+
+   /// finalize
+   HLS->Rreg = reg_binding::create_reg_binding(HLS, HLSMgr);
+   for(const auto v : support)
+   {
+      for(const auto k : HLS->Rliv->get_live_in(v))
+      {
+         const auto sv = HLS->storage_value_information->get_storage_value_index(v, k);
+         HLS->Rreg->bind(sv, value_register[sv]);
+      }
+   }
+   HLS->Rreg->set_used_regs(num_registers);
+   if(output_level >= OUTPUT_LEVEL_MINIMUM && output_level <= OUTPUT_LEVEL_PEDANTIC)
+   {
+      STOP_TIME(step_time);
+   }
+   if(output_level <= OUTPUT_LEVEL_PEDANTIC)
+   {
+      INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "");
+   }
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level,
+                  "-->Register binding information for function " +
+                      HLSMgr->CGetFunctionBehavior(funId)->CGetBehavioralHelper()->get_function_name() + ":");
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level,
+                  std::string("---Register allocation algorithm obtains ") +
+                      (num_registers == register_lower_bound ? "an optimal" : "a sub-optimal") +
+                      " result: " + STR(num_registers) + " registers" +
+                      (num_registers == register_lower_bound ? "" : ("(LB:" + STR(register_lower_bound) + ")")));
+   if(output_level >= OUTPUT_LEVEL_VERY_PEDANTIC)
+   {
+      HLS->Rreg->print();
+   }
+   if(output_level >= OUTPUT_LEVEL_MINIMUM && output_level <= OUTPUT_LEVEL_PEDANTIC)
+   {
+      INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level,
+                     "Time to perform register binding: " + print_cpu_time(step_time) + " seconds");
+   }
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "<--");
+   if(output_level <= OUTPUT_LEVEL_PEDANTIC)
+   {
+      INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "");
+   }
+   return DesignFlowStep_Status::SUCCESS;
+}
@@ -0,0 +1,72 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file linear_scan_register.hpp
+ * @brief Class specification of the register allocation algorithm based on linear scan of the live ranges
+ *
+ */
+#ifndef LINEAR_SCAN_REGISTER_HPP
+#define LINEAR_SCAN_REGISTER_HPP
+
+#include "reg_binding_creator.hpp"
+
+/**
+ * Class containing the linear scan register allocation algorithm.
+ * Storage values are colored in order of first appearance along the states of the liveness support, i.e., left edge
+ * on the live ranges: the result is optimal when the conflict graph is an interval graph, as in straight-line SSA code.
+ * Neither the conflict graph nor the compatibility graph are built.
+ */
+class linear_scan_register : public reg_binding_creator
+{
+ private:
+   /**
+    * Linear scan register allocation algorithm.
+    * @return the exit status of this step
+    */
+   DesignFlowStep_Status RegisterBinding() final;
+
+ public:
+   /**
+    * Constructor of the class.
+    * @param design_flow_manager is the design flow manager
+    */
+   linear_scan_register(const ParameterConstRef Param, const HLS_managerRef HLSMgr, unsigned int funId,
+                        const DesignFlowManagerConstRef design_flow_manager);
+
+   /**
+    * Destructor of the class.
+    */
+   ~linear_scan_register() override;
+};
+
+#endif
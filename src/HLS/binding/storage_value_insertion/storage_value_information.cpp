@@ -361,20 +361,17 @@ int StorageValueInformation::get_compatibility_weight(unsigned int storage_value
    return 1;
 }
 
+unsigned long long StorageValueInformation::get_value_bitsize_class(unsigned int storage_value_index) const
+{
+   const auto var = HLS_mgr->get_tree_manager()->GetTreeNode(get_variable_index(storage_value_index));
+   const auto isInt = tree_helper::IsSignedIntegerType(var);
+   const auto isReal = tree_helper::IsRealType(var);
+   const auto size = tree_helper::Size(var);
+   return ((isInt || isReal ? size : ceil_pow2(size)) << 2) | (isInt ? 2ULL : 0ULL) | (isReal ? 1ULL : 0ULL);
+}
+
 bool StorageValueInformation::are_value_bitsize_compatible(unsigned int storage_value_index1,
                                                            unsigned int storage_value_index2) const
 {
-   const auto var1_nid = get_variable_index(storage_value_index1);
-   const auto var2_nid = get_variable_index(storage_value_index2);
-   const auto TM = HLS_mgr->get_tree_manager();
-   const auto var1 = TM->GetTreeNode(var1_nid);
-   const auto var2 = TM->GetTreeNode(var2_nid);
-   const auto isInt1 = tree_helper::IsSignedIntegerType(var1);
-   const auto isInt2 = tree_helper::IsSignedIntegerType(var2);
-   const auto isReal1 = tree_helper::IsRealType(var1);
-   const auto isReal2 = tree_helper::IsRealType(var2);
-   const auto size1 = tree_helper::Size(var1);
-   const auto size2 = tree_helper::Size(var2);
-   return isInt1 == isInt2 && isReal1 == isReal2 &&
-          (((isInt1 && isInt2) || (isReal1 && isReal2)) ? size1 == size2 : ceil_pow2(size1) == ceil_pow2(size2));
+   return get_value_bitsize_class(storage_value_index1) == get_value_bitsize_class(storage_value_index2);
 }
@@ -138,6 +138,13 @@ class StorageValueInformation
     * @param storage_value_index2 is the second storage value
     */
    bool are_value_bitsize_compatible(unsigned int storage_value_index1, unsigned int storage_value_index2) const;
+
+   /**
+    * return the bitsize class of a storage value: two storage values are bitsize compatible if and only if they
+    * belong to the same class
+    * @param storage_value_index is the storage value
+    */
+   unsigned long long get_value_bitsize_class(unsigned int storage_value_index) const;
 };
 using StorageValueInformationRef = refcount<StorageValueInformation>;
 #endif
@@ -0,0 +1,388 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2017-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file estimate_evaluation.cpp
+ * @brief Class to evaluate the synthesized design from the HLS results only
+ *
+ */
+
+/// Header include
+#include "estimate_evaluation.hpp"
+
+#include "config_HAVE_HOST_PROFILING_BUILT.hpp"
+
+#include "Parameter.hpp"
+#include "allocation_information.hpp"
+#include "area_info.hpp"
+#include "basic_block.hpp"
+#include "behavioral_helper.hpp"
+#include "call_graph_manager.hpp"
+#include "conn_binding.hpp"
+#include "cpu_time.hpp"
+#include "custom_set.hpp"
+#include "dbgPrintHelper.hpp"
+#include "fu_binding.hpp"
+#include "function_behavior.hpp"
+#include "hls.hpp"
+#include "hls_constraints.hpp"
+#include "hls_device.hpp"
+#include "hls_manager.hpp"
+#include "op_graph.hpp"
+#include "reg_binding.hpp"
+#include "schedule.hpp"
+#include "state_transition_graph.hpp"
+#include "state_transition_graph_manager.hpp"
+#include "string_manipulation.hpp"
+#include "structural_manager.hpp"
+#include "structural_objects.hpp"
+#include "technology_manager.hpp"
+#include "technology_node.hpp"
+#if HAVE_HOST_PROFILING_BUILT
+#include "host_profiling.hpp"
+#include "profiling_information.hpp"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+EstimateEvaluation::EstimateEvaluation(const ParameterConstRef _parameters, const HLS_managerRef _HLSMgr,
+                                       const DesignFlowManagerConstRef _design_flow_manager)
+    : EvaluationBaseStep(_parameters, _HLSMgr, _design_flow_manager, HLSFlowStep_Type::ESTIMATE_EVALUATION)
+{
+   debug_level = parameters->get_class_debug_level(GET_CLASS(*this));
+}
+
+EstimateEvaluation::~EstimateEvaluation() = default;
+
+HLS_step::HLSRelationships
+EstimateEvaluation::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const
+{
+   HLSRelationships ret;
+   switch(relationship_type)
+   {
+      case DEPENDENCE_RELATIONSHIP:
+      {
+         ret.insert(std::make_tuple(HLSFlowStep_Type::GENERATE_HDL, HLSFlowStepSpecializationConstRef(),
+                                    HLSFlowStep_Relationship::TOP_FUNCTION));
+         break;
+      }
+      case INVALIDATION_RELATIONSHIP:
+      case PRECEDENCE_RELATIONSHIP:
+      {
+         break;
+      }
+      default:
+         THROW_UNREACHABLE("");
+   }
+   return ret;
+}
+
+double EstimateEvaluation::EstimateFunctionArea(unsigned int funId,
+                                                const std::map<std::string, unsigned int>& module_to_function,
+                                                std::map<unsigned int, unsigned int>& instantiated_functions) const
+{
+   const auto HLS = HLSMgr->get_HLS(funId);
+   const auto& allocation_information = HLS->allocation_information;
+
+   /// functional units: the modules implementing called functions carry a fake area, so they are only counted
+   double fu_area = 0.0;
+   for(const auto fu_type : HLS->Rfu->get_allocation_list())
+   {
+      if(allocation_information->is_proxy_unit(fu_type))
+      {
+         continue;
+      }
+      const auto n_instances = HLS->Rfu->get_number(fu_type);
+      const auto called_function = module_to_function.find(allocation_information->get_fu_name(fu_type).first);
+      if(called_function != module_to_function.end())
+      {
+         instantiated_functions[called_function->second] += n_instances;
+         continue;
+      }
+      fu_area += allocation_information->get_area(fu_type) * static_cast<double>(n_instances);
+   }
+
+   double reg_area = 0.0;
+   if(HLS->Rreg)
+   {
+      const auto TechM = HLS->HLS_D->get_technology_manager();
+      for(auto r = 0U; r < HLS->Rreg->get_used_regs(); ++r)
+      {
+         const auto reg_fu = GetPointer<const functional_unit>(TechM->get_fu(HLS->Rreg->GetRegisterFUName(r)));
+         if(reg_fu && reg_fu->area_m)
+         {
+            reg_area += reg_fu->area_m->get_area_value();
+         }
+      }
+   }
+
+   /// one multiplexer for each target port reached by more than one source
+   double mux_area = 0.0;
+   if(HLS->Rconn)
+   {
+      for(const auto& data_transfer : HLS->Rconn->get_data_transfers())
+      {
+         const auto mux_ins = static_cast<unsigned int>(data_transfer.second.size());
+         if(mux_ins < 2)
+         {
+            continue;
+         }
+         auto mux_prec = 1ull;
+         for(const auto& source : data_transfer.second)
+         {
+            for(const auto& transfer : source.second)
+            {
+               mux_prec = std::max(mux_prec, static_cast<unsigned long long>(std::get<1>(transfer)));
+            }
+         }
+         const auto area = allocation_information->estimate_muxNto1_area(mux_prec, mux_ins);
+         /// multiplexers larger than the characterized ones are built as a chain of 2-to-1 multiplexers
+         mux_area += area != std::numeric_limits<double>::max() ?
+                         area :
+                         static_cast<double>(mux_ins - 1) * allocation_information->estimate_muxNto1_area(mux_prec, 2);
+      }
+   }
+   INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level,
+                  "---" + HLSMgr->CGetFunctionBehavior(funId)->CGetBehavioralHelper()->get_function_name() +
+                      ": functional units " + STR(fu_area) + ", registers " + STR(reg_area) + ", multiplexers " +
+                      STR(mux_area));
+   return fu_area + reg_area + mux_area;
+}
+
+double EstimateEvaluation::EstimateCriticalPath(unsigned int funId) const
+{
+   const auto HLS = HLSMgr->get_HLS(funId);
+   const auto clock_period = HLS->HLS_C->get_clock_period() * HLS->HLS_C->get_clock_period_resource_fraction();
+   const auto op_graph = HLSMgr->CGetFunctionBehavior(funId)->CGetOpGraph(FunctionBehavior::FCFG);
+   const auto stg = HLS->STG->CGetStg();
+   double critical_path = 0.0;
+   VertexIterator state, state_end;
+   for(boost::tie(state, state_end) = boost::vertices(*stg); state != state_end; ++state)
+   {
+      for(const auto op : stg->CGetStateInfo(*state)->ending_operations)
+      {
+         const auto op_index = op_graph->CGetOpNodeInfo(op)->GetNodeId();
+         if(op_index == ENTRY_ID || op_index == EXIT_ID)
+         {
+            continue;
+         }
+         const auto ending_time = HLS->Rsch->GetEndingTime(op_index);
+         if(ending_time <= HLS->Rsch->GetStartingTime(op_index))
+         {
+            continue;
+         }
+         /// the chain ending with this operation started at the last clock edge strictly before its ending time
+         const auto cycle_start = (std::ceil(ending_time / clock_period) - 1.0) * clock_period;
+         critical_path = std::max(critical_path, ending_time - cycle_start);
+      }
+   }
+   return critical_path > 0.0 ? critical_path + HLS->allocation_information->get_setup_hold_time() : 0.0;
+}
+
+unsigned long long EstimateEvaluation::EstimateFunctionCycles(unsigned int funId, bool profiled) const
+{
+   const auto HLS = HLSMgr->get_HLS(funId);
+   const auto stg = HLS->STG->CGetStg();
+#if HAVE_HOST_PROFILING_BUILT
+   const auto FB = HLSMgr->CGetFunctionBehavior(funId);
+   const auto& bb_index_map = FB->CGetBBGraph(FunctionBehavior::BB)->CGetBBGraphInfo()->bb_index_map;
+#endif
+   auto cycles = 0ull;
+   VertexIterator state, state_end;
+   for(boost::tie(state, state_end) = boost::vertices(*stg); state != state_end; ++state)
+   {
+      if(*state == HLS->STG->get_entry_state() || *state == HLS->STG->get_exit_state())
+      {
+         continue;
+      }
+      auto executions = profiled ? 0ull : 1ull;
+#if HAVE_HOST_PROFILING_BUILT
+      if(profiled)
+      {
+         /// a state covering several basic blocks is entered as many times as the most executed of them
+         for(const auto bb_id : stg->CGetStateInfo(*state)->BB_ids)
+         {
+            const auto bb = bb_index_map.find(bb_id);
+            if(bb != bb_index_map.end())
+            {
+               executions = std::max(executions, FB->CGetProfilingInformation()->GetBBExecutions(bb->second));
+            }
+         }
+      }
+#endif
+      cycles += executions;
+   }
+   return cycles;
+}
+
+DesignFlowStep_Status EstimateEvaluation::Exec()
+{
+   long int step_time = 0;
+   if(output_level >= OUTPUT_LEVEL_MINIMUM && output_level <= OUTPUT_LEVEL_PEDANTIC)
+   {
+      START_TIME(step_time);
+   }
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "-->Estimated evaluation:");
+   const auto CGM = HLSMgr->CGetCallGraphManager();
+   const auto& top_functions = CGM->GetRootFunctions();
+   CustomOrderedSet<unsigned int> functions;
+   for(const auto top_id : top_functions)
+   {
+      functions.insert(top_id);
+      const auto reached_functions = CGM->GetReachedFunctionsFrom(top_id);
+      functions.insert(reached_functions.begin(), reached_functions.end());
+   }
+   std::map<std::string, unsigned int> module_to_function;
+   for(const auto f_id : functions)
+   {
+      const auto HLS = HLSMgr->get_HLS(f_id);
+      if(HLS && HLS->top && HLS->top->get_circ())
+      {
+         module_to_function[HLS->top->get_circ()->get_typeRef()->id_type] = f_id;
+      }
+   }
+
+   std::map<unsigned int, double> function_area;
+   std::map<unsigned int, std::map<unsigned int, unsigned int>> instantiated_functions;
+   for(const auto f_id : functions)
+   {
+      const auto HLS = HLSMgr->get_HLS(f_id);
+      if(HLS && HLS->Rfu && HLS->allocation_information)
+      {
+         function_area[f_id] = EstimateFunctionArea(f_id, module_to_function, instantiated_functions[f_id]);
+      }
+   }
+
+   /// a called function costs area and registers once for each module instance in the hierarchy
+   std::map<unsigned int, unsigned long long> function_instances;
+   const std::function<void(unsigned int, unsigned long long)> add_instances = [&](unsigned int f_id,
+                                                                                   unsigned long long n_instances) {
+      function_instances[f_id] += n_instances;
+      const auto called_functions = instantiated_functions.find(f_id);
+      if(called_functions != instantiated_functions.end())
+      {
+         for(const auto& called_function : called_functions->second)
+         {
+            add_instances(called_function.first, n_instances * called_function.second);
+         }
+      }
+   };
+   for(const auto top_id : top_functions)
+   {
+      add_instances(top_id, 1);
+   }
+
+#if HAVE_HOST_PROFILING_BUILT
+   const auto profiled =
+       parameters->getOption<HostProfiling_Method>(OPT_profiling_method) != HostProfiling_Method::PM_NONE;
+#else
+   const auto profiled = false;
+#endif
+   double area = 0.0;
+   auto flip_flops = 0ull;
+   double critical_path = 0.0;
+   auto total_cycles = 0ull;
+   for(const auto& f_instances : function_instances)
+   {
+      const auto HLS = HLSMgr->get_HLS(f_instances.first);
+      if(!HLS)
+      {
+         continue;
+      }
+      const auto n_instances = f_instances.second;
+      if(function_area.count(f_instances.first))
+      {
+         area += function_area.at(f_instances.first) * static_cast<double>(n_instances);
+      }
+      if(HLS->Rreg)
+      {
+         for(auto r = 0U; r < HLS->Rreg->get_used_regs(); ++r)
+         {
+            flip_flops += HLS->Rreg->get_bitsize(r) * n_instances;
+         }
+      }
+      if(HLS->STG && HLS->Rsch)
+      {
+         critical_path = std::max(critical_path, EstimateCriticalPath(f_instances.first));
+         /// basic block executions already account for every call, so cycles are not scaled by the instances
+         total_cycles += EstimateFunctionCycles(f_instances.first, profiled);
+      }
+   }
+
+   auto num_executions = 0ull;
+#if HAVE_HOST_PROFILING_BUILT
+   if(profiled)
+   {
+      for(const auto top_id : top_functions)
+      {
+         const auto FB = HLSMgr->CGetFunctionBehavior(top_id);
+         const auto bb_graph = FB->CGetBBGraph(FunctionBehavior::BB);
+         OutEdgeIterator oe, oe_end;
+         for(boost::tie(oe, oe_end) = boost::out_edges(bb_graph->CGetBBGraphInfo()->entry_vertex, *bb_graph);
+             oe != oe_end; ++oe)
+         {
+            num_executions += FB->CGetProfilingInformation()->GetBBExecutions(boost::target(*oe, *bb_graph));
+         }
+      }
+   }
+#endif
+   if(!profiled)
+   {
+      INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level,
+                     "---No host profiling information: every basic block is assumed to be executed once");
+   }
+   num_executions = std::max(num_executions, 1ull);
+
+   const auto clock_period = parameters->getOption<double>(OPT_clock_period);
+   const auto period = critical_path > 0.0 ? critical_path : clock_period;
+   HLSMgr->evaluations["AREA"] = area;
+   HLSMgr->evaluations["REGISTERS"] = static_cast<double>(flip_flops);
+   HLSMgr->evaluations["PERIOD"] = period;
+   HLSMgr->evaluations["CLOCK_SLACK"] = clock_period - period;
+   HLSMgr->evaluations["FREQUENCY"] = 1000.0 / period;
+   HLSMgr->evaluations["TOTAL_CYCLES"] = static_cast<double>(total_cycles);
+   HLSMgr->evaluations["NUM_EXECUTIONS"] = static_cast<double>(num_executions);
+   HLSMgr->evaluations["CYCLES"] = static_cast<double>(total_cycles / num_executions);
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "---Estimated area           : " + STR(area));
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "---Estimated critical path  : " + STR(critical_path));
+   if(output_level >= OUTPUT_LEVEL_MINIMUM && output_level <= OUTPUT_LEVEL_PEDANTIC)
+   {
+      STOP_TIME(step_time);
+      INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level,
+                     "---Time to perform estimation: " + print_cpu_time(step_time) + " seconds");
+   }
+   INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "<--");
+   return DesignFlowStep_Status::SUCCESS;
+}
@@ -0,0 +1,107 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2017-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file estimate_evaluation.hpp
+ * @brief Class to evaluate the synthesized design from the HLS results only
+ *
+ * Area, clock period and cycle count are estimated from allocation, binding, scheduling and state transition graph
+ * information without running any RTL synthesis or simulation, so that design space exploration can rank candidate
+ * configurations quickly.
+ *
+ */
+
+#ifndef ESTIMATE_EVALUATION_HPP
+#define ESTIMATE_EVALUATION_HPP
+
+/// base class include
+#include "evaluation_base_step.hpp"
+
+#include <map>
+#include <string>
+
+class EstimateEvaluation : public EvaluationBaseStep
+{
+ private:
+   /**
+    * Return the set of analyses in relationship with this design step
+    * @param relationship_type is the type of relationship to be considered
+    */
+   HLSRelationships ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
+
+   /**
+    * Estimate the area of the module implementing a function, excluding the modules of the called functions
+    * @param funId is the function
+    * @param module_to_function maps the name of the module implementing a function to the function itself
+    * @param instantiated_functions is filled with the number of instances of each called function module
+    * @return the estimated area of functional units, registers and multiplexers of the function
+    */
+   double EstimateFunctionArea(unsigned int funId, const std::map<std::string, unsigned int>& module_to_function,
+                               std::map<unsigned int, unsigned int>& instantiated_functions) const;
+
+   /**
+    * Estimate the longest combinational path inside a clock cycle of a function
+    * @param funId is the function
+    * @return the estimated critical path (0 if nothing is chained)
+    */
+   double EstimateCriticalPath(unsigned int funId) const;
+
+   /**
+    * Estimate the number of cycles spent in the states of a function
+    * @param funId is the function
+    * @param profiled tells if basic block executions from host profiling have to be used
+    * @return the estimated number of cycles
+    */
+   unsigned long long EstimateFunctionCycles(unsigned int funId, bool profiled) const;
+
+ public:
+   /**
+    * Constructor
+    * @param _parameters is the set of input parameters
+    * @param HLSMgr is the HLS manager
+    * @param design_flow_manager is the design flow manager
+    */
+   EstimateEvaluation(const ParameterConstRef _parameters, const HLS_managerRef HLSMgr,
+                      const DesignFlowManagerConstRef design_flow_manager);
+
+   /**
+    * Destructor
+    */
+   ~EstimateEvaluation() override;
+
+   /**
+    * Execute the step
+    * @return the exit status of this step
+    */
+   DesignFlowStep_Status Exec() override;
+};
+#endif
@@ -90,6 +90,12 @@ Evaluation::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relat
                                           HLSFlowStep_Relationship::WHOLE_APPLICATION));
                break;
             }
+            case Evaluation_Mode::ESTIMATE:
+            {
+               ret.insert(std::make_tuple(HLSFlowStep_Type::ESTIMATE_EVALUATION, HLSFlowStepSpecializationConstRef(),
+                                          HLSFlowStep_Relationship::WHOLE_APPLICATION));
+               break;
+            }
             case Evaluation_Mode::EXACT:
             {
                for(const auto& objective : objective_vector)
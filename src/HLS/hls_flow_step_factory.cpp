@@ -67,6 +67,7 @@
 #include "dominator_allocation.hpp"
 #include "dry_run_evaluation.hpp"
 #include "easy_module_binding.hpp"
+#include "estimate_evaluation.hpp"
 #include "evaluation.hpp"
 #include "fsm_controller.hpp"
 #include "fun_dominator_allocation.hpp"
@@ -76,6 +77,8 @@
 #include "hls_function_bit_value.hpp"
 #include "hls_synthesis_flow.hpp"
 #include "initialize_hls.hpp"
+#include "linear_scan_register.hpp"
+#include "loop_initiation_interval.hpp"
 #include "mem_dominator_allocation.hpp"
 #include "mem_dominator_allocation_cs.hpp"
 #include "memory.hpp"
@@ -266,12 +269,29 @@ HLSFlowStepFactory::CreateHLSFlowStep(const HLSFlowStep_Type type, const unsigne
              DesignFlowStepRef(new easy_module_binding(parameters, HLS_mgr, funId, design_flow_manager.lock()));
          break;
       }
+      case HLSFlowStep_Type::LINEAR_SCAN_REGISTER_BINDING:
+      {
+         design_flow_step =
+             DesignFlowStepRef(new linear_scan_register(parameters, HLS_mgr, funId, design_flow_manager.lock()));
+         break;
+      }
       case HLSFlowStep_Type::LIST_BASED_SCHEDULING:
       {
          design_flow_step = DesignFlowStepRef(new parametric_list_based(
              parameters, HLS_mgr, funId, design_flow_manager.lock(), hls_flow_step_specialization));
          break;
       }
+      case HLSFlowStep_Type::LOOP_INITIATION_INTERVAL:
+      {
+         design_flow_step =
+             DesignFlowStepRef(new LoopInitiationInterval(parameters, HLS_mgr, funId, design_flow_manager.lock()));
+         break;
+      }
+      case HLSFlowStep_Type::ESTIMATE_EVALUATION:
+      {
+         design_flow_step = DesignFlowStepRef(new EstimateEvaluation(parameters, HLS_mgr, design_flow_manager.lock()));
+         break;
+      }
       case HLSFlowStep_Type::EVALUATION:
       {
          design_flow_step = DesignFlowStepRef(new Evaluation(parameters, HLS_mgr, design_flow_manager.lock()));
@@ -591,6 +611,7 @@ DesignFlowStepSet HLSFlowStepFactory::CreateHLSFlowSteps(
       switch(hls_flow_step.first)
       {
          case HLSFlowStep_Type::DRY_RUN_EVALUATION:
+         case HLSFlowStep_Type::ESTIMATE_EVALUATION:
          case HLSFlowStep_Type::EVALUATION:
          case HLSFlowStep_Type::GENERATE_HDL:
          case HLSFlowStep_Type::TEST_VECTOR_PARSER:
@@ -642,7 +663,9 @@ DesignFlowStepSet HLSFlowStepFactory::CreateHLSFlowSteps(
          case HLSFlowStep_Type::INFERRED_INTERFACE_GENERATION:
          case HLSFlowStep_Type::INITIALIZE_HLS:
          case HLSFlowStep_Type::INTERFACE_CS_GENERATION:
+         case HLSFlowStep_Type::LINEAR_SCAN_REGISTER_BINDING:
          case HLSFlowStep_Type::LIST_BASED_SCHEDULING:
+         case HLSFlowStep_Type::LOOP_INITIATION_INTERVAL:
          case HLSFlowStep_Type::MINIMAL_INTERFACE_GENERATION:
          case HLSFlowStep_Type::MUX_INTERCONNECTION_BINDING:
 #if HAVE_FROM_PRAGMA_BUILT
@@ -139,6 +139,11 @@ std::string HLSFunctionStep::GetName() const
        ;
 }
 
+unsigned int HLSFunctionStep::GetFunctionId() const
+{
+   return funId;
+}
+
 void HLSFunctionStep::ComputeRelationships(DesignFlowStepSet& design_flow_step_set,
                                            const DesignFlowStep::RelationshipType relationship_type)
 {
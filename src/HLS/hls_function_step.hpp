@@ -97,6 +97,8 @@ class HLSFunctionStep : public HLS_step
 
    std::string GetName() const final;
 
+   unsigned int GetFunctionId() const final;
+
    DesignFlowStep_Status Exec() final;
 
    /**
@@ -162,6 +162,8 @@ std::string HLS_step::EnumToName(const HLSFlowStep_Type hls_flow_step_type)
          return "DryRunEvaluation";
       case HLSFlowStep_Type::EASY_MODULE_BINDING:
          return "EasyModuleBinding";
+      case HLSFlowStep_Type::ESTIMATE_EVALUATION:
+         return "EstimateEvaluation";
       case HLSFlowStep_Type::EVALUATION:
          return "Evaluation";
       case HLSFlowStep_Type::FSM_CONTROLLER_CREATOR:
@@ -192,8 +194,12 @@ std::string HLS_step::EnumToName(const HLSFlowStep_Type hls_flow_step_type)
          return "InitializeHLS";
       case HLSFlowStep_Type::INTERFACE_CS_GENERATION:
          return "InterfaceCSGeneration";
+      case HLSFlowStep_Type::LINEAR_SCAN_REGISTER_BINDING:
+         return "LinearScanRegisterBinding";
       case HLSFlowStep_Type::LIST_BASED_SCHEDULING:
          return "ParametricListBased";
+      case HLSFlowStep_Type::LOOP_INITIATION_INTERVAL:
+         return "LoopInitiationInterval";
       case HLSFlowStep_Type::MINIMAL_INTERFACE_GENERATION:
          return "MinimalInterfaceGeneration";
       case HLSFlowStep_Type::INFERRED_INTERFACE_GENERATION:
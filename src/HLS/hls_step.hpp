@@ -129,6 +129,7 @@ enum class HLSFlowStep_Type
    DOMINATOR_MEMORY_ALLOCATION_CS,
    DRY_RUN_EVALUATION,
    EASY_MODULE_BINDING,
+   ESTIMATE_EVALUATION,
    EVALUATION,
    FSM_CONTROLLER_CREATOR,
    FSM_CS_CONTROLLER_CREATOR,
@@ -147,7 +148,9 @@ enum class HLSFlowStep_Type
    INFERRED_INTERFACE_GENERATION,
    INITIALIZE_HLS,
    INTERFACE_CS_GENERATION,
+   LINEAR_SCAN_REGISTER_BINDING,
    LIST_BASED_SCHEDULING,
+   LOOP_INITIATION_INTERVAL,
    MINIMAL_INTERFACE_GENERATION,
    MUX_INTERCONNECTION_BINDING,
 #if HAVE_FROM_PRAGMA_BUILT
@@ -46,6 +46,7 @@
 #include "area_info.hpp"
 #include "basic_block.hpp"
 #include "behavioral_helper.hpp"
+#include "config_NPROFILE.hpp"
 #include "custom_map.hpp"
 #include "custom_set.hpp"
 #include "dbgPrintHelper.hpp"
@@ -265,6 +266,48 @@ double AllocationInformation::time_m_stage_period(operation* op) const
    return op->time_m->get_stage_period() * time_multiplier;
 }
 
+/// fields of AllocationInformation::fu_op_timing
+#define TIMING_EXECUTION_TIME 1U
+#define TIMING_STAGE_PERIOD 2U
+#define TIMING_INITIATION_TIME 4U
+#define TIMING_CYCLES 8U
+
+unsigned int AllocationInformation::GetTimingOperationId(const std::string& operation_name) const
+{
+   const auto it = timing_operation_ids.find(operation_name);
+   if(it != timing_operation_ids.end())
+   {
+      return it->second;
+   }
+   const auto operation_id = static_cast<unsigned int>(timing_normalized_operations.size());
+   timing_operation_ids.insert(std::make_pair(operation_name, operation_id));
+   timing_normalized_operations.push_back(tree_helper::NormalizeTypename(operation_name));
+   return operation_id;
+}
+
+AllocationInformation::fu_op_timing& AllocationInformation::GetTimingEntry(const unsigned int fu_name,
+                                                                           const unsigned int operation_id,
+                                                                           const unsigned int field) const
+{
+   /// functional units are only appended during allocation, so existing rows stay valid
+   if(fu_op_timing_table.size() <= fu_name)
+   {
+      fu_op_timing_table.resize(list_of_FU.size());
+   }
+   auto& row = fu_op_timing_table[fu_name];
+   if(row.size() <= operation_id)
+   {
+      row.resize(timing_normalized_operations.size());
+   }
+   auto& entry = row[operation_id];
+   ++timing_table_queries;
+   if(entry.computed & field)
+   {
+      ++timing_table_hits;
+   }
+   return entry;
+}
+
 std::pair<std::string, std::string> AllocationInformation::get_fu_name(unsigned int id) const
 {
    THROW_ASSERT(id_to_fu_names.find(id) != id_to_fu_names.end(), "Functional unit name not stored!");
@@ -337,8 +380,19 @@ double AllocationInformation::get_execution_time(const unsigned int fu_name, uns
    {
       return 0.0;
    }
-   const auto operation_name =
-       tree_helper::NormalizeTypename(GetPointerS<const gimple_node>(TreeM->GetTreeNode(v))->operation);
+   const auto operation_id = GetTimingOperationId(GetPointerS<const gimple_node>(TreeM->GetTreeNode(v))->operation);
+   auto& entry = GetTimingEntry(fu_name, operation_id, TIMING_EXECUTION_TIME);
+   if(!(entry.computed & TIMING_EXECUTION_TIME))
+   {
+      entry.execution_time = compute_execution_time(fu_name, timing_normalized_operations[operation_id]);
+      entry.computed |= TIMING_EXECUTION_TIME;
+   }
+   return entry.execution_time;
+}
+
+double AllocationInformation::compute_execution_time(const unsigned int fu_name,
+                                                     const std::string& operation_name) const
+{
    const auto node_op = GetPointerS<functional_unit>(list_of_FU[fu_name])->get_operation(operation_name);
    THROW_ASSERT(GetPointerS<operation>(node_op)->time_m,
                 "Timing information not specified for unit " + id_to_fu_names.find(fu_name)->second.first);
@@ -655,6 +709,16 @@ double AllocationInformation::get_area(const unsigned int fu_name) const
    {
       return 0.0;
    }
+   if(fu_area_table.size() <= fu_name)
+   {
+      fu_area_table.resize(list_of_FU.size(), -1.0);
+   }
+   ++timing_table_queries;
+   if(fu_area_table[fu_name] >= 0.0)
+   {
+      ++timing_table_hits;
+      return fu_area_table[fu_name];
+   }
    area_infoRef a_m = GetPointerS<functional_unit>(list_of_FU[fu_name])->area_m;
    THROW_ASSERT(a_m, "Area information not specified for unit " + id_to_fu_names.find(fu_name)->second.first);
    auto area = a_m->get_resource_value(area_info::SLICE_LUTS);
@@ -662,6 +726,7 @@ double AllocationInformation::get_area(const unsigned int fu_name) const
    {
       area = a_m->get_area_value();
    }
+   fu_area_table[fu_name] = area;
    return area;
 }
 
@@ -780,11 +845,18 @@ ControlStep AllocationInformation::get_initiation_time(const unsigned int fu_nam
    {
       return ControlStep(0u);
    }
-   technology_nodeRef node_op =
-       GetPointerS<functional_unit>(list_of_FU[fu_name])->get_operation(tree_helper::NormalizeTypename(operation_name));
-   THROW_ASSERT(GetPointerS<operation>(node_op)->time_m,
-                "Timing information not specified for unit " + id_to_fu_names.find(fu_name)->second.first);
-   return GetPointerS<operation>(node_op)->time_m->get_initiation_time();
+   const auto operation_id = GetTimingOperationId(operation_name);
+   auto& entry = GetTimingEntry(fu_name, operation_id, TIMING_INITIATION_TIME);
+   if(!(entry.computed & TIMING_INITIATION_TIME))
+   {
+      technology_nodeRef node_op =
+          GetPointerS<functional_unit>(list_of_FU[fu_name])->get_operation(timing_normalized_operations[operation_id]);
+      THROW_ASSERT(GetPointerS<operation>(node_op)->time_m,
+                   "Timing information not specified for unit " + id_to_fu_names.find(fu_name)->second.first);
+      entry.initiation_time = GetPointerS<operation>(node_op)->time_m->get_initiation_time();
+      entry.computed |= TIMING_INITIATION_TIME;
+   }
+   return entry.initiation_time;
 }
 
 bool AllocationInformation::is_operation_bounded(const OpGraphConstRef g, const vertex& op, unsigned int fu_type) const
@@ -1053,8 +1125,20 @@ double AllocationInformation::get_stage_period(const unsigned int fu_name, const
    {
       return 0.0;
    }
-   technology_nodeRef node_op =
-       GetPointerS<functional_unit>(list_of_FU[fu_name])->get_operation(tree_helper::NormalizeTypename(operation_t));
+   const auto operation_id = GetTimingOperationId(operation_t);
+   auto& entry = GetTimingEntry(fu_name, operation_id, TIMING_STAGE_PERIOD);
+   if(!(entry.computed & TIMING_STAGE_PERIOD))
+   {
+      entry.stage_period = compute_stage_period(fu_name, operation_t, timing_normalized_operations[operation_id]);
+      entry.computed |= TIMING_STAGE_PERIOD;
+   }
+   return entry.stage_period;
+}
+
+double AllocationInformation::compute_stage_period(const unsigned int fu_name, const std::string& operation_t,
+                                                   const std::string& normalized_operation) const
+{
+   technology_nodeRef node_op = GetPointerS<functional_unit>(list_of_FU[fu_name])->get_operation(normalized_operation);
    THROW_ASSERT(GetPointerS<operation>(node_op)->time_m,
                 "Timing information not specified for unit " + id_to_fu_names.find(fu_name)->second.first);
    /// DSP based components are underestimated when the RTL synthesis backend converts in LUTs, so we slightly increase
@@ -1158,12 +1242,18 @@ unsigned int AllocationInformation::get_cycles(const unsigned int fu_name, const
    {
       return 0;
    }
-   technology_nodeRef node_op = GetPointerS<functional_unit>(list_of_FU[fu_name])->get_operation(operation_t);
-   THROW_ASSERT(GetPointer<operation>(node_op), id_to_fu_names.at(fu_name).first);
-   THROW_ASSERT(GetPointerS<operation>(node_op)->time_m, "Timing information not specified for operation " +
-                                                             node_op->get_name() + " on unit " +
-                                                             id_to_fu_names.find(fu_name)->second.first);
-   return GetPointerS<operation>(node_op)->time_m->get_cycles();
+   auto& entry = GetTimingEntry(fu_name, GetTimingOperationId(operation_t), TIMING_CYCLES);
+   if(!(entry.computed & TIMING_CYCLES))
+   {
+      technology_nodeRef node_op = GetPointerS<functional_unit>(list_of_FU[fu_name])->get_operation(operation_t);
+      THROW_ASSERT(GetPointer<operation>(node_op), id_to_fu_names.at(fu_name).first);
+      THROW_ASSERT(GetPointerS<operation>(node_op)->time_m, "Timing information not specified for operation " +
+                                                                node_op->get_name() + " on unit " +
+                                                                id_to_fu_names.find(fu_name)->second.first);
+      entry.cycles = GetPointerS<operation>(node_op)->time_m->get_cycles();
+      entry.computed |= TIMING_CYCLES;
+   }
+   return entry.cycles;
 }
 
 technology_nodeRef AllocationInformation::get_fu(unsigned int fu_name) const
@@ -3972,6 +4062,21 @@ void AllocationInformation::Clear()
    ssa_bb_versions.clear();
    ssa_cond_exprs.clear();
    cond_expr_bb_versions.clear();
+#if !NPROFILE
+   if(timing_table_queries)
+   {
+      INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, parameters->getOption<int>(OPT_output_level),
+                     "---Allocation timing table: " + STR(timing_table_queries) + " queries, " +
+                         STR(timing_table_hits) + " hits, " + STR(timing_normalized_operations.size()) +
+                         " operations");
+   }
+#endif
+   timing_operation_ids.clear();
+   timing_normalized_operations.clear();
+   fu_op_timing_table.clear();
+   fu_area_table.clear();
+   timing_table_queries = 0;
+   timing_table_hits = 0;
 }
 double AllocationInformation::GetToDspRegisterDelay(const unsigned int statement_index) const
 {
@@ -253,6 +253,70 @@ class AllocationInformation : public HLSFunctionIR
    /// put into relation variable and their latency when they are mapped on a private synchronous ram
    std::map<unsigned int, std::string> sync_ram_var_latency;
 
+   /// Timing characterization of an operation on a functional unit, computed on first use
+   struct fu_op_timing
+   {
+      /// Bitmask of the fields already computed
+      unsigned int computed{0};
+
+      double execution_time{0.0};
+
+      double stage_period{0.0};
+
+      ControlStep initiation_time{0u};
+
+      unsigned int cycles{0};
+   };
+
+   /// dense identifier of each operation name queried for timing information
+   mutable CustomUnorderedMap<std::string, unsigned int> timing_operation_ids;
+
+   /// normalized operation name of each dense operation identifier
+   mutable std::vector<std::string> timing_normalized_operations;
+
+   /// timing of each (functional unit, operation identifier) pair
+   mutable std::vector<std::vector<fu_op_timing>> fu_op_timing_table;
+
+   /// area of each functional unit, negative when not yet computed
+   mutable std::vector<double> fu_area_table;
+
+   /// number of queries to the timing and area tables
+   mutable unsigned long long timing_table_queries{0};
+
+   /// number of queries served without recomputation
+   mutable unsigned long long timing_table_hits{0};
+
+   /**
+    * Return the dense identifier of an operation name, assigning a new one on first use
+    * @param operation_name is the operation name as stored in the statement
+    */
+   unsigned int GetTimingOperationId(const std::string& operation_name) const;
+
+   /**
+    * Return the timing table entry of an operation on a functional unit
+    * @param fu_name is the functional unit
+    * @param operation_id is the dense identifier of the operation name
+    * @param field is the bit of fu_op_timing::computed corresponding to the requested value
+    */
+   fu_op_timing& GetTimingEntry(const unsigned int fu_name, const unsigned int operation_id,
+                                const unsigned int field) const;
+
+   /**
+    * Compute the execution time of an operation on a functional unit
+    * @param fu_name is the functional unit
+    * @param operation_name is the normalized operation name
+    */
+   double compute_execution_time(const unsigned int fu_name, const std::string& operation_name) const;
+
+   /**
+    * Compute the stage period of an operation on a functional unit
+    * @param fu_name is the functional unit
+    * @param operation_t is the operation name as stored in the statement
+    * @param normalized_operation is the normalized operation name
+    */
+   double compute_stage_period(const unsigned int fu_name, const std::string& operation_t,
+                               const std::string& normalized_operation) const;
+
    std::string get_latency_string(const std::string& lat) const;
 
    /// return the execution time of the operation corrected by time_multiplier factor
@@ -175,6 +175,26 @@ void ReadWrite_m_axiModuleGenerator::InternalExec(std::ostream& out, structural_
       line_count = std::stoull(it->second);
    }
 
+   /* Get burst info */
+   unsigned long long burst_length = 0;
+   if(auto it = iface_attrs.find(FunctionArchitecture::iface_burst_length); it != iface_attrs.end() && !line_count)
+   {
+      burst_length = std::stoull(it->second);
+      const auto bus_bytes = _ports_out[o_wdata].type_size / 8;
+      if(burst_length < 2 || burst_length > 256 || (burst_length & (burst_length - 1)) || bus_bytes == 0 ||
+         (bus_bytes & (bus_bytes - 1)) || burst_length * bus_bytes > 4096)
+      {
+         THROW_ERROR("Unsupported AXI burst length for bundle " + bundle_name + ": " + it->second);
+      }
+      if(has_device_burst_type && device_burst_type != 1)
+      {
+         THROW_WARNING("Selected device does not support INCREMENTAL AXI bursts: multi-beat bursts disabled for "
+                       "bundle " +
+                       bundle_name);
+         burst_length = 0;
+      }
+   }
+
    out << "localparam BITSIZE_address=BITSIZE_" << _ports_in[i_in4].name << ",\n"
        << "  BITSIZE_bus=" << _ports_out[o_wdata].type_size << ",\n"
        << "  BITSIZE_bus_size=BITSIZE_bus/8,\n"
@@ -198,9 +218,17 @@ void ReadWrite_m_axiModuleGenerator::InternalExec(std::ostream& out, structural_
    std::string ip_components;
    if(line_count == 0)
    {
-      ip_components = "MinimalAXI4AdapterSingleBeat";
-      out << "MinimalAXI4AdapterSingleBeat #(.BURST_TYPE(" << axi_burst_type << "),\n"
-          << "  .BITSIZE_Mout_addr_ram(BITSIZE_address),\n"
+      ip_components = burst_length ? "MinimalAXI4AdapterBurst" : "MinimalAXI4AdapterSingleBeat";
+      out << ip_components << " #(";
+      if(burst_length)
+      {
+         out << ".BURST_LENGTH(" << burst_length << "),\n";
+      }
+      else
+      {
+         out << ".BURST_TYPE(" << axi_burst_type << "),\n";
+      }
+      out << "  .BITSIZE_Mout_addr_ram(BITSIZE_address),\n"
           << "  .BITSIZE_Mout_Wdata_ram(BITSIZE_data),\n"
           << "  .BITSIZE_Mout_data_ram_size(BITSIZE_" << _ports_in[i_in2].name << "),\n"
           << "  .BITSIZE_M_Rdata_ram(BITSIZE_data),\n"
@@ -248,8 +276,12 @@ void ReadWrite_m_axiModuleGenerator::InternalExec(std::ostream& out, structural_
           << "  .m_axi_wvalid(" << _ports_out[o_wvalid].name << "),\n"
           << "  .m_axi_bready(" << _ports_out[o_bready].name << "),\n"
           << "  .clock(clock),\n"
-          << "  .reset(reset),\n"
-          << "  .Mout_oe_ram(" << _ports_in[i_start].name << " && !" << _ports_in[i_in1].name << "),\n"
+          << "  .reset(reset),\n";
+      if(burst_length)
+      {
+         out << "  .Mout_invalidate(" << _ports_in[i_cache_reset].name << "),\n";
+      }
+      out << "  .Mout_oe_ram(" << _ports_in[i_start].name << " && !" << _ports_in[i_in1].name << "),\n"
           << "  .Mout_we_ram(" << _ports_in[i_start].name << " && " << _ports_in[i_in1].name << "),\n"
           << "  .Mout_addr_ram(" << _ports_in[i_in4].name << "),\n"
           << "  .Mout_Wdata_ram(" << _ports_in[i_in3].name << "),\n"
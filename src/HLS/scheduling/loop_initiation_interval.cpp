@@ -0,0 +1,244 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file loop_initiation_interval.cpp
+ * @brief Computation of the minimum initiation interval of the loops selected by --loop-ii-analysis
+ *
+ */
+#include "loop_initiation_interval.hpp"
+
+#include "Parameter.hpp"
+#include "allocation_information.hpp"
+#include "basic_block.hpp"
+#include "behavioral_helper.hpp"
+#include "custom_map.hpp"
+#include "dbgPrintHelper.hpp"
+#include "exceptions.hpp"
+#include "fu_binding.hpp"
+#include "function_behavior.hpp"
+#include "hls.hpp"
+#include "hls_constraints.hpp"
+#include "hls_manager.hpp"
+#include "loop.hpp"
+#include "loops.hpp"
+#include "minimum_initiation_interval.hpp"
+#include "op_graph.hpp"
+#include "schedule.hpp"
+#include "string_manipulation.hpp" // for GET_CLASS
+#include "utility.hpp"
+
+#include <algorithm>
+#include <list>
+#include <utility>
+#include <vector>
+
+LoopInitiationInterval::LoopInitiationInterval(const ParameterConstRef _Param, const HLS_managerRef _HLSMgr,
+                                               unsigned int _funId,
+                                               const DesignFlowManagerConstRef _design_flow_manager)
+    : HLSFunctionStep(_Param, _HLSMgr, _funId, _design_flow_manager, HLSFlowStep_Type::LOOP_INITIATION_INTERVAL)
+{
+   debug_level = parameters->get_class_debug_level(GET_CLASS(*this));
+}
+
+HLS_step::HLSRelationships
+LoopInitiationInterval::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const
+{
+   HLSRelationships ret;
+   switch(relationship_type)
+   {
+      case DEPENDENCE_RELATIONSHIP:
+      {
+#if HAVE_FROM_PRAGMA_BUILT
+         if(parameters->getOption<bool>(OPT_parse_pragma))
+         {
+            ret.insert(std::make_tuple(HLSFlowStep_Type::OMP_ALLOCATION, HLSFlowStepSpecializationConstRef(),
+                                       HLSFlowStep_Relationship::SAME_FUNCTION));
+         }
+         else
+#endif
+         {
+            ret.insert(std::make_tuple(HLSFlowStep_Type::ALLOCATION, HLSFlowStepSpecializationConstRef(),
+                                       HLSFlowStep_Relationship::SAME_FUNCTION));
+         }
+         break;
+      }
+      case INVALIDATION_RELATIONSHIP:
+      case PRECEDENCE_RELATIONSHIP:
+      {
+         break;
+      }
+      default:
+         THROW_UNREACHABLE("");
+   }
+   return ret;
+}
+
+unsigned int LoopInitiationInterval::ComputeResMII(const OpVertexSet& loop_operations) const
+{
+   const auto allocation_information = HLS->allocation_information;
+   const auto dfg = HLSMgr->CGetFunctionBehavior(funId)->CGetOpGraph(FunctionBehavior::DFG);
+   /// For each bounded functional unit type, the cycles it is kept busy by an iteration
+   CustomMap<unsigned int, unsigned int> fu_occupancy;
+   for(const auto operation : loop_operations)
+   {
+      const auto& fu_set = allocation_information->can_implement_set(operation);
+      /// Operations which can be executed by different functional unit types do not constrain a single one
+      if(fu_set.size() != 1)
+      {
+         continue;
+      }
+      const auto fu_type = *fu_set.begin();
+      if(allocation_information->get_number_fu(fu_type) == INFINITE_UINT)
+      {
+         continue;
+      }
+      const auto fu_ii =
+          from_strongtype_cast<unsigned int>(allocation_information->get_initiation_time(fu_type, operation));
+      const auto busy_cycles = fu_ii != 0 ? fu_ii : allocation_information->GetCycleLatency(operation);
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                     "---" + GET_NAME(dfg, operation) + " keeps " + allocation_information->get_fu_name(fu_type).first +
+                         " busy for " + STR(busy_cycles) + " cycles");
+      fu_occupancy[fu_type] += busy_cycles;
+   }
+   std::vector<std::pair<unsigned int, unsigned int>> occupancy;
+   for(const auto& [fu_type, busy_cycles] : fu_occupancy)
+   {
+      occupancy.emplace_back(busy_cycles, allocation_information->get_number_fu(fu_type));
+   }
+   return ResourceMII(occupancy);
+}
+
+double LoopInitiationInterval::GetRecurrenceDelay(const vertex operation, const double clock_period) const
+{
+   const auto allocation_information = HLS->allocation_information;
+   const auto dfg = HLSMgr->CGetFunctionBehavior(funId)->CGetOpGraph(FunctionBehavior::DFG);
+   /// The loop-carried value is registered at the iteration boundary
+   if(GET_TYPE(dfg, operation) & (TYPE_PHI | TYPE_VPHI))
+   {
+      return 0.0;
+   }
+   /// Unbound operations cannot be chained
+   if(allocation_information->can_implement_set(operation).size() != 1)
+   {
+      return clock_period;
+   }
+   const auto cycle_latency = allocation_information->GetCycleLatency(operation);
+   if(cycle_latency > 1)
+   {
+      return cycle_latency * clock_period;
+   }
+   return std::min(clock_period, allocation_information->GetTimeLatency(operation, fu_binding::UNKNOWN).first);
+}
+
+unsigned int LoopInitiationInterval::ComputeRecMII(const OpVertexSet& loop_operations, const double clock_period) const
+{
+   const auto FB = HLSMgr->CGetFunctionBehavior(funId);
+   const auto fdfg = FB->CGetOpGraph(FunctionBehavior::FDFG, loop_operations);
+   const auto dfg = FB->CGetOpGraph(FunctionBehavior::DFG, loop_operations);
+   std::list<vertex> sorted_operations;
+   dfg->TopologicalSort(sorted_operations);
+   CustomMap<vertex, size_t> operation_index;
+   std::vector<double> delays;
+   for(const auto operation : sorted_operations)
+   {
+      operation_index[operation] = delays.size();
+      delays.push_back(GetRecurrenceDelay(operation, clock_period));
+   }
+   std::vector<std::pair<size_t, size_t>> dependences;
+   std::vector<std::pair<size_t, size_t>> carried_dependences;
+   EdgeIterator e, e_end;
+   for(boost::tie(e, e_end) = boost::edges(*fdfg); e != e_end; ++e)
+   {
+      const auto dependence =
+          std::make_pair(operation_index.at(boost::source(*e, *fdfg)), operation_index.at(boost::target(*e, *fdfg)));
+      if(fdfg->GetSelector(*e) & FB_DFG_SELECTOR)
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                        "---Recurrence " + GET_NAME(fdfg, boost::target(*e, *fdfg)) + " -> " +
+                            GET_NAME(fdfg, boost::source(*e, *fdfg)));
+         carried_dependences.push_back(dependence);
+      }
+   }
+   for(boost::tie(e, e_end) = boost::edges(*dfg); e != e_end; ++e)
+   {
+      dependences.emplace_back(operation_index.at(boost::source(*e, *dfg)),
+                               operation_index.at(boost::target(*e, *dfg)));
+   }
+   return RecurrenceMII(delays, dependences, carried_dependences, clock_period);
+}
+
+DesignFlowStep_Status LoopInitiationInterval::InternalExec()
+{
+   const auto FB = HLSMgr->CGetFunctionBehavior(funId);
+   const auto loops = FB->CGetLoops();
+   const auto bb_graph = FB->CGetBBGraph(FunctionBehavior::BB);
+   const auto clock_period = HLS->HLS_C->get_clock_period() * HLS->HLS_C->get_clock_period_resource_fraction();
+   const auto dfg = FB->CGetOpGraph(FunctionBehavior::DFG);
+   bool analyzed = false;
+   for(const auto& loop : loops->GetList())
+   {
+      const auto loop_id = loop->GetId();
+      if(!loop_id || !loop->IsReducible() || !loop->is_innermost())
+      {
+         continue;
+      }
+      const auto target_ii = FB->GetLoopInitiationInterval(loop_id);
+      if(!target_ii)
+      {
+         continue;
+      }
+      INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "-->Analyzing loop " + STR(loop_id));
+      OpVertexSet loop_operations(dfg);
+      for(const auto bb : loop->get_blocks())
+      {
+         const auto& statements_list = bb_graph->CGetBBNodeInfo(bb)->statements_list;
+         loop_operations.insert(statements_list.begin(), statements_list.end());
+      }
+      const auto res_mii = ComputeResMII(loop_operations);
+      const auto rec_mii = ComputeRecMII(loop_operations, clock_period);
+      const auto mii = std::max(res_mii, rec_mii);
+      INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Analyzed loop " + STR(loop_id));
+      INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level,
+                     "---Loop " + STR(loop_id) + " of " + FB->CGetBehavioralHelper()->get_function_name() +
+                         ": target II=" + STR(target_ii) + ", MII=" + STR(mii) + " (ResMII=" + STR(res_mii) +
+                         ", RecMII=" + STR(rec_mii) + ")");
+      if(target_ii < mii)
+      {
+         THROW_WARNING("Target initiation interval " + STR(target_ii) + " of loop " + STR(loop_id) + " of " +
+                       FB->CGetBehavioralHelper()->get_function_name() + " is not achievable: minimum is " +
+                       STR(mii));
+      }
+      analyzed = true;
+   }
+   return analyzed ? DesignFlowStep_Status::SUCCESS : DesignFlowStep_Status::UNCHANGED;
+}
@@ -0,0 +1,93 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file loop_initiation_interval.hpp
+ * @brief Computation of the minimum initiation interval of the loops selected by --loop-ii-analysis
+ *
+ */
+#ifndef LOOP_INITIATION_INTERVAL_HPP
+#define LOOP_INITIATION_INTERVAL_HPP
+
+#include "hls_function_step.hpp"
+
+#include "graph.hpp"
+
+class OpVertexSet;
+
+/**
+ * Compute for each innermost loop with a target initiation interval (see --loop-ii-analysis) the minimum initiation
+ * interval allowed by the allocated resources (ResMII) and by the loop-carried data dependences (RecMII)
+ */
+class LoopInitiationInterval : public HLSFunctionStep
+{
+ protected:
+   HLSRelationships ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
+
+   /**
+    * Compute the resource constrained minimum initiation interval of a loop
+    * @param loop_operations is the set of operations of the loop
+    * @return the maximum over the bounded functional unit types of the cycles they are kept busy by an iteration
+    * divided by the number of allocated instances
+    */
+   unsigned int ComputeResMII(const OpVertexSet& loop_operations) const;
+
+   /**
+    * Compute the recurrence constrained minimum initiation interval of a loop
+    * @param loop_operations is the set of operations of the loop
+    * @param clock_period is the clock period available for the operations
+    * @return the number of cycles required by the longest chain of data dependences closed by a loop-carried one
+    */
+   unsigned int ComputeRecMII(const OpVertexSet& loop_operations, const double clock_period) const;
+
+   /**
+    * Return the delay of an operation along a recurrence
+    * @param operation is the operation
+    * @param clock_period is the clock period available for the operations
+    * @return the delay in ns (multi-cycle operations take their whole cycles)
+    */
+   double GetRecurrenceDelay(const vertex operation, const double clock_period) const;
+
+ public:
+   /**
+    * Constructor
+    * @param Param is the set of the parameters
+    * @param HLSMgr is the HLS manager
+    * @param funId is the function to be analyzed
+    * @param design_flow_manager is the design flow manager
+    */
+   LoopInitiationInterval(const ParameterConstRef Param, const HLS_managerRef HLSMgr, unsigned int funId,
+                          const DesignFlowManagerConstRef design_flow_manager);
+
+   DesignFlowStep_Status InternalExec() override;
+};
+#endif
@@ -0,0 +1,108 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file minimum_initiation_interval.hpp
+ * @brief Lower bounds of the initiation interval of a loop, computed on an abstraction of its operations
+ *
+ */
+#ifndef MINIMUM_INITIATION_INTERVAL_HPP
+#define MINIMUM_INITIATION_INTERVAL_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * Compute the resource constrained minimum initiation interval of a loop
+ * @param fu_occupancy contains, for each bounded functional unit type, the cycles it is kept busy by an iteration and
+ * the number of allocated instances
+ * @return the maximum over the functional unit types of the busy cycles divided by the instances, rounded up
+ */
+inline unsigned int ResourceMII(const std::vector<std::pair<unsigned int, unsigned int>>& fu_occupancy)
+{
+   unsigned int res_mii = 1;
+   for(const auto& [busy_cycles, fu_number] : fu_occupancy)
+   {
+      res_mii = std::max(res_mii, (busy_cycles + fu_number - 1) / fu_number);
+   }
+   return res_mii;
+}
+
+/**
+ * Compute the recurrence constrained minimum initiation interval of a loop
+ * @param delays is the delay of each operation of an iteration; operations are indexed in a topological order of the
+ * data dependences inside the iteration
+ * @param dependences are the data dependences inside an iteration as pairs of source and target index
+ * @param carried_dependences are the loop-carried data dependences as pairs of source and target index
+ * @param clock_period is the clock period available for the operations
+ * @return the number of cycles of the longest chain of data dependences which starts from the target of a
+ * loop-carried dependence and is closed by its source
+ */
+inline unsigned int RecurrenceMII(const std::vector<double>& delays,
+                                  const std::vector<std::pair<size_t, size_t>>& dependences,
+                                  const std::vector<std::pair<size_t, size_t>>& carried_dependences,
+                                  const double clock_period)
+{
+   std::vector<std::vector<size_t>> successors(delays.size());
+   for(const auto& [source, target] : dependences)
+   {
+      successors.at(source).push_back(target);
+   }
+   unsigned int rec_mii = 1;
+   for(const auto& [carried_source, recurrence_start] : carried_dependences)
+   {
+      /// negative delays mark the operations not reached from the start of the recurrence
+      std::vector<double> path_delays(delays.size(), -1.0);
+      path_delays.at(recurrence_start) = delays.at(recurrence_start);
+      for(auto operation = recurrence_start; operation < delays.size(); ++operation)
+      {
+         if(path_delays.at(operation) < 0.0)
+         {
+            continue;
+         }
+         for(const auto next : successors.at(operation))
+         {
+            path_delays.at(next) = std::max(path_delays.at(next), path_delays.at(operation) + delays.at(next));
+         }
+      }
+      if(path_delays.at(carried_source) >= 0.0)
+      {
+         rec_mii =
+             std::max(rec_mii, static_cast<unsigned int>(std::ceil(path_delays.at(carried_source) / clock_period)));
+      }
+   }
+   return rec_mii;
+}
+#endif
@@ -114,6 +114,11 @@ Scheduling::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relat
          }
          ret.insert(std::make_tuple(HLSFlowStep_Type::DOMINATOR_ALLOCATION, HLSFlowStepSpecializationConstRef(),
                                     HLSFlowStep_Relationship::WHOLE_APPLICATION));
+         if(parameters->isOption(OPT_loop_ii_analysis))
+         {
+            ret.insert(std::make_tuple(HLSFlowStep_Type::LOOP_INITIATION_INTERVAL, HLSFlowStepSpecializationConstRef(),
+                                       HLSFlowStep_Relationship::SAME_FUNCTION));
+         }
          break;
       }
       case INVALIDATION_RELATIONSHIP:
@@ -58,6 +58,7 @@
 #include "library_manager.hpp"
 #include "math_function.hpp"
 #include "memory.hpp"
+#include "memory_image.hpp"
 #include "memory_symbol.hpp"
 #include "structural_manager.hpp"
 #include "structural_objects.hpp"
@@ -835,33 +836,15 @@ unsigned long long TestbenchGeneration::generate_init_file(const std::string& da
                                                            const tree_managerConstRef TM, unsigned int var,
                                                            const memoryRef mem)
 {
-   std::stringstream init_bits;
-   std::ofstream useless;
+   memory_image image;
    unsigned long long vec_size = 0, elts_size = 0;
    const auto var_type = tree_helper::CGetType(TM->GetTreeNode(var));
    const auto bitsize_align = GetPointer<const type_node>(var_type)->algn;
    THROW_ASSERT((bitsize_align % 8) == 0, "Alignment is not byte aligned.");
-   fu_binding::fill_array_ref_memory(init_bits, useless, var, vec_size, elts_size, mem, TM, false, bitsize_align);
+   fu_binding::fill_array_ref_memory(image, var, vec_size, elts_size, mem, TM, bitsize_align);
 
    std::ofstream init_dat(dat_filename, std::ios::binary);
-   while(!init_bits.eof())
-   {
-      std::string bitstring;
-      init_bits >> bitstring;
-      THROW_ASSERT(bitstring.size() % 8 == 0, "Memory word initializer is not aligned");
-      size_t i;
-      // Memory is little-endian, thus last byte goes in first
-      for(i = bitstring.size(); i >= 8; i -= 8)
-      {
-         char byteval = 0;
-         for(size_t k = 0; k < 8; ++k)
-         {
-            byteval = byteval | static_cast<char>((bitstring.at(i - k - 1U) != '0') << k);
-         }
-         init_dat.put(byteval);
-      }
-   }
-   unsigned long long bytes = static_cast<unsigned long long>(init_dat.tellp());
-   THROW_ASSERT((bytes % (bitsize_align / 8)) == 0, "Memory initialization bytes not aligned");
-   return bytes;
+   image.write_raw(init_dat);
+   THROW_ASSERT((image.size() % (bitsize_align / 8)) == 0, "Memory initialization bytes not aligned");
+   return image.size();
 }
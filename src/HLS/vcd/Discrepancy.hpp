@@ -57,6 +57,7 @@
 #include "custom_map.hpp"
 #include "custom_set.hpp"
 #include <string>
+#include <vector>
 
 REF_FORWARD_DECL(structural_manager);
 
@@ -179,6 +180,14 @@ struct Discrepancy
     */
    std::map<DiscrepancyOpInfo, std::list<std::pair<uint64_t, std::string>>> c_op_trace;
 
+   /**
+    * Static information on the operations traced by the C code. The
+    * identifier stored in the binary trace records is the index in this
+    * vector; the second element of every pair is the number of bits of the
+    * value written after the record.
+    */
+   std::vector<std::pair<DiscrepancyOpInfo, unsigned int>> c_op_descriptors;
+
    /**
     * This contains the control flow traces gathered from software execution.
     * The primary key is is a function id, the secondary key is a software
@@ -222,6 +231,7 @@ struct Discrepancy
       unfolded_v_to_scope.clear();
       f_id_to_scope.clear();
       c_op_trace.clear();
+      c_op_descriptors.clear();
       c_control_flow_trace.clear();
       c_addr_map.clear();
       context_to_scope.clear();
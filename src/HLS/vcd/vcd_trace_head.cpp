@@ -152,11 +152,10 @@ static bool var_is_later_or_equal(const sig_variation& v, const unsigned long lo
    return v >= time;
 }
 
-vcd_trace_head::vcd_trace_head(const DiscrepancyOpInfo& op, std::string signame, const std::list<sig_variation>& fv,
-                               const std::list<sig_variation>& ov, const std::list<sig_variation>& sv,
-                               unsigned int init_state_id, unsigned long long clock_p,
-                               const HLS_managerConstRef _HLSMgr, const tree_managerConstRef _TM,
-                               const bool _one_hot_fsm_encoding)
+vcd_trace_head::vcd_trace_head(const DiscrepancyOpInfo& op, std::string signame, const vcd_signal_trace& fv,
+                               const vcd_signal_trace& ov, const vcd_signal_trace& sv, unsigned int init_state_id,
+                               unsigned long long clock_p, const HLS_managerConstRef _HLSMgr,
+                               const tree_managerConstRef _TM, const bool _one_hot_fsm_encoding)
     : state(uninitialized),
       failed(fail_none),
       one_hot_fsm_encoding(_one_hot_fsm_encoding),
@@ -153,8 +153,8 @@ vcd_utility::ComputeHLSRelationships(const DesignFlowStep::RelationshipType rela
    return ret;
 }
 
-static const std::list<sig_variation>& get_signal_variations(const vcd_parser::vcd_trace_t& vcd_trace,
-                                                             const std::string& scope, const std::string& signal_name)
+static const vcd_signal_trace& get_signal_variations(const vcd_parser::vcd_trace_t& vcd_trace, const std::string& scope,
+                                                     const std::string& signal_name)
 {
    const auto scopes_end = vcd_trace.end();
    const auto scopes_it = vcd_trace.find(scope);
@@ -176,8 +176,7 @@ unsigned long long vcd_utility::GetClockPeriod(const vcd_parser::vcd_trace_t& vc
    std::string top_scope = Discr->unfolded_v_to_scope.at(Discr->unfolded_root_v);
    const std::string controller_scope = top_scope + "Controller_i" + STR(HIERARCHY_SEPARATOR);
    const auto clock_signal_name = STR(CLOCK_PORT_NAME);
-   const std::list<sig_variation>& clock_sig_variations =
-       get_signal_variations(vcd_trace, controller_scope, clock_signal_name);
+   const vcd_signal_trace& clock_sig_variations = get_signal_variations(vcd_trace, controller_scope, clock_signal_name);
    auto clock_var_it = clock_sig_variations.begin();
    const auto clock_var_beg = clock_var_it;
    const auto clock_var_end = clock_sig_variations.end();
@@ -220,7 +219,7 @@ DesignFlowStep_Status vcd_utility::Exec()
       START_TIME(vcd_parse_time);
    }
    /* create vcd parser obj */
-   vcd_parser vcd_parser(parameters);
+   vcd_parser vcd_parser(parameters->get_class_debug_level("vcd_parser"));
    /* parse the selected signals */
    vcd_parser::vcd_trace_t vcd_trace = vcd_parser.parse_vcd(vcd_filename, HLSMgr->RDiscr->selected_vcd_signals);
 
@@ -300,13 +299,12 @@ DesignFlowStep_Status vcd_utility::Exec()
          const std::string datapath_scope = scope + "Datapath_i" + STR(HIERARCHY_SEPARATOR);
          std::string fullsigname = datapath_scope + outsigname;
          /* select the variations of the output sign&l */
-         const std::list<sig_variation>& op_out_vars = get_signal_variations(vcd_trace, datapath_scope, outsigname);
+         const vcd_signal_trace& op_out_vars = get_signal_variations(vcd_trace, datapath_scope, outsigname);
          /* select the variations of state signal of the state machine */
-         const std::list<sig_variation>& present_state_vars =
+         const vcd_signal_trace& present_state_vars =
              get_signal_variations(vcd_trace, controller_scope, present_state_name);
          /* select the variations of the start port signals */
-         const std::list<sig_variation>& start_vars =
-             get_signal_variations(vcd_trace, controller_scope, STR(START_PORT_NAME));
+         const vcd_signal_trace& start_vars = get_signal_variations(vcd_trace, controller_scope, STR(START_PORT_NAME));
          /*
           * calculate the initial state of the FSM. this is used by the
           * vcd_trace_head to compute the exact starting time for the operation,
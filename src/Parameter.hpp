@@ -82,7 +82,7 @@ class xml_element;
        hls_div)(hls_fpdiv)(interface)(interface_type)(data_bus_bitsize)(addr_bus_bitsize)(libm_std_rounding)(          \
        liveness_algorithm)(scheduling_mux_margins)(scheduling_priority)(scheduling_algorithm)(simulate)(simulator)(    \
        simulation_output)(speculative)(pipelining)(storage_value_insertion_algorithm)(stg)(stg_algorithm)(             \
-       register_allocation_algorithm)(register_grouping)(registered_inputs)(resp_model)(                               \
+       register_allocation_algorithm)(register_grouping)(registered_inputs)(resp_model)(loop_ii_analysis)(             \
        datapath_interconnection_algorithm)(insert_memory_profile)(top_file)(assert_debug)(                             \
        memory_allocation_algorithm)(memory_allocation_policy)(xml_memory_allocation)(rom_duplication)(base_address)(   \
        reset_type)(reset_level)(reg_init_value)(clock_period_resource_fraction)(channels_type)(channels_number)(       \
@@ -102,7 +102,7 @@ class xml_element;
        mentor_root)(mentor_modelsim_bin)(mentor_optimizer)(verilator)(verilator_timescale_override)(                   \
        verilator_parallel)(altera_root)(quartus_settings)(quartus_13_settings)(quartus_13_64bit)(nanoxplore_root)(     \
        nanoxplore_settings)(nanoxplore_bypass)(shared_input_registers)(inline_functions)(function_constraints)(        \
-       resource_constraints)(axi_burst_type)(generate_components_library)
+       resource_constraints)(axi_burst_type)(m_axi_burst_length)(generate_components_library)
 
 #define FRAMEWORK_OPTIONS                                                                                            \
    (benchmark_name)(cat_args)(find_max_transformations)(max_transformations)(compatible_compilers)(compute_size_of)( \
@@ -112,17 +112,18 @@ class xml_element;
        profiling_method)(program_name)(read_parameter_xml)(revision)(seed)(test_multiple_non_deterministic_flows)(   \
        test_single_non_deterministic_flow)(top_functions_names)(xml_input_configuration)(xml_output_configuration)(  \
        write_parameter_xml)(ignore_parallelism)(ignore_mapping)(mapping)(sequence_length)(without_transformation)(   \
-       blackbox)(input_libraries)(frontend_statistics)(exec_argv)(path)
+       blackbox)(input_libraries)(frontend_statistics)(exec_argv)(path)(flow_jobs)(flow_trace)(                      \
+       host_profiling_cache)(host_profiling_extended)
 
 #define COMPILER_OPTIONS                                                                                              \
    (gcc_config)(gcc_costs)(gcc_defines)(gcc_extra_options)(gcc_include_sysdir)(gcc_includes)(gcc_libraries)(          \
        gcc_library_directories)(gcc_openmp_simd)(compiler_opt_level)(gcc_m_env)(gcc_optimizations)(                   \
        gcc_optimization_set)(gcc_parameters)(gcc_plugindir)(gcc_read_xml)(gcc_standard)(gcc_undefines)(gcc_warnings)( \
-       gcc_E)(gcc_S)(gcc_write_xml)
+       gcc_E)(gcc_S)(gcc_write_xml)(frontend_cache)(frontend_jobs)
 
 #define SYNTHESIS_OPTIONS                                                                                            \
    (clock_period)(clock_name)(reset_name)(start_name)(done_name)(device_string)(synthesis_flow)(target_device_file)( \
-       target_device_script)(top_component)(writer_language)
+       target_device_script)(top_component)(writer_language)(technology_cache)
 
 #define SPIDER_OPTIONS                                                                                              \
    (accuracy)(aggregated_features)(cross_validation)(experimental_setup_file)(latex_format_file)(max_bound)(        \
@@ -70,6 +70,9 @@
 #include "custom_set.hpp"
 #include <vector>
 
+/// Graph include
+#include "graph_snapshot.hpp"
+
 /// Utility include
 #include "dbgPrintHelper.hpp" // for DEBUG_LEVEL_NONE
 #include "exceptions.hpp"
@@ -707,25 +710,36 @@ class dominance
       if(dom_computed == DOM_NONE)
       {
          bool reverse = (dir == CDI_POST_DOMINATORS) ? true : false;
+         /// the flow graph is frozen once, so that the edge selector of the view is not evaluated at each visit
+         const GraphSnapshot<GraphObj> snapshot(g);
+         using SnapshotGraph = typename GraphSnapshot<GraphObj>::CSRGraph;
+         using Index = typename GraphSnapshot<GraphObj>::Index;
+         const Index en_index = snapshot.GetIndex(en_block);
+         const Index ex_index = snapshot.GetIndex(ex_block);
+         CustomUnorderedMapStable<Index, Index> index_dom;
          if(reverse)
          {
-            boost::reverse_graph<GraphObj, GraphObj> Rcfg(g);
+            boost::reverse_graph<SnapshotGraph> Rcfg(snapshot.CGetGraph());
             /// store the intermediate information used to compute dominator or post dominator information
-            dom_info<boost::reverse_graph<GraphObj, GraphObj>> di(Rcfg, ex_block, en_block, param);
+            dom_info<boost::reverse_graph<SnapshotGraph>> di(Rcfg, ex_index, en_index, param);
             di.calc_dfs_tree(reverse);
             di.calc_idoms(reverse);
-            di.fill_dom_map(dom);
+            di.fill_dom_map(index_dom);
          }
          else
          {
             /// store the intermediate information used to compute dominator or post dominator information
             INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Computing dominators");
-            dom_info<GraphObj> di(g, en_block, ex_block, param);
+            dom_info<SnapshotGraph> di(snapshot.CGetGraph(), en_index, ex_index, param);
             di.calc_dfs_tree(reverse);
             di.calc_idoms(reverse);
-            di.fill_dom_map(dom);
+            di.fill_dom_map(index_dom);
             INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Computed dominators");
          }
+         for(const auto& index_idom : index_dom)
+         {
+            dom[snapshot.GetVertex(index_idom.first)] = snapshot.GetVertex(index_idom.second);
+         }
          dom_computed = DOM_NO_FAST_QUERY;
       }
       /// fast query not yet supported
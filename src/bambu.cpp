@@ -69,6 +69,7 @@
 /// frontend_flow includes
 #include "frontend_flow_step.hpp"
 #include "frontend_flow_step_factory.hpp"
+#include "function_frontend_flow_step.hpp"
 
 /// HLS includes
 #include "evaluation.hpp"
@@ -101,6 +102,7 @@
 
 /// utility include
 #include "cpu_time.hpp"
+#include "string_manipulation.hpp"
 
 /// wrapper/compiler includes
 #include "compiler_wrapper.hpp"
@@ -285,6 +287,12 @@ int main(int argc, char* argv[])
       design_flow_manager->AddSteps(
           GetPointer<const HLSFlowStepFactory>(hls_flow_step_factory)->CreateHLSFlowSteps(hls_flow_step));
       design_flow_manager->Exec();
+      if(parameters->IsParameter("dfm_statistics"))
+      {
+         INDENT_OUT_MEX(OUTPUT_LEVEL_NONE, output_level,
+                        "---Function analyses not re-executed thanks to IR change kinds: " +
+                            STR(FunctionFrontendFlowStep::GetAvoidedExecutions()));
+      }
       if(not(parameters->getOption<bool>(OPT_no_clean)))
       {
          std::filesystem::remove_all(parameters->getOption<std::string>(OPT_output_temporary_directory));
@@ -55,12 +55,14 @@
 #include "cdfg_edge_info.hpp"                 // for CFG_SELECTOR, CDG_S...
 #include "custom_set.hpp"                     // for CustomSet
 #include "exceptions.hpp"                     // for THROW_ASSERT, THROW...
+#include "ext_tree_node.hpp"                  // for gimple_multi_way_if
 #include "graph.hpp"                          // for vertex, VertexIterator
 #include "level_constructor.hpp"              // for level_constructor
 #include "loop.hpp"                           // for LoopsRef
 #include "loops.hpp"                          // for ProfilingInformatio...
 #include "op_graph.hpp"                       // for OpGraph, OpGraphCon...
 #include "operations_graph_constructor.hpp"   // for OpGraphRef, operati...
+#include "tree_basic_block.hpp"
 #include "tree_helper.hpp"
 #include "tree_manager.hpp" // for pipeline_enabled
 #include "tree_node.hpp"    // for pipeline_enabled
@@ -146,6 +148,7 @@ FunctionBehavior::FunctionBehavior(const application_managerConstRef _AppM, cons
       dereference_unknown_address(false),
       unaligned_accesses(false),
       bb_version(1),
+      ir_change_versions{1, 1, 1, 1},
       bitvalue_version(1),
       has_globals(false),
       has_undefined_function_receiveing_pointers(false),
@@ -153,6 +156,7 @@ FunctionBehavior::FunctionBehavior(const application_managerConstRef _AppM, cons
       pipeline_enabled(false),
       simple_pipeline(false),
       initiation_time(1),
+      loop_initiation_intervals(),
       _channels_number(
           _parameters->isOption(OPT_channels_number) ? _parameters->getOption<unsigned int>(OPT_channels_number) : 0),
       _channels_type(_parameters->getOption<MemoryAllocation_ChannelsType>(OPT_channels_type)),
@@ -237,6 +241,27 @@ FunctionBehavior::FunctionBehavior(const application_managerConstRef _AppM, cons
          }
       }
    }
+   if(_parameters->isOption(OPT_loop_ii_analysis))
+   {
+      const auto loops_iis = string_to_container<std::vector<std::string>>(
+          _parameters->getOption<std::string>(OPT_loop_ii_analysis), ",");
+      for(const auto& loop_ii : loops_iis)
+      {
+         const auto splitted = string_to_container<std::vector<std::string>>(loop_ii, "=");
+         THROW_ASSERT(splitted.size() == 2, "Malformed loop initiation interval analysis request: " + loop_ii);
+         const auto target = string_to_container<std::vector<std::string>>(splitted.at(0), ":");
+         if(target.at(0) != fname)
+         {
+            continue;
+         }
+         const auto loop_id = target.size() == 2 ? static_cast<unsigned int>(std::stoul(target.at(1))) : 0U;
+         loop_initiation_intervals[loop_id] = static_cast<unsigned int>(std::stoul(splitted.at(1)));
+         INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, _parameters->getOption<int>(OPT_output_level),
+                        "Initiation interval analysis with target II=" + splitted.at(1) + " for " +
+                            (loop_id ? ("loop " + STR(loop_id)) : std::string("innermost loops")) +
+                            " of function: " + fname);
+      }
+   }
 }
 
 FunctionBehavior::~FunctionBehavior()
@@ -751,17 +776,92 @@ bool FunctionBehavior::CheckFeedbackReachability(const vertex first_operation, c
    return CheckBBFeedbackReachability(first_bb_vertex, second_bb_vertex);
 }
 
+unsigned int FunctionBehavior::GetLoopInitiationInterval(unsigned int loop_id) const
+{
+   const auto ii_it = loop_initiation_intervals.find(loop_id);
+   if(ii_it != loop_initiation_intervals.end())
+   {
+      return ii_it->second;
+   }
+   const auto all_it = loop_initiation_intervals.find(0);
+   return all_it != loop_initiation_intervals.end() ? all_it->second : 0;
+}
+
 unsigned int FunctionBehavior::GetBBVersion() const
 {
    return bb_version;
 }
 
-unsigned int FunctionBehavior::UpdateBBVersion()
+unsigned int FunctionBehavior::UpdateBBVersion(unsigned int changes)
 {
+   THROW_ASSERT(changes && !(changes & ~IR_ALL), "Unexpected intermediate representation changes: " + STR(changes));
+   if(!(changes & IR_CFG) && HasStaleMultiWayIfLabels())
+   {
+      changes |= IR_CFG;
+   }
+   for(unsigned int kind = 0; kind < 4; ++kind)
+   {
+      if(changes & (1U << kind))
+      {
+         ir_change_versions[kind]++;
+      }
+   }
    bb_version++;
    return bb_version;
 }
 
+bool FunctionBehavior::HasStaleMultiWayIfLabels() const
+{
+   const auto fbb = CGetBBGraph(FBB);
+   VertexIterator v, vEnd;
+   for(boost::tie(v, vEnd) = boost::vertices(*fbb); v != vEnd; v++)
+   {
+      const auto& block = fbb->CGetBBNodeInfo(*v)->block;
+      if(!block || block->CGetStmtList().empty())
+      {
+         continue;
+      }
+      const auto gmwi = GetPointer<const gimple_multi_way_if>(block->CGetStmtList().back());
+      if(!gmwi)
+      {
+         continue;
+      }
+      /// pairs of edge label and target basic block
+      CustomOrderedSet<std::pair<unsigned int, unsigned int>> conditions, labels;
+      for(const auto& cond : gmwi->list_of_cond)
+      {
+         conditions.insert(std::make_pair(cond.first ? cond.first->index : default_COND, cond.second));
+      }
+      OutEdgeIterator oe, oeEnd;
+      for(boost::tie(oe, oeEnd) = boost::out_edges(*v, *fbb); oe != oeEnd; oe++)
+      {
+         const auto target = fbb->CGetBBNodeInfo(boost::target(*oe, *fbb))->block->number;
+         for(const auto label : fbb->CGetBBEdgeInfo(*oe)->get_labels(CFG_SELECTOR))
+         {
+            labels.insert(std::make_pair(label, target));
+         }
+      }
+      if(conditions != labels)
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+unsigned int FunctionBehavior::GetIRVersion(unsigned int kinds) const
+{
+   unsigned int version = 0;
+   for(unsigned int kind = 0; kind < 4; ++kind)
+   {
+      if(kinds & (1U << kind))
+      {
+         version += ir_change_versions[kind];
+      }
+   }
+   return version;
+}
+
 unsigned int FunctionBehavior::GetBitValueVersion() const
 {
    return bitvalue_version;
@@ -355,6 +355,9 @@ class FunctionBehavior
    /// The version of basic block intermediate representation
    unsigned int bb_version;
 
+   /// The version of each kind of modification of the intermediate representation (indexed by bit position)
+   unsigned int ir_change_versions[4];
+
    /// Version of the bitvalue information
    unsigned int bitvalue_version;
 
@@ -376,6 +379,9 @@ class FunctionBehavior
    /// used only for stallable pipelines
    int initiation_time;
 
+   /// The target initiation interval of the analyzed loops (indexed by loop id; 0 stands for all innermost loops)
+   CustomMap<unsigned int, unsigned int> loop_initiation_intervals;
+
    /// Function scope channels number
    unsigned int _channels_number;
 
@@ -384,6 +390,14 @@ class FunctionBehavior
 
    MemoryAllocation_Policy _allocation_policy;
 
+   /**
+    * Check the labels of the basic block edges leaving the multi-way ifs against their conditions: the labels are the
+    * ids of the ssa conditions, so they become stale when a transformation replaces a condition without rebuilding
+    * the basic block graph
+    * @return true if the label of at least one edge does not match the conditions of its multi-way if
+    */
+   bool HasStaleMultiWayIfLabels() const;
+
  public:
    /**
     * Constructor
@@ -448,6 +462,19 @@ class FunctionBehavior
       DJ             /**< DJ basic block graph (used for loop computation) */
    };
 
+   /**
+    * Declaration of enum representing the kinds of modification of the intermediate representation; values can be
+    * or-ed to describe what a transformation touched or what an analysis depends on
+    */
+   enum ir_change_kind : unsigned int
+   {
+      IR_CFG = 1U << 0,   /**< Basic blocks, their predecessors/successors, branch targets and edge labels */
+      IR_STMT = 1U << 1,  /**< Statement and phi lists of the basic blocks */
+      IR_SSA = 1U << 2,   /**< Def-use chains of the ssa variables */
+      IR_TYPES = 1U << 3, /**< Types and bitwidths of variables and constants */
+      IR_ALL = IR_CFG | IR_STMT | IR_SSA | IR_TYPES
+   };
+
    /// Mutual exclusion between basic blocks (based on control flow graph with flow edges)
    CustomUnorderedMapStable<vertex, CustomUnorderedSet<vertex>> bb_reachability;
 
@@ -821,6 +848,13 @@ class FunctionBehavior
       return initiation_time;
    }
 
+   /**
+    * Return the target initiation interval requested for a loop
+    * @param loop_id is the id of the loop
+    * @return the target initiation interval, 0 if the loop has not to be analyzed
+    */
+   unsigned int GetLoopInitiationInterval(unsigned int loop_id) const;
+
    /**
     * Check if a path from first_operation to second_operation exists in control flow graph (without feedback)
     * @param first_operation is the first operation to be considered
@@ -861,10 +895,19 @@ class FunctionBehavior
    unsigned int GetBBVersion() const;
 
    /**
-    * Update the version of the basic block intermediate representation
+    * Update the version of the basic block intermediate representation; changes which replace the condition of a
+    * multi-way if are promoted to IR_CFG, since its conditions label the edges of the basic block graph
+    * @param changes is the set of ir_change_kind which have been modified
     * @return the new version
     */
-   unsigned int UpdateBBVersion();
+   unsigned int UpdateBBVersion(unsigned int changes = IR_ALL);
+
+   /**
+    * Return the version of a set of kinds of modification of the intermediate representation
+    * @param kinds is the set of ir_change_kind to be considered
+    * @return a value which changes every time at least one of the kinds is modified
+    */
+   unsigned int GetIRVersion(unsigned int kinds) const;
 
    /**
     * Return the version of the bitvalue information
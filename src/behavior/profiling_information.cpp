@@ -148,6 +148,17 @@ unsigned long long ProfilingInformation::GetLoopAbsIterations(const LoopConstRef
    return GetLoopAbsIterations(loop->GetId());
 }
 
+const std::vector<unsigned long long int>& ProfilingInformation::GetLoopTripHistogram(const unsigned int loop_id) const
+{
+   static const std::vector<unsigned long long int> empty_histogram;
+   const auto trip_histogram = trip_histograms.find(loop_id);
+   if(trip_histogram != trip_histograms.end())
+   {
+      return trip_histogram->second;
+   }
+   return empty_histogram;
+}
+
 void ProfilingInformation::WriteToXml(xml_element* root, const BBGraphConstRef fcfg) const
 {
    xml_element* path_profiling_xml = root->add_child_element(STR_XML_host_profiling_paths);
@@ -256,4 +267,5 @@ void ProfilingInformation::Clear()
    avg_iterations.clear();
    abs_iterations.clear();
    max_iterations.clear();
+   trip_histograms.clear();
 }
@@ -58,6 +58,8 @@
 /// Utility include
 #include "refcount.hpp"
 
+#include <vector>
+
 CONSTREF_FORWARD_DECL(BBGraph);
 CONSTREF_FORWARD_DECL(Loop);
 class xml_element;
@@ -152,6 +154,19 @@ class Iterations : public std::map<unsigned int, unsigned long long int>
 };
 #endif
 
+/**
+ * Map storing the histogram of the number of iterations of the executions of each loop
+ */
+#if HAVE_UNORDERED
+class TripCountHistograms : public CustomUnorderedMap<unsigned int, std::vector<unsigned long long int>>
+{
+};
+#else
+class TripCountHistograms : public std::map<unsigned int, std::vector<unsigned long long int>>
+{
+};
+#endif
+
 /**
  * Definition of the profiling information class.
  */
@@ -187,6 +202,10 @@ class ProfilingInformation
    /// Maximum number of iterations
    Iterations max_iterations;
 
+   /// Histogram of the number of iterations of each loop execution (logarithmic bins, see
+   /// NUM_CST_host_profiling_trip_bins)
+   TripCountHistograms trip_histograms;
+
  public:
    /**
     * Constructor
@@ -261,6 +280,13 @@ class ProfilingInformation
     */
    unsigned long long GetLoopAbsIterations(const LoopConstRef loop) const;
 
+   /**
+    * Return the histogram of the number of iterations of the executions of a loop
+    * @param loop_id is the id of the loop
+    * @return the number of executions of the loop falling in each bin, empty if the histogram has not been profiled
+    */
+   const std::vector<unsigned long long int>& GetLoopTripHistogram(const unsigned int loop_id) const;
+
    /**
     * Write to xml
     * @param root is the root xml node to which append the information contained in this profiling information
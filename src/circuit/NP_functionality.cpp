@@ -95,16 +95,29 @@ const char* NP_functionality::NP_functionaly_typeNames[] = {"TABLE",
 
 void NP_functionality::add_NP_functionality(NP_functionaly_type type, const std::string& functionality_description)
 {
+   if((type == FSM || type == FSM_CS) && !functionality_description.empty())
+   {
+      add_FSM_description(type, fsm_description::parse(functionality_description));
+      return;
+   }
+   fsm_descriptions.erase(type);
    descriptions[type] = functionality_description;
 }
 
+void NP_functionality::add_FSM_description(NP_functionaly_type type, const fsm_descriptionConstRef& fsm)
+{
+   THROW_ASSERT(type == FSM || type == FSM_CS, "Only FSM and FSM_CS functionalities have a structured description");
+   descriptions.erase(type);
+   fsm_descriptions[type] = fsm;
+}
+
 void NP_functionality::xload(const xml_element* Enode)
 {
    // Recurse through attributes:
    const xml_element::attribute_list& list = Enode->get_attributes();
    for(auto iter : list)
    {
-      descriptions[to_NP_functionaly_type(iter->get_name())] = iter->get_value();
+      add_NP_functionality(to_NP_functionaly_type(iter->get_name()), iter->get_value());
    }
 }
 void NP_functionality::xwrite(xml_element* rootnode)
@@ -115,6 +128,10 @@ void NP_functionality::xwrite(xml_element* rootnode)
    {
       WRITE_XNVM2(NP_functionaly_typeNames[it->first], it->second, Enode);
    }
+   for(const auto& fsm : fsm_descriptions)
+   {
+      WRITE_XNVM2(NP_functionaly_typeNames[fsm.first], fsm.second->to_string(), Enode);
+   }
 }
 
 void NP_functionality::print(std::ostream& os) const
@@ -124,10 +141,25 @@ void NP_functionality::print(std::ostream& os) const
    {
       os << NP_functionaly_typeNames[it->first] << " " << it->second << std::endl;
    }
+   for(const auto& fsm : fsm_descriptions)
+   {
+      os << NP_functionaly_typeNames[fsm.first] << " " << fsm.second->to_string() << std::endl;
+   }
+}
+
+fsm_descriptionConstRef NP_functionality::get_FSM_description(NP_functionaly_type type) const
+{
+   const auto fsm = fsm_descriptions.find(type);
+   return fsm != fsm_descriptions.end() ? fsm->second : fsm_descriptionConstRef();
 }
 
 std::string NP_functionality::get_NP_functionality(NP_functionaly_type type) const
 {
+   const auto fsm = fsm_descriptions.find(type);
+   if(fsm != fsm_descriptions.end())
+   {
+      return fsm->second->to_string();
+   }
    if(descriptions.find(type) == descriptions.end())
    {
       return "";
@@ -140,7 +172,8 @@ std::string NP_functionality::get_NP_functionality(NP_functionaly_type type) con
 
 bool NP_functionality::exist_NP_functionality(NP_functionaly_type type) const
 {
-   return (descriptions.find(type) != descriptions.end() && !descriptions.find(type)->second.empty());
+   return fsm_descriptions.count(type) ||
+          (descriptions.find(type) != descriptions.end() && !descriptions.find(type)->second.empty());
 }
 
 std::string NP_functionality::get_library_name() const
@@ -206,10 +239,15 @@ NP_functionality::NP_functionality(const NP_functionalityRef& obj)
 {
    for(unsigned int i = 0; i < UNKNOWN; i++)
    {
+      if(obj->fsm_descriptions.count(static_cast<NP_functionaly_type>(i)))
+      {
+         continue;
+      }
       std::string val = obj->get_NP_functionality(static_cast<NP_functionaly_type>(i));
       if(!val.empty())
       {
          descriptions[static_cast<NP_functionaly_type>(i)] = val;
       }
    }
+   fsm_descriptions = obj->fsm_descriptions;
 }
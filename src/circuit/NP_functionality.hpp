@@ -43,6 +43,7 @@
 #ifndef NP_FUNCTIONALITY_HPP
 #define NP_FUNCTIONALITY_HPP
 #include "custom_map.hpp"
+#include "fsm_description.hpp"
 #include "refcount.hpp"
 #include <ostream>
 #include <string>
@@ -123,6 +124,8 @@ class NP_functionality
  private:
    /// Store the description of the functionality.
    std::map<NP_functionaly_type, std::string> descriptions;
+   /// Store the structured description of the FSM and FSM_CS functionalities.
+   std::map<NP_functionaly_type, fsm_descriptionConstRef> fsm_descriptions;
    /// store the names of the enumerative NP_functionaly_type.
    static const char* NP_functionaly_typeNames[];
    /**
@@ -146,11 +149,25 @@ class NP_functionality
     */
    void add_NP_functionality(NP_functionaly_type type, const std::string& functionality_description);
 
+   /**
+    * Add the structured description of a finite state machine.
+    * @param type is FSM or FSM_CS.
+    * @param fsm is the finite state machine.
+    */
+   void add_FSM_description(NP_functionaly_type type, const fsm_descriptionConstRef& fsm);
+
    /**
     * Return the description provided the type
+    * For FSM and FSM_CS functionalities the textual representation of the finite state machine is built on the fly.
     */
    std::string get_NP_functionality(NP_functionaly_type type) const;
 
+   /**
+    * Return the structured description of a finite state machine, null if it does not exist.
+    * @param type is FSM or FSM_CS.
+    */
+   fsm_descriptionConstRef get_FSM_description(NP_functionaly_type type) const;
+
    /**
     * Return true in case there exist a functionaly of the given type
     */
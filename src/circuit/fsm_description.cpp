@@ -0,0 +1,261 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file fsm_description.cpp
+ * @brief Structured representation of the finite state machine of a controller.
+ *
+ */
+#include "fsm_description.hpp"
+
+#include "exceptions.hpp"
+#include "string_manipulation.hpp"
+#include "utility.hpp"
+
+#include <boost/algorithm/string/erase.hpp>
+
+fsm_output_vector::fsm_output_vector(size_t size, output_value init)
+    : words((size + 31) / 32, 0ULL), n_outputs(size)
+{
+   if(init != ZERO)
+   {
+      for(size_t i = 0; i < n_outputs; ++i)
+      {
+         set(i, init);
+      }
+   }
+}
+
+bool fsm_output_vector::any() const
+{
+   for(const auto word : words)
+   {
+      if(word)
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+std::string fsm_output_vector::to_string() const
+{
+   static const char encoding[] = {'0', '1', '2', '-'};
+   std::string res(n_outputs, '0');
+   for(size_t i = 0; i < n_outputs; ++i)
+   {
+      res[i] = encoding[get(i)];
+   }
+   return res;
+}
+
+std::string fsm_guard::to_string() const
+{
+   if(terms.empty())
+   {
+      return "-";
+   }
+   std::string res;
+   for(const auto& t : terms)
+   {
+      if(!res.empty())
+      {
+         res += "|";
+      }
+      res += (t.is_bit_position ? "&" : "") + STR(t.value);
+   }
+   return res;
+}
+
+const std::string& fsm_description::get_reset_state() const
+{
+   THROW_ASSERT(!states.empty(), "Finite state machine without states");
+   return states.front().name;
+}
+
+std::string fsm_description::to_string() const
+{
+   std::string res = get_reset_state() + " " + reset_port + " " + start_port + " " + clock_port + ";\n";
+   bool first_io = true;
+   for(const auto& vio : bypass_signals)
+   {
+      if(!first_io)
+      {
+         res += ":";
+      }
+      first_io = false;
+      res += STR(vio.first) + "=";
+      bool first_vi = true;
+      for(const auto& vi : vio.second)
+      {
+         if(!first_vi)
+         {
+            res += ",";
+         }
+         first_vi = false;
+         res += vi.first + ">" + container_to_string(vi.second, "<");
+      }
+   }
+   res += ";\n";
+   for(const auto& state : states)
+   {
+      res += state.name + " " + state.outputs.to_string();
+      for(const auto& transition : state.transitions)
+      {
+         res += " : ";
+         bool first_guard = true;
+         for(const auto& guard : transition.guards)
+         {
+            if(!first_guard)
+            {
+               res += ",";
+            }
+            first_guard = false;
+            res += guard.to_string();
+         }
+         res += " " + transition.next_state + " " + transition.outputs.to_string();
+      }
+      res += "; \n";
+   }
+   return res;
+}
+
+static fsm_output_vector parse_output_vector(const std::string& outputs)
+{
+   fsm_output_vector res(outputs.size());
+   for(size_t i = 0; i < outputs.size(); ++i)
+   {
+      switch(outputs[i])
+      {
+         case '0':
+            break;
+         case '1':
+            res.set(i, fsm_output_vector::ONE);
+            break;
+         case '2':
+            res.set(i, fsm_output_vector::UNDEFINED);
+            break;
+         case '-':
+            res.set(i, fsm_output_vector::DONT_CARE);
+            break;
+         default:
+            THROW_ERROR("Malformed FSM output vector: " + outputs);
+      }
+   }
+   return res;
+}
+
+fsm_guard fsm_guard::parse(const std::string& guard)
+{
+   fsm_guard res;
+   if(guard == "-")
+   {
+      return res;
+   }
+   for(const auto& alternative : string_to_container<std::vector<std::string>>(guard, "|", false))
+   {
+      const auto is_bit_position = !alternative.empty() && alternative.front() == '&';
+      const auto value = is_bit_position ? alternative.substr(1) : alternative;
+      /// bit positions are non-negative, compared values may be negative
+      const auto digits = !is_bit_position && !value.empty() && value.front() == '-' ? value.substr(1) : value;
+      if(digits.empty() || digits.find_first_not_of("0123456789") != std::string::npos)
+      {
+         THROW_ERROR("Malformed FSM guard: " + guard);
+      }
+      res.terms.push_back(fsm_guard::term{is_bit_position, integer_cst_t(value)});
+   }
+   return res;
+}
+
+fsm_descriptionRef fsm_description::parse(const std::string& description)
+{
+   const auto fsm_desc = boost::algorithm::erase_all_copy(description, "\n");
+   const auto lines = string_to_container<std::vector<std::string>>(fsm_desc, ";", false);
+   THROW_ASSERT(lines.size() > 2, "Expected more than one ';' in the FSM specification (the first is the reset)");
+
+   const fsm_descriptionRef fsm(new fsm_description());
+   const auto header = string_to_container<std::vector<std::string>>(lines.at(0), " ");
+   THROW_ASSERT(header.size() == 4,
+                "Wrong FSM description: expected reset state, reset port, start port and clock port: " + lines.at(0));
+   fsm->reset_port = header.at(1);
+   fsm->start_port = header.at(2);
+   fsm->clock_port = header.at(3);
+
+   for(const auto& assign : string_to_container<std::vector<std::string>>(lines.at(1), ":"))
+   {
+      const auto AssignPair = string_to_container<std::vector<std::string>>(assign, "=");
+      THROW_ASSERT(AssignPair.size() == 2, "malformed FSM description " + STR(AssignPair.size()));
+      const auto out = static_cast<unsigned>(std::stoul(AssignPair.at(0)));
+      for(const auto& inState : string_to_container<std::vector<std::string>>(AssignPair.at(1), ","))
+      {
+         const auto StateInsPair = string_to_container<std::vector<std::string>>(inState, ">");
+         THROW_ASSERT(StateInsPair.size() == 2, "malformed FSM description " + STR(StateInsPair.size()));
+         for(const auto& in : string_to_container<std::vector<std::string>>(StateInsPair.at(1), "<"))
+         {
+            fsm->bypass_signals[out][StateInsPair.at(0)].insert(static_cast<unsigned>(std::stoul(in)));
+         }
+      }
+   }
+
+   for(auto it = lines.cbegin() + 2; it + 1 != lines.cend(); ++it)
+   {
+      const auto state_tokens = string_to_container<std::vector<std::string>>(*it, ":");
+      const auto state_desc = string_to_container<std::vector<std::string>>(state_tokens.at(0), " ");
+      THROW_ASSERT(state_desc.size() == 2, "Bad state format: " + *it);
+      fsm_state state;
+      state.name = state_desc.at(0);
+      state.outputs = parse_output_vector(state_desc.at(1));
+      for(auto tr_it = state_tokens.cbegin() + 1; tr_it != state_tokens.cend(); ++tr_it)
+      {
+         const auto transition_desc = string_to_container<std::vector<std::string>>(*tr_it, " ");
+         THROW_ASSERT(transition_desc.size() == 2 || transition_desc.size() == 3, "Bad transition format: " + *tr_it);
+         fsm_transition transition;
+         auto tok = transition_desc.cbegin();
+         if(transition_desc.size() == 3)
+         {
+            for(const auto& guard : string_to_container<std::vector<std::string>>(*tok, ","))
+            {
+               transition.guards.push_back(fsm_guard::parse(guard));
+            }
+            ++tok;
+         }
+         transition.next_state = *tok;
+         ++tok;
+         transition.outputs = parse_output_vector(*tok);
+         state.transitions.push_back(std::move(transition));
+      }
+      fsm->states.push_back(std::move(state));
+   }
+   THROW_ASSERT(!fsm->states.empty() && header.at(0) == fsm->get_reset_state(),
+                "reset state and first state has to be the same " + header.at(0));
+   return fsm;
+}
@@ -0,0 +1,231 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file fsm_description.hpp
+ * @brief Structured representation of the finite state machine of a controller.
+ *
+ */
+#ifndef FSM_DESCRIPTION_HPP
+#define FSM_DESCRIPTION_HPP
+
+#include "panda_types.hpp"
+#include "refcount.hpp"
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+REF_FORWARD_DECL(fsm_description);
+CONSTREF_FORWARD_DECL(fsm_description);
+
+/**
+ * Output values of a state or of a transition of a finite state machine.
+ * Each value is packed on two bits, so that controllers with wide output vectors are kept compact.
+ */
+class fsm_output_vector
+{
+ public:
+   /// the values an output may take
+   enum output_value : unsigned char
+   {
+      ZERO = 0,
+      ONE = 1,
+      UNDEFINED = 2, ///< the output may be driven to X
+      DONT_CARE = 3  ///< the output keeps the value defined by the present state
+   };
+
+ private:
+   /// packed values: 32 outputs per word
+   std::vector<unsigned long long> words;
+
+   /// number of outputs
+   size_t n_outputs;
+
+ public:
+   /**
+    * Constructor
+    * @param size is the number of outputs
+    * @param init is the initial value of all the outputs
+    */
+   explicit fsm_output_vector(size_t size = 0, output_value init = ZERO);
+
+   /**
+    * Return the number of outputs
+    */
+   size_t size() const
+   {
+      return n_outputs;
+   }
+
+   /**
+    * Return the value of the i-th output
+    */
+   output_value get(size_t i) const
+   {
+      return static_cast<output_value>((words[i / 32] >> (2 * (i % 32))) & 3ULL);
+   }
+
+   /**
+    * Set the value of the i-th output
+    */
+   void set(size_t i, output_value value)
+   {
+      auto& word = words[i / 32];
+      word = (word & ~(3ULL << (2 * (i % 32)))) | (static_cast<unsigned long long>(value) << (2 * (i % 32)));
+   }
+
+   /**
+    * Return true if at least one output is not ZERO
+    */
+   bool any() const;
+
+   /**
+    * Return the textual encoding of the vector: one character among '0', '1', '2' and '-' for each output
+    */
+   std::string to_string() const;
+};
+
+/**
+ * Condition checked by a transition on a single input of the finite state machine.
+ * The condition holds when the input matches at least one of the terms; an empty condition always holds.
+ */
+struct fsm_guard
+{
+   /// a single alternative of the condition
+   struct term
+   {
+      /// when true the input is one-hot encoded and the term checks the bit at position value; otherwise the input
+      /// must be equal to value
+      bool is_bit_position;
+
+      /// the compared value or the checked bit position; case labels may be wider than 64 bits
+      integer_cst_t value;
+   };
+
+   /// the alternatives of the condition
+   std::vector<term> terms;
+
+   /**
+    * Return true if the input is not checked
+    */
+   bool is_dont_care() const
+   {
+      return terms.empty();
+   }
+
+   /**
+    * Return the textual encoding of the condition (e.g., "-", "1", "&3|&5")
+    */
+   std::string to_string() const;
+
+   /**
+    * Build a condition from its textual encoding
+    * @param guard is the encoding produced by to_string
+    */
+   static fsm_guard parse(const std::string& guard);
+};
+
+/**
+ * Transition between two states of the finite state machine.
+ */
+struct fsm_transition
+{
+   /// one condition for each control input of the finite state machine (clock, reset, start and selector excluded)
+   std::vector<fsm_guard> guards;
+
+   /// the name of the target state
+   std::string next_state;
+
+   /// the outputs asserted during the transition (the done port is the first one)
+   fsm_output_vector outputs;
+};
+
+/**
+ * State of the finite state machine.
+ */
+struct fsm_state
+{
+   /// the name of the state
+   std::string name;
+
+   /// the outputs asserted in the state (the done port is the first one)
+   fsm_output_vector outputs;
+
+   /// the outgoing transitions, in priority order; the last one is the default transition
+   std::vector<fsm_transition> transitions;
+};
+
+/**
+ * Finite state machine of a controller, as produced by the controller creation and consumed by the HDL writers.
+ */
+class fsm_description
+{
+ public:
+   /// name of the reset port
+   std::string reset_port;
+
+   /// name of the start port
+   std::string start_port;
+
+   /// name of the clock port
+   std::string clock_port;
+
+   /// the states of the machine; the first one is the reset state
+   std::vector<fsm_state> states;
+
+   /// for each output index, the states where the output is driven by the OR of a set of input ports
+   std::map<unsigned int, std::map<std::string, std::set<unsigned int>>> bypass_signals;
+
+   /**
+    * Return the name of the reset state
+    */
+   const std::string& get_reset_state() const;
+
+   /**
+    * Return the textual representation of the finite state machine (for debug purpose)
+    */
+   std::string to_string() const;
+
+   /**
+    * Build a finite state machine from its textual representation
+    * @param description is the description produced by to_string
+    */
+   static fsm_descriptionRef parse(const std::string& description);
+};
+
+using fsm_descriptionRef = refcount<fsm_description>;
+using fsm_descriptionConstRef = refcount<const fsm_description>;
+
+#endif
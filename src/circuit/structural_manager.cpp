@@ -554,6 +554,17 @@ void structural_manager::add_NP_functionality(structural_objectRef cir, NP_funct
    com->set_NP_functionality(f);
 }
 
+void structural_manager::add_NP_functionality(structural_objectRef cir, NP_functionality::NP_functionaly_type dt,
+                                              const fsm_descriptionConstRef& fsm)
+{
+   THROW_ASSERT((cir->get_kind() == component_o_K), "Only components can have a Non SystemC functionality");
+   const auto com = GetPointer<module>(cir);
+   NP_functionalityRef f =
+       (com->get_NP_functionality() ? com->get_NP_functionality() : NP_functionalityRef(new NP_functionality));
+   f->add_FSM_description(dt, fsm);
+   com->set_NP_functionality(f);
+}
+
 void structural_manager::SetParameter(const std::string& name, const std::string& value)
 {
    THROW_ASSERT((get_circ()->get_kind() == component_o_K), "Only components can have a Non SystemC functionality");
@@ -286,6 +286,15 @@ class structural_manager
    static void add_NP_functionality(structural_objectRef cir, NP_functionality::NP_functionaly_type dt,
                                     std::string functionality_description);
 
+   /**
+    * Add the structured description of a finite state machine.
+    * @param cir is the controller module.
+    * @param dt is FSM or FSM_CS.
+    * @param fsm is the finite state machine.
+    */
+   static void add_NP_functionality(structural_objectRef cir, NP_functionality::NP_functionaly_type dt,
+                                    const fsm_descriptionConstRef& fsm);
+
    /**
     * Specify a parameter for the top module
     * @param name is the parameter name
@@ -47,12 +47,27 @@
 /// The default average number of iterations
 #define NUM_CST_host_profiling_avg_iterations_number 100
 
+/// The kind of the block of the binary profile storing the executions of the basic blocks of a function
+#define NUM_CST_host_profiling_bb_block 1
+
+/// The kind of the block of the binary profile storing the executions of the edges of a function
+#define NUM_CST_host_profiling_edge_block 2
+
+/// The kind of the block of the binary profile storing the trip counts of a loop
+#define NUM_CST_host_profiling_loop_block 3
+
+/// The number of bins of the trip count histograms (bin i counts the loop executions with [2^i, 2^(i+1)) iterations)
+#define NUM_CST_host_profiling_trip_bins 64
+
 /// The string identifing the beginning of a loop execution
 #define STR_CST_host_profiling_begin "begin"
 
 /// The file where profiling data are written by instrumented executable
 #define STR_CST_host_profiling_data "profile.dat"
 
+/// The environment variable from which the instrumented executable reads the path of the profiling data file
+#define STR_CST_host_profiling_data_env "BAMBU_HOST_PROFILING_DATA"
+
 /// The instrumented file for data memory profiling
 #define STR_CST_host_profiling_data_memory_profiling "data_memory_profiling.c"
 
@@ -74,6 +89,9 @@
 /// The function to insert entry in memory profiling data map
 #define STR_CST_host_profiling_map_insert "__map_insert"
 
+/// The header of the binary profile written by the instrumented executable (the string terminator is not written)
+#define STR_CST_host_profiling_magic "BAMBUHP1"
+
 /// The instrumented file for memory profiling
 #define STR_CST_host_profiling_memory_profiling "memory_profiling.c"
 
@@ -47,15 +47,35 @@
 #include "hls_manager.hpp"
 #include "host_profiling_constants.hpp"
 #include "indented_output_stream.hpp"
+#include "loop.hpp"
+#include "loops.hpp"
 #include "string_manipulation.hpp"
 #include "tree_basic_block.hpp"
 #include "tree_manager.hpp"
 #include "tree_node.hpp"
 
+#include <algorithm>
+
+/*
+ * Return true if a basic block belonging to loop bb_loop_id is inside loop loop_id (possibly in a nested loop)
+ */
+static bool is_inside_loop(const LoopsConstRef& loops, const unsigned int bb_loop_id, const unsigned int loop_id)
+{
+   for(LoopConstRef loop = loops->CGetLoop(bb_loop_id); loop; loop = loop->Parent())
+   {
+      if(loop->GetId() == loop_id)
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
 BasicBlocksProfilingCWriter::BasicBlocksProfilingCWriter(const HLS_managerConstRef _HLSMgr,
                                                          const InstructionWriterRef _instruction_writer,
                                                          const IndentedOutputStreamRef _indented_output_stream)
-    : EdgeCWriter(_HLSMgr, _instruction_writer, _indented_output_stream)
+    : EdgeCWriter(_HLSMgr, _instruction_writer, _indented_output_stream),
+      extended(Param->isOption(OPT_host_profiling_extended) && Param->getOption<bool>(OPT_host_profiling_extended))
 {
    debug_level = _HLSMgr->get_parameter()->get_class_debug_level(GET_CLASS(*this));
 }
@@ -79,9 +99,35 @@ void BasicBlocksProfilingCWriter::print_loop_starting(EdgeDescriptor e)
 
 void BasicBlocksProfilingCWriter::print_edge(EdgeDescriptor e, unsigned int)
 {
-   const auto target_id = support_cfg->CGetBBNodeInfo(boost::target(e, *support_cfg))->block->number;
-   const auto function_name = HLSMgr->CGetFunctionBehavior(fun_id)->CGetBehavioralHelper()->get_function_name();
+   const auto source_info = support_cfg->CGetBBNodeInfo(boost::source(e, *support_cfg));
+   const auto target_info = support_cfg->CGetBBNodeInfo(boost::target(e, *support_cfg));
+   const auto target_id = target_info->block->number;
+   const auto function_behavior = HLSMgr->CGetFunctionBehavior(fun_id);
+   const auto function_name = function_behavior->CGetBehavioralHelper()->get_function_name();
    indented_output_stream->Append(function_name + "_counter[" + STR(target_id) + "]++;\n");
+   if(extended)
+   {
+      const auto& function_edges = edge_to_index.at(fun_id);
+      const auto edge_index = function_edges.find(std::make_pair(source_info->block->number, target_id));
+      if(edge_index != function_edges.end())
+      {
+         indented_output_stream->Append(function_name + "_edge_counter[" + STR(edge_index->second) + "]++;\n");
+      }
+      /// entering the header of a loop from outside closes the previous execution of the loop and starts a new one
+      if(target_info->loop_id == target_id && target_id)
+      {
+         const auto loop_index = fun_loop_to_index.at(fun_id).at(target_id);
+         if(is_inside_loop(function_behavior->CGetLoops(), source_info->loop_id, target_id))
+         {
+            indented_output_stream->Append("__bambu_hp_trip[" + STR(loop_index) + "]++;\n");
+         }
+         else
+         {
+            indented_output_stream->Append("_hp_trip_end_(" + STR(loop_index) + ");\n");
+            indented_output_stream->Append("__bambu_hp_trip[" + STR(loop_index) + "] = 1;\n");
+         }
+      }
+   }
    dumped_edges.insert(e);
 }
 
@@ -97,6 +143,7 @@ void BasicBlocksProfilingCWriter::InternalWriteGlobalDeclarations()
    indented_output_stream->Append("#include <stdio.h>\n");
    indented_output_stream->Append("\n");
    CustomOrderedSet<unsigned int> functions = HLSMgr->get_functions_with_body();
+   edge_to_index.clear();
    for(const auto function : functions)
    {
       const auto function_behavior = HLSMgr->CGetFunctionBehavior(function);
@@ -104,8 +151,72 @@ void BasicBlocksProfilingCWriter::InternalWriteGlobalDeclarations()
       const auto fd = GetPointer<const function_decl>(TM->GetTreeNode(function));
       const auto sl = GetPointer<statement_list>(fd->body);
       const auto biggest_bb_number = sl->list_of_bloc.rbegin()->first;
-      indented_output_stream->Append("int " + function_name + "_counter[" + STR(biggest_bb_number + 1) + "];\n");
+      indented_output_stream->Append("unsigned long long int " + function_name + "_counter[" +
+                                     STR(biggest_bb_number + 1) + "];\n");
+      if(extended)
+      {
+         /// edges are numbered in order of source and target basic block numbers
+         const auto fbb = function_behavior->CGetBBGraph(FunctionBehavior::FBB);
+         auto& function_edges = edge_to_index[function];
+         EdgeIterator ei, ei_end;
+         for(boost::tie(ei, ei_end) = boost::edges(*fbb); ei != ei_end; ++ei)
+         {
+            function_edges[std::make_pair(fbb->CGetBBNodeInfo(boost::source(*ei, *fbb))->block->number,
+                                          fbb->CGetBBNodeInfo(boost::target(*ei, *fbb))->block->number)] = 0;
+         }
+         std::string edge_bbs;
+         size_t edge_index = 0;
+         for(auto& function_edge : function_edges)
+         {
+            function_edge.second = edge_index++;
+            edge_bbs += (edge_bbs.empty() ? "" : ", ") + STR(function_edge.first.first) + ", " +
+                        STR(function_edge.first.second);
+         }
+         const auto n_edges = std::max<size_t>(function_edges.size(), 1);
+         indented_output_stream->Append("unsigned long long int " + function_name + "_edge_counter[" + STR(n_edges) +
+                                        "];\n");
+         indented_output_stream->Append("const unsigned int " + function_name + "_edge_bbs[" + STR(2 * n_edges) +
+                                        "] = {" + (edge_bbs.empty() ? std::string("0, 0") : edge_bbs) + "};\n");
+      }
    }
+   if(extended)
+   {
+      const auto n_loops = STR(std::max(counter, 1U));
+      indented_output_stream->Append("unsigned long long int __bambu_hp_trip[" + n_loops + "];\n");
+      indented_output_stream->Append("unsigned long long int __bambu_hp_trip_entries[" + n_loops + "];\n");
+      indented_output_stream->Append("unsigned long long int __bambu_hp_trip_total[" + n_loops + "];\n");
+      indented_output_stream->Append("unsigned long long int __bambu_hp_trip_max[" + n_loops + "];\n");
+      indented_output_stream->Append("unsigned long long int __bambu_hp_trip_hist[" + n_loops +
+                                     "][" + STR(NUM_CST_host_profiling_trip_bins) + "];\n");
+      indented_output_stream->Append(R"(void _hp_trip_end_(unsigned int loop) __attribute__ ((no_instrument_function));
+void _hp_trip_end_(unsigned int loop)
+{
+unsigned long long int trip = __bambu_hp_trip[loop];
+unsigned int bin = 0;
+if(!trip)
+   return;
+__bambu_hp_trip_entries[loop]++;
+__bambu_hp_trip_total[loop] += trip;
+if(trip > __bambu_hp_trip_max[loop])
+   __bambu_hp_trip_max[loop] = trip;
+while(trip >>= 1)
+   bin++;
+__bambu_hp_trip_hist[loop][bin]++;
+__bambu_hp_trip[loop] = 0;
+}
+)");
+   }
+   indented_output_stream->Append("void _hp_block_(FILE* h_file, unsigned int kind, unsigned int function, unsigned int "
+                                  "size) __attribute__ ((no_instrument_function));\n");
+   indented_output_stream->Append(R"(void _hp_block_(FILE* h_file, unsigned int kind, unsigned int function, unsigned int size)
+{
+unsigned int header[3];
+header[0] = kind;
+header[1] = function;
+header[2] = size;
+fwrite(header, sizeof(unsigned int), 3, h_file);
+}
+)");
    indented_output_stream->Append("void _init_tp() __attribute__ ((no_instrument_function, constructor));\n");
    indented_output_stream->Append("void _init_tp()\n");
    indented_output_stream->Append("{\n");
@@ -121,23 +232,58 @@ void BasicBlocksProfilingCWriter::InternalWriteGlobalDeclarations()
       indented_output_stream->Append("   " + function_name + "_counter[i] = 0;\n");
    }
    indented_output_stream->Append("}\n");
+   /// the profile is written in the byte order of the host, which is also the one reading it back
    indented_output_stream->Append("void _end_tp() __attribute__ ((no_instrument_function, destructor));\n");
    indented_output_stream->Append("void _end_tp()\n");
    indented_output_stream->Append("{\n");
-   indented_output_stream->Append("FILE* h_file = fopen(\"" +
-                                  Param->getOption<std::string>(OPT_output_temporary_directory) +
-                                  "/" STR_CST_host_profiling_data "\", \"w\");\n");
-   indented_output_stream->Append("int i = 0;\n");
+   /// the path of the profile is not part of the instrumented source, so that the source identifies the run in the
+   /// host profiling cache independently of the temporary directory
+   indented_output_stream->Append("const char* h_file_name = getenv(\"" STR_CST_host_profiling_data_env "\");\n");
+   indented_output_stream->Append("FILE* h_file = fopen(h_file_name ? h_file_name : \"" STR_CST_host_profiling_data
+                                  "\", \"wb\");\n");
+   indented_output_stream->Append("fwrite(\"" STR_CST_host_profiling_magic "\", 1, " +
+                                  STR(sizeof(STR_CST_host_profiling_magic) - 1) + ", h_file);\n");
    for(const auto function : functions)
    {
       const auto function_behavior = HLSMgr->CGetFunctionBehavior(function);
       const auto function_name = function_behavior->CGetBehavioralHelper()->get_function_name();
       const auto fd = GetPointer<const function_decl>(TM->GetTreeNode(function));
       const auto sl = GetPointer<statement_list>(fd->body);
-      const auto biggest_bb_number = sl->list_of_bloc.rbegin()->first;
-      indented_output_stream->Append(R"(fprintf(h_file, "Function %d\n", )" + STR(function) + ");\n");
-      indented_output_stream->Append("for(i = 0; i < " + STR(biggest_bb_number + 1) + "; i++)\n");
-      indented_output_stream->Append(R"(   fprintf(h_file, "%d %d\n", i, )" + function_name + "_counter[i]);\n");
+      const auto biggest_bb_number = STR(sl->list_of_bloc.rbegin()->first + 1);
+      indented_output_stream->Append("_hp_block_(h_file, " + STR(NUM_CST_host_profiling_bb_block) + ", " +
+                                     STR(function) + ", " + biggest_bb_number + ");\n");
+      indented_output_stream->Append("fwrite(" + function_name + "_counter, sizeof(unsigned long long int), " +
+                                     biggest_bb_number + ", h_file);\n");
+      if(extended)
+      {
+         const auto n_edges = STR(edge_to_index.at(function).size());
+         indented_output_stream->Append("_hp_block_(h_file, " + STR(NUM_CST_host_profiling_edge_block) + ", " +
+                                        STR(function) + ", " + n_edges + ");\n");
+         indented_output_stream->Append("fwrite(" + function_name + "_edge_bbs, sizeof(unsigned int), 2 * " +
+                                        n_edges + ", h_file);\n");
+         indented_output_stream->Append("fwrite(" + function_name + "_edge_counter, sizeof(unsigned long long int), " +
+                                        n_edges + ", h_file);\n");
+         for(const auto& loop : fun_loop_to_index.at(function))
+         {
+            if(!loop.first)
+            {
+               continue;
+            }
+            const auto loop_index = STR(loop.second);
+            indented_output_stream->Append("_hp_trip_end_(" + loop_index + ");\n");
+            indented_output_stream->Append("_hp_block_(h_file, " + STR(NUM_CST_host_profiling_loop_block) + ", " +
+                                           STR(function) + ", " + STR(loop.first) + ");\n");
+            indented_output_stream->Append("fwrite(&__bambu_hp_trip_entries[" + loop_index +
+                                           "], sizeof(unsigned long long int), 1, h_file);\n");
+            indented_output_stream->Append("fwrite(&__bambu_hp_trip_total[" + loop_index +
+                                           "], sizeof(unsigned long long int), 1, h_file);\n");
+            indented_output_stream->Append("fwrite(&__bambu_hp_trip_max[" + loop_index +
+                                           "], sizeof(unsigned long long int), 1, h_file);\n");
+            indented_output_stream->Append("fwrite(__bambu_hp_trip_hist[" + loop_index +
+                                           "], sizeof(unsigned long long int), " +
+                                           STR(NUM_CST_host_profiling_trip_bins) + ", h_file);\n");
+         }
+      }
    }
    indented_output_stream->Append("fclose(h_file);\n");
 
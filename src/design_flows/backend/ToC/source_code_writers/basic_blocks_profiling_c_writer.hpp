@@ -44,11 +44,20 @@
 
 #include "edge_c_writer.hpp"
 
+#include <map>
+#include <utility>
+
 /**
  * Class use to write the C code with instruented edges for basic blocks profiling
  */
 class BasicBlocksProfilingCWriter final : public EdgeCWriter
 {
+   /// True if the executions of the edges and the trip counts of the loops have to be profiled too
+   const bool extended;
+
+   /// For each function, the index of the counter of each edge identified by source and target basic block numbers
+   std::map<unsigned int, std::map<std::pair<unsigned int, unsigned int>, size_t>> edge_to_index;
+
    /**
     * Dump operations requested for record information about a loop path which ends
     * @param e is the feedback or outgoing edge
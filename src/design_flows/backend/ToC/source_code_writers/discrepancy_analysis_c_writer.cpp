@@ -46,6 +46,7 @@
 #include "c_backend_information.hpp"
 #include "call_graph.hpp"
 #include "call_graph_manager.hpp"
+#include "discrepancy_trace.hpp"
 #include "fu_binding.hpp"
 #include "hls.hpp"
 #include "hls_manager.hpp"
@@ -97,6 +98,17 @@ static inline bool is_large_integer(const tree_nodeConstRef& tn)
    return false;
 }
 
+/*
+ * Return the C statement appending a record to the binary discrepancy trace
+ * (see discrepancy_trace.hpp for the layout)
+ */
+static inline std::string trace_record(enum discrepancy_trace_record_kind kind, const std::string& id,
+                                       const std::string& value)
+{
+   return "_DiscrRecord_(__bambu_discrepancy_fp, " + STR(static_cast<unsigned int>(kind)) + ", " + id + ", " + value +
+          ");\n";
+}
+
 DiscrepancyAnalysisCWriter::DiscrepancyAnalysisCWriter(const CBackendInformationConstRef _c_backend_information,
                                                        const HLS_managerConstRef _HLSMgr,
                                                        const InstructionWriterRef _instruction_writer,
@@ -113,36 +125,40 @@ DiscrepancyAnalysisCWriter::DiscrepancyAnalysisCWriter(const CBackendInformation
 void DiscrepancyAnalysisCWriter::InternalInitialize()
 {
    CWriter::InternalInitialize();
+   Discrepancy->c_op_descriptors.clear();
 }
 
 void DiscrepancyAnalysisCWriter::WriteTestbenchHelperFunctions()
 {
    // exit function
    indented_output_stream->Append(R"(
-void _Dec2Bin_(FILE* __bambu_testbench_fp, long long int num, unsigned int precision)
+void _DiscrRecord_(FILE* __bambu_testbench_fp, unsigned int kind, unsigned int id, unsigned long long int value)
 {
+unsigned char record[16];
 unsigned int i;
-unsigned long long int ull_value = (unsigned long long int)num;
-for(i = 0; i < precision; ++i)
-   fprintf(__bambu_testbench_fp, "%c", (((1LLU << (precision - i - 1)) & ull_value) ? '1' : '0'));
+for(i = 0; i < 4; ++i)
+{
+   record[i] = (unsigned char)(kind >> (8 * i));
+   record[4 + i] = (unsigned char)(id >> (8 * i));
+}
+for(i = 0; i < 8; ++i)
+   record[8 + i] = (unsigned char)(value >> (8 * i));
+fwrite(record, 1, sizeof(record), __bambu_testbench_fp);
 }
 
-void _Ptd2Bin_(FILE* __bambu_testbench_fp, unsigned char* num, unsigned int precision)
+void _Dec2Raw_(FILE* __bambu_testbench_fp, long long int num, unsigned int precision)
 {
-unsigned int i, j;
-char value;
-if(precision % 8)
-{
-value = *(num + precision / 8);
-for(j = 8 - precision % 8; j < 8; ++j)
-   fprintf(__bambu_testbench_fp, "%c", (((1LLU << (8 - j - 1)) & value) ? '1' : '0'));
+unsigned char bytes[8];
+unsigned int i;
+unsigned long long int ull_value = (unsigned long long int)num;
+for(i = 0; i < (precision + 7) / 8; ++i)
+   bytes[i] = (unsigned char)(ull_value >> (8 * i));
+fwrite(bytes, 1, (precision + 7) / 8, __bambu_testbench_fp);
 }
-for(i = 0; i < 8 * (precision / 8); i = i + 8)
+
+void _Ptd2Raw_(FILE* __bambu_testbench_fp, unsigned char* num, unsigned int precision)
 {
-value = *(num + (precision / 8) - (i / 8) - 1);
-for(j = 0; j < 8; ++j)
-   fprintf(__bambu_testbench_fp, "%c", (((1LLU << (8 - j - 1)) & value) ? '1' : '0'));
-}
+fwrite(num, 1, (precision + 7) / 8, __bambu_testbench_fp);
 }
 
 float _Int32_ViewConvert(unsigned int i)
@@ -337,7 +353,7 @@ void DiscrepancyAnalysisCWriter::writePreInstructionInfo(const FunctionBehaviorC
    const auto kind = curr_tn->get_kind();
    if(kind == gimple_return_K)
    {
-      indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"CONTEXT_END\\n\");\n");
+      indented_output_stream->Append(trace_record(DISCR_TRACE_CONTEXT_END, "0", "0"));
    }
    else if(kind == gimple_call_K)
    {
@@ -355,13 +371,13 @@ void DiscrepancyAnalysisCWriter::writePreInstructionInfo(const FunctionBehaviorC
           * When a function is called with a function pointer we always need to
           * have its C source code, so it always has to be printed back in C.
           */
-         indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"CALL_ID " + STR(st_tn_id) + "\\n\");\n");
+         indented_output_stream->Append(trace_record(DISCR_TRACE_CALL, STR(st_tn_id), "0"));
          return;
       }
       const BehavioralHelperConstRef BH = HLSMgr->CGetFunctionBehavior(called_id)->CGetBehavioralHelper();
       if(BH->has_implementation() && BH->function_has_to_be_printed(called_id))
       {
-         indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"CALL_ID " + STR(st_tn_id) + "\\n\");\n");
+         indented_output_stream->Append(trace_record(DISCR_TRACE_CALL, STR(st_tn_id), "0"));
       }
    }
    else if(kind == gimple_assign_K)
@@ -377,7 +393,7 @@ void DiscrepancyAnalysisCWriter::writePreInstructionInfo(const FunctionBehaviorC
          const BehavioralHelperConstRef BH = HLSMgr->CGetFunctionBehavior(called_id)->CGetBehavioralHelper();
          if(BH->has_implementation() && BH->function_has_to_be_printed(called_id))
          {
-            indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"CALL_ID " + STR(st_tn_id) + "\\n\");\n");
+            indented_output_stream->Append(trace_record(DISCR_TRACE_CALL, STR(st_tn_id), "0"));
          }
       }
    }
@@ -512,73 +528,44 @@ void DiscrepancyAnalysisCWriter::writePostInstructionInfo(const FunctionBehavior
       }
       Discrepancy->n_checked_operations++;
       /*
-       * print statements to print information on the instruction
+       * collect the static information on the operation: it is stored in
+       * the descriptors of the trace, so that only its index and the
+       * assigned value have to be written at runtime
        */
-      indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"INSTR stg_id " + STR(funId) + " op_id " +
-                                     STR(instrGraph->CGetOpNodeInfo(statement)->GetNodeId()));
-
-      if(oper->is_bounded())
-      {
-         indented_output_stream->Append(" B ");
-         indented_output_stream->Append(STR(oper->time_m->get_cycles()));
-      }
-      else
-      {
-         indented_output_stream->Append(" U");
-      }
-      indented_output_stream->Append("\\n\");\n");
+      DiscrepancyOpInfo op_info;
+      op_info.stg_fun_id = funId;
+      op_info.op_id = instrGraph->CGetOpNodeInfo(statement)->GetNodeId();
+      op_info.is_bounded_op = oper->is_bounded();
+      op_info.n_cycles = oper->is_bounded() ? oper->time_m->get_cycles() : 0;
 
       /*
-       * collect information on the scheduling of the operation to be printed
+       * collect information on the scheduling of the operation
        */
       const auto STGMan = hls->STG;
       const auto stg_info = STGMan->CGetStg()->CGetStateTransitionGraphInfo();
 
-      CustomOrderedSet<unsigned int> init_state_ids;
-      CustomOrderedSet<unsigned int> exec_state_ids;
-      CustomOrderedSet<unsigned int> end_state_ids;
-
       for(const auto& s : STGMan->get_starting_states(statement))
       {
-         init_state_ids.insert(stg_info->vertex_to_state_id.at(s));
+         op_info.start_states.insert(stg_info->vertex_to_state_id.at(s));
       }
       for(const auto& s : STGMan->get_execution_states(statement))
       {
-         exec_state_ids.insert(stg_info->vertex_to_state_id.at(s));
+         op_info.exec_states.insert(stg_info->vertex_to_state_id.at(s));
       }
       for(const auto& s : STGMan->get_ending_states(statement))
       {
-         end_state_ids.insert(stg_info->vertex_to_state_id.at(s));
+         op_info.end_states.insert(stg_info->vertex_to_state_id.at(s));
       }
 
-      THROW_ASSERT(!init_state_ids.empty(), "operation not properly scheduled: "
-                                            "number of init states = " +
-                                                STR(init_state_ids.size()));
-      THROW_ASSERT(!exec_state_ids.empty(), "operation not properly scheduled: "
-                                            "number of exec states = " +
-                                                STR(exec_state_ids.size()));
-      THROW_ASSERT(!end_state_ids.empty(), "operation not properly scheduled: "
-                                           "number of ending states = " +
-                                               STR(end_state_ids.size()));
-      /*
-       * print statements to print scheduling information on the operation
-       */
-      indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"SCHED start");
-      for(const auto& s : init_state_ids)
-      {
-         indented_output_stream->Append(" " + STR(s));
-      }
-      indented_output_stream->Append("; exec");
-      for(const auto& s : exec_state_ids)
-      {
-         indented_output_stream->Append(" " + STR(s));
-      }
-      indented_output_stream->Append("; end");
-      for(const auto& s : end_state_ids)
-      {
-         indented_output_stream->Append(" " + STR(s));
-      }
-      indented_output_stream->Append(";\\n\");\n");
+      THROW_ASSERT(!op_info.start_states.empty(), "operation not properly scheduled: "
+                                                  "number of init states = " +
+                                                      STR(op_info.start_states.size()));
+      THROW_ASSERT(!op_info.exec_states.empty(), "operation not properly scheduled: "
+                                                 "number of exec states = " +
+                                                     STR(op_info.exec_states.size()));
+      THROW_ASSERT(!op_info.end_states.empty(), "operation not properly scheduled: "
+                                                "number of ending states = " +
+                                                    STR(op_info.end_states.size()));
 
       const auto ssa_type = tree_helper::CGetType(ssa);
       const auto type_bitsize = tree_helper::SizeAlloc(ssa_type);
@@ -589,35 +576,17 @@ void DiscrepancyAnalysisCWriter::writePostInstructionInfo(const FunctionBehavior
          THROW_ERROR(std::string("variable size mismatch: ") + "ssa node id = " + STR(ssa->index) + " has size = " +
                      STR(ssa_bitsize) + " type node id = " + STR(ssa_type->index) + " has size = " + STR(type_bitsize));
       }
-      /* tree_nodeRef for gimple lvalue */
-      indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, "
-                                     "\"ASSIGN ssa_id " +
-                                     STR(ssa->index) + "; ssa " + var_name + "; btsz " + STR(ssa_bitsize) +
-                                     "; val #\");\n");
 
       const bool is_real = tree_helper::IsRealType(ssa_type);
       const bool is_vector = tree_helper::IsVectorType(ssa_type);
       const bool is_complex = tree_helper::IsComplexType(ssa_type);
 
-      if(is_real || is_complex || is_vector || tree_helper::IsStructType(ssa_type) ||
-         tree_helper::IsUnionType(ssa_type) || is_large_integer(ssa_type))
-      {
-         indented_output_stream->Append("_Ptd2Bin_(__bambu_discrepancy_fp, (unsigned char*)&" + var_name + ", " +
-                                        STR(type_bitsize) + ");\n");
-      }
-      else
-      {
-         indented_output_stream->Append("_Dec2Bin_(__bambu_discrepancy_fp, " + var_name + ", " + STR(type_bitsize) +
-                                        ");\n");
-      }
-
-      indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"; type ");
-
       THROW_ASSERT(!(is_discrepancy_address && (is_real || is_complex)),
                    "variable " + STR(var_name) + " with node id " + STR(ssa->index) + " has type id = " +
                        STR(ssa_type->index) + " is complex = " + STR(is_complex) + " is real = " + STR(is_real));
 
       auto vec_base_bitsize = type_bitsize;
+      op_info.type = DISCR_NONE;
       if(is_vector)
       {
          THROW_ASSERT(ssa_bitsize == type_bitsize,
@@ -630,46 +599,48 @@ void DiscrepancyAnalysisCWriter::writePostInstructionInfo(const FunctionBehavior
                           " type_bitsize = " + STR(type_bitsize) + " elem_bitsize = " + STR(elem_bitsize));
 
          vec_base_bitsize = elem_bitsize;
-         indented_output_stream->Append("V ");
-      }
-      else
-      {
-         indented_output_stream->Append("NV ");
+         op_info.type |= DISCR_VECTOR;
       }
-      indented_output_stream->Append(STR(vec_base_bitsize));
-
       if(is_complex)
       {
          THROW_ASSERT(vec_base_bitsize % 2 == 0, "complex variables must have size multiple of 2"
                                                  "\nssa node id = " +
                                                      STR(ssa->index) + "\ntype node id = " + STR(ssa_type->index) +
                                                      "\nvec_base_bitsize = " + STR(vec_base_bitsize));
-         indented_output_stream->Append(" C ");
-      }
-      else
-      {
-         indented_output_stream->Append(" NC ");
+         op_info.type |= DISCR_COMPLEX;
       }
-
       if(is_real)
       {
-         indented_output_stream->Append("R ");
+         op_info.type |= DISCR_REAL;
       }
-      else
+      if(is_discrepancy_address)
       {
-         indented_output_stream->Append("NR ");
+         op_info.type |= DISCR_ADDR;
       }
+      op_info.ssa_name_node_id = ssa->index;
+      op_info.ssa_name = var_name;
+      op_info.bitsize = static_cast<unsigned int>(ssa_bitsize);
+      op_info.vec_base_bitsize = static_cast<unsigned int>(vec_base_bitsize);
 
-      if(is_discrepancy_address)
+      /*
+       * print statements writing the record of the operation followed by
+       * the bytes of the assigned value
+       */
+      const auto descriptor_id = Discrepancy->c_op_descriptors.size();
+      Discrepancy->c_op_descriptors.emplace_back(op_info, static_cast<unsigned int>(type_bitsize));
+      indented_output_stream->Append(
+          trace_record(DISCR_TRACE_OP, STR(descriptor_id), "__bambu_discrepancy_local_context"));
+      if(is_real || is_complex || is_vector || tree_helper::IsStructType(ssa_type) ||
+         tree_helper::IsUnionType(ssa_type) || is_large_integer(ssa_type))
       {
-         indented_output_stream->Append("A");
+         indented_output_stream->Append("_Ptd2Raw_(__bambu_discrepancy_fp, (unsigned char*)&" + var_name + ", " +
+                                        STR(type_bitsize) + ");\n");
       }
       else
       {
-         indented_output_stream->Append("NA");
+         indented_output_stream->Append("_Dec2Raw_(__bambu_discrepancy_fp, " + var_name + ", " + STR(type_bitsize) +
+                                        ");\n");
       }
-
-      indented_output_stream->Append("\\n\");\n");
       /// check if we need to add a check for floating operation correctness
       if(g_as_node)
       {
@@ -867,7 +838,7 @@ long long unsigned int __bambu_discrepancy_temp_check_int_ssa = 0;
    indented_output_stream->Append("void __bambu_discrepancy_exit(void)\n");
    indented_output_stream->Append("{\n");
    indented_output_stream->Append("if (__standard_exit) {\n");
-   indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"CONTEXT_END\\n\");\n");
+   indented_output_stream->Append(trace_record(DISCR_TRACE_CONTEXT_END, "0", "0"));
    indented_output_stream->Append("}\n");
    indented_output_stream->Append("fflush(__bambu_discrepancy_fp);\n");
    indented_output_stream->Append("fclose(__bambu_discrepancy_fp);\n");
@@ -924,14 +895,16 @@ void DiscrepancyAnalysisCWriter::WriteExtraInitCode()
 
    indented_output_stream->Append("__standard_exit = 0;\n");
    indented_output_stream->Append("__bambu_discrepancy_fp = fopen(\"" + Discrepancy->c_trace_filename +
-                                  "\", \"w\");\n");
+                                  "\", \"wb\");\n");
    indented_output_stream->Append("if (!__bambu_discrepancy_fp) {\n");
    indented_output_stream->Append("perror(\"can't open file: " + Discrepancy->c_trace_filename + "\");\n");
    indented_output_stream->Append("exit(1);\n");
-   indented_output_stream->Append("}\n\n");
+   indented_output_stream->Append("}\n");
+   indented_output_stream->Append("setvbuf(__bambu_discrepancy_fp, NULL, _IOFBF, 1 << 20);\n");
+   indented_output_stream->Append("fwrite(\"" DISCREPANCY_TRACE_MAGIC "\", 1, " +
+                                  STR(DISCREPANCY_TRACE_MAGIC_SIZE) + ", __bambu_discrepancy_fp);\n\n");
 
-   indented_output_stream->Append(
-       "fprintf(__bambu_discrepancy_fp, \"CONTEXT LL_%llu\\n\", __bambu_discrepancy_context);\n");
+   indented_output_stream->Append(trace_record(DISCR_TRACE_ROOT_CONTEXT, "0", "__bambu_discrepancy_context"));
    if(Param->isOption(OPT_discrepancy_hw) && Param->getOption<bool>(OPT_discrepancy_hw))
    {
       /*
@@ -947,17 +920,17 @@ void DiscrepancyAnalysisCWriter::WriteExtraInitCode()
          const auto bitsize = tree_helper::SizeAlloc(var_node);
          THROW_ASSERT(bitsize % 8 == 0 || bitsize == 1,
                       "bitsize of a variable in memory must be multiple of 8 --> is " + STR(bitsize));
-         indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"VARDECL_ID " + STR(var_node->index) +
-                                        " VAR_ADDR LL_%lu\\n\", &" +
-                                        STR(behavioral_helper->PrintVariable(var_node->index)) + ");//size " +
-                                        STR(compute_n_bytes(bitsize)) + "\n");
+         indented_output_stream->Append(
+             trace_record(DISCR_TRACE_VARDECL, STR(var_node->index),
+                          "(size_t)&" + behavioral_helper->PrintVariable(var_node->index)) +
+             "//size " + STR(compute_n_bytes(bitsize)) + "\n");
       }
    }
 }
 
 void DiscrepancyAnalysisCWriter::WriteExtraCodeBeforeEveryMainCall()
 {
-   indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"CALL_ID 0\\n\");\n");
+   indented_output_stream->Append(trace_record(DISCR_TRACE_CALL, "0", "0"));
 }
 
 void DiscrepancyAnalysisCWriter::DeclareLocalVariables(const CustomSet<unsigned int>& to_be_declared,
@@ -967,11 +940,14 @@ void DiscrepancyAnalysisCWriter::DeclareLocalVariables(const CustomSet<unsigned
                                                        const var_pp_functorConstRef varFunc)
 {
    HLSCWriter::DeclareLocalVariables(to_be_declared, already_declared_variables, locally_declared_types, BH, varFunc);
-   indented_output_stream->Append("__bambu_discrepancy_context++;\n");
+   /*
+    * the context is also kept in a local variable, since the records of the
+    * operations must refer to it after the return from nested calls
+    */
+   indented_output_stream->Append(
+       "long long unsigned int __bambu_discrepancy_local_context = ++__bambu_discrepancy_context;\n");
    indented_output_stream->Append(
-       "fprintf(__bambu_discrepancy_fp, \"CONTEXT LL_%llu\\n\", __bambu_discrepancy_context);\n");
-   indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"CALLED_ID " + STR(BH->get_function_index()) +
-                                  "\\n\");\n");
+       trace_record(DISCR_TRACE_CONTEXT, STR(BH->get_function_index()), "__bambu_discrepancy_local_context"));
    if(Param->isOption(OPT_discrepancy_hw) && Param->getOption<bool>(OPT_discrepancy_hw))
    {
       /*
@@ -988,9 +964,9 @@ void DiscrepancyAnalysisCWriter::DeclareLocalVariables(const CustomSet<unsigned
          const auto bitsize = tree_helper::SizeAlloc(par);
          THROW_ASSERT(bitsize % 8 == 0 || bitsize == 1,
                       "bitsize of a variable in memory must be multiple of 8 --> is " + STR(bitsize));
-         indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"VARDECL_ID " + STR(par->index) +
-                                        " VAR_ADDR LL_%lu\\n\", &" + STR(BH->PrintVariable(par->index)) + ");//size " +
-                                        STR(compute_n_bytes(bitsize)) + "\n");
+         indented_output_stream->Append(trace_record(DISCR_TRACE_VARDECL, STR(par->index),
+                                                     "(size_t)&" + BH->PrintVariable(par->index)) +
+                                        "//size " + STR(compute_n_bytes(bitsize)) + "\n");
       }
    }
    for(const auto& var : to_be_declared)
@@ -1000,9 +976,9 @@ void DiscrepancyAnalysisCWriter::DeclareLocalVariables(const CustomSet<unsigned
          const auto bitsize = tree_helper::SizeAlloc(TM->GetTreeNode(var));
          THROW_ASSERT(bitsize % 8 == 0 || bitsize == 1,
                       "bitsize of a variable in memory must be multiple of 8 --> is " + STR(bitsize));
-         indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"VARDECL_ID " + STR(var) +
-                                        " VAR_ADDR LL_%lu\\n\", &" + STR(BH->PrintVariable(var)) + ");//size " +
-                                        STR(compute_n_bytes(bitsize)) + "\n");
+         indented_output_stream->Append(
+             trace_record(DISCR_TRACE_VARDECL, STR(var), "(size_t)&" + BH->PrintVariable(var)) + "//size " +
+             STR(compute_n_bytes(bitsize)) + "\n");
       }
    }
 }
@@ -1029,8 +1005,7 @@ void DiscrepancyAnalysisCWriter::WriteFunctionImplementation(unsigned int functi
 
 void DiscrepancyAnalysisCWriter::WriteBBHeader(const unsigned int bb_number, const unsigned int function_index)
 {
-   indented_output_stream->Append("fprintf(__bambu_discrepancy_fp, \"stg_id " + STR(function_index) + " BB " +
-                                  STR(bb_number) + "\\n\");\n");
+   indented_output_stream->Append(trace_record(DISCR_TRACE_BB, STR(function_index), STR(bb_number)));
 }
 
 void DiscrepancyAnalysisCWriter::WriteFunctionDeclaration(const unsigned int funId)
@@ -281,6 +281,11 @@ void MdpiWrapperCWriter::InternalWriteFile()
                const auto line_size = std::stoull(iface_attrs.at(FunctionArchitecture::iface_cache_line_size));
                return std::to_string(line_size * bus_size / 8ULL);
             }
+            if(iface_attrs.find(FunctionArchitecture::iface_burst_length) != iface_attrs.end())
+            {
+               const auto burst_length = std::stoull(iface_attrs.at(FunctionArchitecture::iface_burst_length));
+               return std::to_string(burst_length * std::stoull(arg_bitsize) / 8ULL);
+            }
             return iface_attrs.at(FunctionArchitecture::iface_alignment);
          }();
          std::string iface_type, arg_size;
@@ -52,6 +52,7 @@
 #include "design_flow_manager.hpp"
 #include "exceptions.hpp"
 #include "fileIO.hpp"
+#include "fsm_description.hpp"
 #include "generic_device.hpp"
 #include "hls_manager.hpp"
 #include "library_manager.hpp"
@@ -74,7 +75,6 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/case_conv.hpp>
-#include <boost/tokenizer.hpp>
 
 #include <fstream>
 #include <iosfwd>
@@ -86,8 +86,11 @@ HDL_manager::HDL_manager(const HLS_managerRef _HLSMgr, const generic_deviceRef _
       device(_device),
       TM(_device->get_technology_manager()),
 #if HAVE_FLOPOCO
-      flopo_wrap(new flopoco_wrapper(_parameters->getOption<int>(OPT_debug_level),
-                                     _device->get_parameter<std::string>("family"))),
+      flopo_wrap(new flopoco_wrapper(
+          _parameters->getOption<int>(OPT_debug_level), _device->get_parameter<std::string>("family"),
+          _parameters->isOption(OPT_technology_cache) ?
+              (_parameters->getOption<std::filesystem::path>(OPT_technology_cache) / "flopoco").string() :
+              "")),
 #endif
       SM(_SM),
       parameters(_parameters),
@@ -101,8 +104,11 @@ HDL_manager::HDL_manager(const HLS_managerRef _HLSMgr, const generic_deviceRef _
       device(_device),
       TM(_device->get_technology_manager()),
 #if HAVE_FLOPOCO
-      flopo_wrap(new flopoco_wrapper(_parameters->getOption<int>(OPT_debug_level),
-                                     _device->get_parameter<std::string>("family"))),
+      flopo_wrap(new flopoco_wrapper(
+          _parameters->getOption<int>(OPT_debug_level), _device->get_parameter<std::string>("family"),
+          _parameters->isOption(OPT_technology_cache) ?
+              (_parameters->getOption<std::filesystem::path>(OPT_technology_cache) / "flopoco").string() :
+              "")),
 #endif
       parameters(_parameters),
       debug_level(_parameters->get_class_debug_level(GET_CLASS(*this)))
@@ -966,18 +972,12 @@ void HDL_manager::write_module(const language_writerRef writer, const structural
       THROW_ASSERT(
           !(np->exist_NP_functionality(NP_functionality::FSM) and np->exist_NP_functionality(NP_functionality::FSM_CS)),
           "Cannot exist both FSM and fsm_cs for the same function");
-      std::string fsm_desc;
-      if(np->exist_NP_functionality(NP_functionality::FSM_CS))
-      {
-         fsm_desc = np->get_NP_functionality(NP_functionality::FSM_CS);
-      }
-      else
-      {
-         fsm_desc = np->get_NP_functionality(NP_functionality::FSM);
-      }
-      THROW_ASSERT(fsm_desc != "",
+      const auto fsm = np->get_FSM_description(np->exist_NP_functionality(NP_functionality::FSM_CS) ?
+                                                   NP_functionality::FSM_CS :
+                                                   NP_functionality::FSM);
+      THROW_ASSERT(fsm,
                    "Behavior not expected: " + HDL_manager::convert_to_identifier(writer.get(), GET_TYPE_NAME(cir)));
-      write_fsm(writer, cir, fsm_desc);
+      write_fsm(writer, cir, fsm);
    }
    else if(np)
    {
@@ -1096,78 +1096,28 @@ void HDL_manager::write_behavioral(const language_writerRef writer, const struct
 }
 
 void HDL_manager::write_fsm(const language_writerRef writer, const structural_objectRef& cir,
-                            const std::string& fsm_desc_i) const
+                            const fsm_descriptionConstRef& fsm) const
 {
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Start writing the FSM...");
 
-   const auto fsm_desc = boost::algorithm::erase_all_copy(fsm_desc_i, "\n");
-
-   const auto SplitVec = string_to_container<std::vector<std::string>>(fsm_desc, ";", false);
-   THROW_ASSERT(SplitVec.size() > 2, "Expected more than one ';' in the FSM specification (the first is the reset)");
-
-   using tokenizer = boost::tokenizer<boost::char_separator<char>>;
-   boost::char_separator<char> sep(" ", nullptr);
-   // compute the list of states
-   std::list<std::string> list_of_states;
-   auto it_end = SplitVec.cend();
-   auto it = SplitVec.cbegin();
-   tokenizer first_line_tokens(*it, sep);
-   tokenizer::iterator tok_iter = first_line_tokens.begin();
-   std::string reset_state = convert_to_identifier(writer.get(), *tok_iter);
+   THROW_ASSERT(!fsm->states.empty(), "Expected at least one state in the FSM specification (the first is the reset)");
+   std::string reset_state = convert_to_identifier(writer.get(), fsm->get_reset_state());
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Reset state: '" << reset_state << "'");
-   ++tok_iter;
-   THROW_ASSERT(tok_iter != first_line_tokens.end(), "Wrong FSM description: expected the reset port name");
-   std::string reset_port = convert_to_identifier(writer.get(), *tok_iter);
+   std::string reset_port = convert_to_identifier(writer.get(), fsm->reset_port);
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Reset port: '" << reset_port << "'");
-   ++tok_iter;
-   THROW_ASSERT(tok_iter != first_line_tokens.end(), "Wrong FSM description: expected the start port name");
-   std::string start_port = convert_to_identifier(writer.get(), *tok_iter);
+   std::string start_port = convert_to_identifier(writer.get(), fsm->start_port);
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Start port: '" << start_port << "'");
-   ++tok_iter;
-   THROW_ASSERT(tok_iter != first_line_tokens.end(), "Wrong FSM description: expected the clock port name");
-   std::string clock_port = convert_to_identifier(writer.get(), *tok_iter);
+   std::string clock_port = convert_to_identifier(writer.get(), fsm->clock_port);
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Clock port: '" << clock_port << "'");
-   ++tok_iter;
-   THROW_ASSERT(tok_iter == first_line_tokens.end(), "Wrong FSM description: unexpetcted tokens" + *tok_iter);
-
-   ++it;
-   /// extract bypass signals
-   std::map<unsigned int, std::map<std::string, std::set<unsigned int>>> bypass_signals;
-   if(!it->empty())
-   {
-      const auto BypassVec = string_to_container<std::vector<std::string>>(*it, ":");
-      for(const auto& assign : BypassVec)
-      {
-         const auto AssignPair = string_to_container<std::vector<std::string>>(assign, "=");
-         THROW_ASSERT(AssignPair.size() == 2, "malformed FSM description " + STR(AssignPair.size()));
-         auto out = static_cast<unsigned>(std::stoul(AssignPair.at(0)));
-         const auto inStateVec = string_to_container<std::vector<std::string>>(AssignPair.at(1), ",");
-         for(const auto& inState : inStateVec)
-         {
-            const auto StateInsPair = string_to_container<std::vector<std::string>>(inState, ">");
-            THROW_ASSERT(StateInsPair.size() == 2, "malformed FSM description " + STR(StateInsPair.size()));
-            const auto inVec = string_to_container<std::vector<std::string>>(StateInsPair.at(1), "<");
-            for(const auto& in : inVec)
-            {
-               auto in_val = static_cast<unsigned>(std::stoul(in));
-               bypass_signals[out][StateInsPair.at(0)].insert(in_val);
-            }
-         }
-      }
-   }
 
-   ++it;
-   auto first = it;
-   for(; it + 1 != it_end; ++it)
+   // compute the list of states
+   std::list<std::string> list_of_states;
+   for(const auto& state : fsm->states)
    {
-      tokenizer tokens(*it, sep);
-      list_of_states.push_back(convert_to_identifier(writer.get(), *tokens.begin()));
+      list_of_states.push_back(convert_to_identifier(writer.get(), state.name));
    }
-   auto end = it;
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Number of states: " << list_of_states.size());
    // std::cout << list_of_states.size() << " " << bitnumber(list_of_states.size()-1) << std::endl;
-   THROW_ASSERT(reset_state == *(list_of_states.begin()),
-                "reset state and first state has to be the same " + reset_state + " : " + fsm_desc);
 
    /// write state declaration.
    std::string vendor;
@@ -1223,14 +1173,14 @@ void HDL_manager::write_fsm(const language_writerRef writer, const structural_ob
          {
             continue;
          }
-         writer->write_transition_output_functions(false, output_index, cir, reset_state, reset_port, start_port,
-                                                   clock_port, first, end, is_yosys, bypass_signals);
+         writer->write_transition_output_functions(false, output_index, cir, fsm, reset_state, reset_port, start_port,
+                                                   clock_port, is_yosys);
       }
    }
    else
    {
-      writer->write_transition_output_functions(true, 0, cir, reset_state, reset_port, start_port, clock_port, first,
-                                                end, is_yosys, bypass_signals);
+      writer->write_transition_output_functions(true, 0, cir, fsm, reset_state, reset_port, start_port, clock_port,
+                                                is_yosys);
    }
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "FSM writing completed!");
 }
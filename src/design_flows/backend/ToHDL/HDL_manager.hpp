@@ -69,6 +69,7 @@ REF_FORWARD_DECL(language_writer);
 REF_FORWARD_DECL(generic_device);
 REF_FORWARD_DECL(flopoco_wrapper);
 REF_FORWARD_DECL(structural_manager);
+CONSTREF_FORWARD_DECL(fsm_description);
 CONSTREF_FORWARD_DECL(technology_manager);
 CONSTREF_FORWARD_DECL(Parameter);
 enum class HDLWriter_Language;
@@ -158,9 +159,10 @@ class HDL_manager
     * Writes a mealy/moore finite state machine behavioral description.
     * @param writer is the chosen language writer object.
     * @param cir is the module.
-    * @param fsm_desc is the string-based FSM description.
+    * @param fsm is the FSM description.
     */
-   void write_fsm(const language_writerRef writer, const structural_objectRef& cir, const std::string& fsm_desc) const;
+   void write_fsm(const language_writerRef writer, const structural_objectRef& cir,
+                  const fsm_descriptionConstRef& fsm) const;
 
    /**
     * Writes the behavioral description associated with the component
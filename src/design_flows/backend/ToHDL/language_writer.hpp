@@ -63,6 +63,7 @@
  * @name Forward declarations.
  */
 //@{
+CONSTREF_FORWARD_DECL(fsm_description);
 REF_FORWARD_DECL(IndentedOutputStream);
 REF_FORWARD_DECL(language_writer);
 CONSTREF_FORWARD_DECL(Parameter);
@@ -276,18 +277,21 @@ class language_writer
                                            const std::string& reset_type, bool connect_present_next_state_signals) = 0;
    /**
     * Write the transition and output functions.
+    * @param single_proc is true when all the outputs are written by a single process.
+    * @param output_index is the output written by the process when single_proc is false.
     * @param cir is the component.
+    * @param fsm is the finite state machine.
+    * @param reset_state is the reset state.
     * @param reset_port is the reset port.
+    * @param start_port is the start port.
     * @param clock_port is the clock port.
-    * @param first if the first iterator of the state table.
-    * @param end if the end iterator of the state table.
     * @param is_yosys is true when the transition table is meant for YOSYS.
     */
-   virtual void write_transition_output_functions(
-       bool single_proc, unsigned int output_index, const structural_objectRef& cir, const std::string& reset_state,
-       const std::string& reset_port, const std::string& start_port, const std::string& clock_port,
-       std::vector<std::string>::const_iterator& first, std::vector<std::string>::const_iterator& end, bool is_yosys,
-       const std::map<unsigned int, std::map<std::string, std::set<unsigned int>>>& bypass_signals) = 0;
+   virtual void write_transition_output_functions(bool single_proc, unsigned int output_index,
+                                                  const structural_objectRef& cir, const fsm_descriptionConstRef& fsm,
+                                                  const std::string& reset_state, const std::string& reset_port,
+                                                  const std::string& start_port, const std::string& clock_port,
+                                                  bool is_yosys) = 0;
 
    /**
     * Write in the proper language the behavioral description of the module described in "Not Parsed" form.
@@ -45,6 +45,7 @@
 #include "Parameter.hpp"
 #include "dbgPrintHelper.hpp"
 #include "exceptions.hpp"
+#include "fsm_description.hpp"
 #include "indented_output_stream.hpp"
 #include "state_transition_graph_manager.hpp"
 #include "string_manipulation.hpp"
@@ -54,7 +55,6 @@
 #include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <boost/range/adaptor/reversed.hpp>
-#include <boost/tokenizer.hpp>
 #include <fstream>
 #include <functional>
 #include <iosfwd>
@@ -1517,17 +1517,15 @@ void VHDL_writer::write_present_state_update(const structural_objectRef, const s
    indented_output_stream->Append("end process;\n");
 }
 
-void VHDL_writer::write_transition_output_functions(
-    bool single_proc, unsigned int output_index, const structural_objectRef& cir, const std::string& reset_state,
-    const std::string& reset_port, const std::string& start_port, const std::string& clock_port,
-    std::vector<std::string>::const_iterator& first, std::vector<std::string>::const_iterator& end, bool,
-    const std::map<unsigned int, std::map<std::string, std::set<unsigned int>>>& bypass_signals)
+void VHDL_writer::write_transition_output_functions(bool single_proc, unsigned int output_index,
+                                                    const structural_objectRef& cir,
+                                                    const fsm_descriptionConstRef& fsm,
+                                                    const std::string& reset_state, const std::string& reset_port,
+                                                    const std::string& start_port, const std::string& clock_port, bool)
 {
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Writing transition output function");
    auto* mod = GetPointer<module>(cir);
-   boost::char_separator<char> state_sep(":", nullptr);
-   boost::char_separator<char> sep(" ", nullptr);
-   using tokenizer = boost::tokenizer<boost::char_separator<char>>;
+   const auto& bypass_signals = fsm->bypass_signals;
 
    /// get the default output of the reset state
 
@@ -1546,8 +1544,7 @@ void VHDL_writer::write_transition_output_functions(
    indented_output_stream->Append("begin\n");
    indented_output_stream->Indent();
 
-   /// set the defaults
-   std::string default_output;
+   /// set the defaults: all the outputs are set to zero
    for(unsigned int i = 0; i < mod->get_out_port_size(); i++)
    {
       if(mod->get_out_port(i)->get_id() == PRESENT_STATE_PORT_NAME)
@@ -1558,7 +1555,6 @@ void VHDL_writer::write_transition_output_functions(
       {
          continue;
       }
-      default_output += "0";
       if(!single_proc && output_index != i)
       {
          continue;
@@ -1574,56 +1570,25 @@ void VHDL_writer::write_transition_output_functions(
    indented_output_stream->Append("case present_state is\n");
    indented_output_stream->Indent();
 
-   for(auto first_it = first; first_it != end; ++first_it)
+   for(const auto& state : fsm->states)
    {
-      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Writing " + *first_it);
-      tokenizer state_tokens_first(*first_it, state_sep);
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Writing " + state.name);
+      const auto& state_transitions = state.transitions;
 
-      tokenizer::const_iterator its = state_tokens_first.begin();
-
-      std::string state_description = *its;
-      ++its;
-
-      std::vector<std::string> state_transitions;
-      for(; its != state_tokens_first.end(); ++its)
-      {
-         state_transitions.push_back(*its);
-      }
-
-      tokenizer tokens_curr(state_description, sep);
       /// get the present state
-      its = tokens_curr.begin();
-      std::string present_state = HDL_manager::convert_to_identifier(this, *its);
+      const auto present_state = HDL_manager::convert_to_identifier(this, state.name);
       /// get the current output
-      ++its;
-      std::string current_output = *its;
+      const auto& current_output = state.outputs;
 
       /// check if we can skip this state or transitions
       bool skip_state = !single_proc && output_index != mod->get_out_port_size() &&
-                        default_output[output_index] == current_output[output_index];
+                        current_output.get(output_index) == fsm_output_vector::ZERO;
       bool skip_state_transition = !single_proc && output_index != mod->get_out_port_size();
       if(!single_proc && output_index != mod->get_out_port_size())
       {
          for(const auto& current_transition : state_transitions)
          {
-            tokenizer transition_tokens(current_transition, sep);
-            tokenizer::const_iterator itt = transition_tokens.begin();
-
-            // std::string current_input;
-            tokenizer::const_iterator current_input_it;
-            std::string input_string = *itt;
-            if(mod->get_in_port_size() - 3) // clock and reset are always present
-            {
-               boost::char_separator<char> comma_sep(",", nullptr);
-               tokenizer current_input_tokens(input_string, comma_sep);
-               current_input_it = current_input_tokens.begin();
-               ++itt;
-            }
-            ++itt;
-            std::string transition_outputs = *itt;
-            ++itt;
-            THROW_ASSERT(itt == transition_tokens.end(), "Bad transition format");
-            if(transition_outputs[output_index] != '-')
+            if(current_transition.outputs.get(output_index) != fsm_output_vector::DONT_CARE)
             {
                skip_state = false;
                skip_state_transition = false;
@@ -1670,7 +1635,7 @@ void VHDL_writer::write_transition_output_functions(
       }
 
       bool unique_transition = (state_transitions.size() == 1);
-      if(current_output != default_output && (single_proc || !unique_transition || skip_state_transition))
+      if(current_output.any() && (single_proc || !unique_transition || skip_state_transition))
       {
          for(unsigned int i = 0; i < mod->get_out_port_size(); i++)
          {
@@ -1683,13 +1648,13 @@ void VHDL_writer::write_transition_output_functions(
                continue;
             }
             std::string port_name = HDL_manager::convert_to_identifier(this, mod->get_out_port(i)->get_id());
-            if(default_output[i] != current_output[i])
+            if(current_output.get(i) != fsm_output_vector::ZERO)
             {
                if(single_proc || output_index == i)
                {
-                  switch(current_output[i])
+                  switch(current_output.get(i))
                   {
-                     case '1':
+                     case fsm_output_vector::ONE:
                      {
                         if(bypass_signals.find(i) == bypass_signals.end() ||
                            bypass_signals.find(i)->second.find(present_state) == bypass_signals.find(i)->second.end())
@@ -1725,7 +1690,7 @@ void VHDL_writer::write_transition_output_functions(
                         }
                         break;
                      }
-                     case '2':
+                     case fsm_output_vector::UNDEFINED:
                         indented_output_stream->Append(port_name + " <= 'X';\n");
                         break;
 
@@ -1742,29 +1707,11 @@ void VHDL_writer::write_transition_output_functions(
       {
          for(unsigned int i = 0; i < state_transitions.size(); i++)
          {
-            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Writing transition " + state_transitions[i]);
-            // std::cerr << " transition '" << state_transitions[i] << "'" << std::endl;
-            tokenizer transition_tokens(state_transitions[i], sep);
-            tokenizer::const_iterator itt = transition_tokens.begin();
-            THROW_ASSERT(itt != transition_tokens.end(), "");
-
-            // std::string current_input;
-            tokenizer::const_iterator current_input_it;
-            std::string input_string = *itt;
-            if(mod->get_in_port_size() - 3) // clock and reset are always present
-            {
-               boost::char_separator<char> comma_sep(",", nullptr);
-               tokenizer current_input_tokens(input_string, comma_sep);
-               current_input_it = current_input_tokens.begin();
-               ++itt;
-            }
-            THROW_ASSERT(itt != transition_tokens.end(), "");
-            std::string next_state = HDL_manager::convert_to_identifier(this, *itt);
-            ++itt;
-            THROW_ASSERT(itt != transition_tokens.end(), "");
-            std::string transition_outputs = *itt;
-            ++itt;
-            THROW_ASSERT(itt == transition_tokens.end(), "Bad transition format");
+            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                           "-->Writing transition to " + state_transitions[i].next_state);
+            auto current_input_it = state_transitions[i].guards.cbegin();
+            const auto next_state = HDL_manager::convert_to_identifier(this, state_transitions[i].next_state);
+            const auto& transition_outputs = state_transitions[i].outputs;
 
             if(!unique_transition)
             {
@@ -1792,12 +1739,9 @@ void VHDL_writer::write_transition_output_functions(
                      auto vec_size = mod->get_in_port(ind)->get_typeRef()->vector_size;
                      if(port_name != reset_port && port_name != clock_port && port_name != start_port)
                      {
-                        std::string in_or_conditions = *current_input_it;
-                        boost::char_separator<char> pipe_sep("|", nullptr);
-                        tokenizer in_or_conditions_tokens(in_or_conditions, pipe_sep);
-                        THROW_ASSERT(in_or_conditions_tokens.begin() != in_or_conditions_tokens.end(), "");
-
-                        if((*in_or_conditions_tokens.begin()) != "-")
+                        THROW_ASSERT(current_input_it != state_transitions[i].guards.cend(), "");
+                        const auto& in_or_conditions = *current_input_it;
+                        if(!in_or_conditions.is_dont_care())
                         {
                            if(!first_test)
                            {
@@ -1810,11 +1754,8 @@ void VHDL_writer::write_transition_output_functions(
                            bool first_test_or = true;
                            bool need_parenthesis = false;
                            std::string res_or_conditions;
-                           for(tokenizer::const_iterator in_or_conditions_tokens_it = in_or_conditions_tokens.begin();
-                               in_or_conditions_tokens_it != in_or_conditions_tokens.end();
-                               ++in_or_conditions_tokens_it)
+                           for(const auto& in_or_condition : in_or_conditions.terms)
                            {
-                              THROW_ASSERT((*in_or_conditions_tokens_it) != "-", "wrong conditions structure");
                               if(!first_test_or)
                               {
                                  res_or_conditions += " or ";
@@ -1826,26 +1767,21 @@ void VHDL_writer::write_transition_output_functions(
                               }
 
                               res_or_conditions += port_name;
-                              if((*in_or_conditions_tokens_it)[0] == '&')
+                              if(in_or_condition.is_bit_position)
                               {
-                                 auto pos = std::stoull((*in_or_conditions_tokens_it).substr(1));
-                                 res_or_conditions += std::string("(") + STR(pos) + ") = '1'";
+                                 res_or_conditions += std::string("(") + STR(in_or_condition.value) + ") = '1'";
                               }
                               else
                               {
-                                 res_or_conditions +=
-                                     std::string(" = ") + ((*in_or_conditions_tokens_it)[0] == '-' ? "-" : "");
+                                 res_or_conditions += std::string(" = ") + (in_or_condition.value < 0 ? "-" : "");
                                  if(port_size > 1 || (port_size == 1 && vec_size > 0))
                                  {
                                     res_or_conditions +=
-                                        "\"" +
-                                        NumberToBinaryString(llabs(std::stoll(*in_or_conditions_tokens_it)),
-                                                             port_size) +
-                                        "\"";
+                                        "\"" + convert_to_binary(in_or_condition.value.abs(), port_size) + "\"";
                                  }
                                  else
                                  {
-                                    res_or_conditions += "'" + *in_or_conditions_tokens_it + "'";
+                                    res_or_conditions += "'" + STR(in_or_condition.value) + "'";
                                  }
                               }
                            }
@@ -1877,16 +1813,16 @@ void VHDL_writer::write_transition_output_functions(
                {
                   continue;
                }
-               if(transition_outputs[i2] != '-')
+               if(transition_outputs.get(i2) != fsm_output_vector::DONT_CARE)
                {
                   std::string port_name = HDL_manager::convert_to_identifier(this, mod->get_out_port(i2)->get_id());
                   if(single_proc || output_index == i2)
                   {
-                     if(transition_outputs[i2] == '2')
+                     if(transition_outputs.get(i2) == fsm_output_vector::UNDEFINED)
                      {
                         indented_output_stream->Append(port_name + " <= 'X';\n");
                      }
-                     else if(transition_outputs[i2] == '1')
+                     else if(transition_outputs.get(i2) == fsm_output_vector::ONE)
                      {
                         if(bypass_signals.find(i2) == bypass_signals.end() ||
                            bypass_signals.find(i2)->second.find(present_state) == bypass_signals.find(i2)->second.end())
@@ -1929,7 +1865,7 @@ void VHDL_writer::write_transition_output_functions(
                }
             }
             indented_output_stream->Deindent();
-            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Written transition " + state_transitions[i]);
+            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Written transition to " + state_transitions[i].next_state);
          }
          if(!unique_transition)
          {
@@ -50,6 +50,7 @@
 #include "Parameter.hpp"
 #include "dbgPrintHelper.hpp"
 #include "exceptions.hpp"
+#include "fsm_description.hpp"
 #include "indented_output_stream.hpp"
 #include "state_transition_graph_manager.hpp"
 #include "string_manipulation.hpp"
@@ -61,7 +62,7 @@
 
 #include <algorithm>
 #include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
+#include <cstdlib>
 #include <fstream>
 #include <functional>
 #include <iosfwd>
@@ -1433,20 +1434,18 @@ void verilog_writer::write_present_state_update(const structural_objectRef cir,
    }
 }
 
-void verilog_writer::write_transition_output_functions(
-    bool single_proc, unsigned int output_index, const structural_objectRef& cir, const std::string& reset_state,
-    const std::string& reset_port, const std::string& start_port, const std::string& clock_port,
-    std::vector<std::string>::const_iterator& first, std::vector<std::string>::const_iterator& end, bool is_yosys,
-    const std::map<unsigned int, std::map<std::string, std::set<unsigned int>>>& bypass_signals)
+void verilog_writer::write_transition_output_functions(bool single_proc, unsigned int output_index,
+                                                       const structural_objectRef& cir,
+                                                       const fsm_descriptionConstRef& fsm,
+                                                       const std::string& reset_state, const std::string& reset_port,
+                                                       const std::string& start_port, const std::string& clock_port,
+                                                       bool is_yosys)
 {
-   using tokenizer = boost::tokenizer<boost::char_separator<char>>;
    const char soc[3] = {STD_OPENING_CHAR, '\n', '\0'};
    const char scc[3] = {STD_CLOSING_CHAR, '\n', '\0'};
    const char soc1[2] = {STD_OPENING_CHAR, '\0'};
    const char scc1[2] = {STD_CLOSING_CHAR, '\0'};
-
-   boost::char_separator<char> state_sep(":", nullptr);
-   boost::char_separator<char> sep(" ", nullptr);
+   const auto& bypass_signals = fsm->bypass_signals;
 
    auto* mod = GetPointer<module>(cir);
    THROW_ASSERT(mod, "Expected a component object");
@@ -1454,15 +1453,6 @@ void verilog_writer::write_transition_output_functions(
    std::string port_name;
 
    const NP_functionalityRef& np = mod->get_NP_functionality();
-   unsigned int numInputIgnored; // clock,reset,start_port are always present
-   if(np->exist_NP_functionality(NP_functionality::FSM_CS))
-   {
-      numInputIgnored = 4; // added selector
-   }
-   else
-   {
-      numInputIgnored = 3;
-   }
    /// state transitions description
 #ifdef VERILOG_2001_SUPPORTED
    indented_output_stream->Append("\nalways @(*)\nbegin");
@@ -1490,8 +1480,7 @@ void verilog_writer::write_transition_output_functions(
       indented_output_stream->Append("_next_state = " + reset_state + ";\n");
    }
 
-   /// compute the default output
-   std::string default_output;
+   /// write the default output: all the outputs are set to zero
    for(unsigned int i = 0; i < mod->get_out_port_size(); i++)
    {
       if(mod->get_out_port(i)->get_id() == PRESENT_STATE_PORT_NAME)
@@ -1502,7 +1491,6 @@ void verilog_writer::write_transition_output_functions(
       {
          continue;
       }
-      default_output += "0";
       if(!single_proc && output_index != i)
       {
          continue;
@@ -1521,55 +1509,24 @@ void verilog_writer::write_transition_output_functions(
    }
    indented_output_stream->Append(soc);
 
-   for(auto first_it = first; first_it != end; ++first_it)
+   for(const auto& state : fsm->states)
    {
-      tokenizer state_tokens_first(*first_it, state_sep);
-
-      tokenizer::const_iterator it = state_tokens_first.begin();
-
-      std::string state_description = *it;
-      ++it;
-
-      std::vector<std::string> state_transitions;
-      for(; it != state_tokens_first.end(); ++it)
-      {
-         state_transitions.push_back(*it);
-      }
-
-      tokenizer tokens_curr(state_description, sep);
+      const auto& state_transitions = state.transitions;
 
       /// get the present state
-      it = tokens_curr.begin();
-      std::string present_state = HDL_manager::convert_to_identifier(this, *it);
+      const auto present_state = HDL_manager::convert_to_identifier(this, state.name);
       /// get the current output
-      ++it;
-      std::string current_output = *it;
+      const auto& current_output = state.outputs;
 
       /// check if we can skip this state
       bool skip_state = !single_proc && output_index != mod->get_out_port_size() &&
-                        default_output[output_index] == current_output[output_index];
+                        current_output.get(output_index) == fsm_output_vector::ZERO;
       bool skip_state_transition = !single_proc && output_index != mod->get_out_port_size();
       if(!single_proc && output_index != mod->get_out_port_size())
       {
          for(const auto& current_transition : state_transitions)
          {
-            tokenizer transition_tokens(current_transition, sep);
-            tokenizer::const_iterator itt = transition_tokens.begin();
-
-            tokenizer::const_iterator current_input_it;
-            std::string input_string = *itt;
-            if(mod->get_in_port_size() - numInputIgnored) // clock and reset are always present
-            {
-               boost::char_separator<char> comma_sep(",", nullptr);
-               tokenizer current_input_tokens(input_string, comma_sep);
-               current_input_it = current_input_tokens.begin();
-               ++itt;
-            }
-            ++itt;
-            std::string transition_outputs = *itt;
-            ++itt;
-            THROW_ASSERT(itt == transition_tokens.end(), "Bad transition format");
-            if(transition_outputs[output_index] != '-')
+            if(current_transition.outputs.get(output_index) != fsm_output_vector::DONT_CARE)
             {
                skip_state = false;
                skip_state_transition = false;
@@ -1593,7 +1550,7 @@ void verilog_writer::write_transition_output_functions(
       indented_output_stream->Append(soc);
 
       bool unique_transition = (state_transitions.size() == 1);
-      if(current_output != default_output && (single_proc || !unique_transition || skip_state_transition))
+      if(current_output.any() && (single_proc || !unique_transition || skip_state_transition))
       {
          for(unsigned int i = 0; i < mod->get_out_port_size(); i++)
          {
@@ -1606,13 +1563,13 @@ void verilog_writer::write_transition_output_functions(
                continue;
             }
             port_name = HDL_manager::convert_to_identifier(this, mod->get_out_port(i)->get_id());
-            if(default_output[i] != current_output[i])
+            if(current_output.get(i) != fsm_output_vector::ZERO)
             {
                if(single_proc || output_index == i)
                {
-                  switch(current_output[i])
+                  switch(current_output.get(i))
                   {
-                     case '1':
+                     case fsm_output_vector::ONE:
                      {
                         if(bypass_signals.find(i) == bypass_signals.end() ||
                            bypass_signals.find(i)->second.find(present_state) == bypass_signals.find(i)->second.end())
@@ -1648,7 +1605,7 @@ void verilog_writer::write_transition_output_functions(
                         }
                         break;
                      }
-                     case '2':
+                     case fsm_output_vector::UNDEFINED:
                         indented_output_stream->Append(port_name + " = 1'bX;\n");
                         break;
 
@@ -1671,23 +1628,7 @@ void verilog_writer::write_transition_output_functions(
          {
             for(unsigned int i = 0; i < state_transitions.size(); i++)
             {
-               tokenizer transition_tokens(state_transitions[i], sep);
-               tokenizer::const_iterator itt = transition_tokens.begin();
-
-               tokenizer::const_iterator current_input_it;
-               std::string input_string = *itt;
-               if(mod->get_in_port_size() - numInputIgnored)
-               {
-                  boost::char_separator<char> comma_sep(",", nullptr);
-                  tokenizer current_input_tokens(input_string, comma_sep);
-                  current_input_it = current_input_tokens.begin();
-                  ++itt;
-               }
-               std::string next_state = *itt;
-               ++itt;
-               std::string transition_outputs = *itt;
-               ++itt;
-               THROW_ASSERT(itt == transition_tokens.end(), "Bad transition format");
+               auto current_input_it = state_transitions[i].guards.cbegin();
                if((i + 1) < state_transitions.size())
                {
                   bool first_test = true;
@@ -1699,11 +1640,8 @@ void verilog_writer::write_transition_output_functions(
                      if(port_name != reset_port && port_name != clock_port && port_name != start_port &&
                         port_name != STR(SELECTOR_REGISTER_FILE))
                      {
-                        std::string in_or_conditions = *current_input_it;
-                        boost::char_separator<char> pipe_sep("|", nullptr);
-                        tokenizer in_or_conditions_tokens(in_or_conditions, pipe_sep);
-
-                        if((*in_or_conditions_tokens.begin()) != "-")
+                        const auto& in_or_conditions = *current_input_it;
+                        if(!in_or_conditions.is_dont_care())
                         {
                            if(guard_casez_port.empty())
                            {
@@ -1722,11 +1660,10 @@ void verilog_writer::write_transition_output_functions(
                               first_test = false;
                            }
                            bool first_test_or = true;
-                           for(tokenizer::const_iterator in_or_conditions_tokens_it = in_or_conditions_tokens.begin();
-                               in_or_conditions_tokens_it != in_or_conditions_tokens.end() && unique_case_condition;
-                               ++in_or_conditions_tokens_it)
+                           for(auto in_or_conditions_it = in_or_conditions.terms.cbegin();
+                               in_or_conditions_it != in_or_conditions.terms.cend() && unique_case_condition;
+                               ++in_or_conditions_it)
                            {
-                              THROW_ASSERT((*in_or_conditions_tokens_it) != "-", "wrong conditions structure");
                               if(!first_test_or)
                               {
                                  unique_case_condition = false;
@@ -1736,7 +1673,7 @@ void verilog_writer::write_transition_output_functions(
                                  first_test_or = false;
                               }
 
-                              if((*in_or_conditions_tokens_it)[0] != '&')
+                              if(!in_or_conditions_it->is_bit_position)
                               {
                                  unique_case_condition = false;
                               }
@@ -1766,24 +1703,11 @@ void verilog_writer::write_transition_output_functions(
          }
          for(unsigned int i = 0; i < state_transitions.size(); i++)
          {
-            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Analyzing transition " + state_transitions[i]);
-            tokenizer transition_tokens(state_transitions[i], sep);
-            tokenizer::const_iterator itt = transition_tokens.begin();
-
-            tokenizer::const_iterator current_input_it;
-            std::string input_string = *itt;
-            if(mod->get_in_port_size() - numInputIgnored)
-            {
-               boost::char_separator<char> comma_sep(",", nullptr);
-               tokenizer current_input_tokens(input_string, comma_sep);
-               current_input_it = current_input_tokens.begin();
-               ++itt;
-            }
-            std::string next_state = *itt;
-            ++itt;
-            std::string transition_outputs = *itt;
-            ++itt;
-            THROW_ASSERT(itt == transition_tokens.end(), "Bad transition format");
+            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                           "---Analyzing transition to " + state_transitions[i].next_state);
+            auto current_input_it = state_transitions[i].guards.cbegin();
+            const auto& next_state = state_transitions[i].next_state;
+            const auto& transition_outputs = state_transitions[i].outputs;
 
             if(!unique_transition)
             {
@@ -1831,11 +1755,8 @@ void verilog_writer::write_transition_output_functions(
                      if(port_name != reset_port && port_name != clock_port && port_name != start_port &&
                         port_name != STR(SELECTOR_REGISTER_FILE))
                      {
-                        std::string in_or_conditions = *current_input_it;
-                        boost::char_separator<char> pipe_sep("|", nullptr);
-                        tokenizer in_or_conditions_tokens(in_or_conditions, pipe_sep);
-
-                        if((*in_or_conditions_tokens.begin()) != "-")
+                        const auto& in_or_conditions = *current_input_it;
+                        if(!in_or_conditions.is_dont_care())
                         {
                            if(!first_test)
                            {
@@ -1848,11 +1769,8 @@ void verilog_writer::write_transition_output_functions(
                            bool first_test_or = true;
                            bool need_parenthesis = false;
                            std::string res_or_conditions;
-                           for(tokenizer::const_iterator in_or_conditions_tokens_it = in_or_conditions_tokens.begin();
-                               in_or_conditions_tokens_it != in_or_conditions_tokens.end();
-                               ++in_or_conditions_tokens_it)
+                           for(const auto& in_or_condition : in_or_conditions.terms)
                            {
-                              THROW_ASSERT((*in_or_conditions_tokens_it) != "-", "wrong conditions structure");
                               if(!first_test_or)
                               {
                                  res_or_conditions += " || ";
@@ -1864,10 +1782,10 @@ void verilog_writer::write_transition_output_functions(
                               }
 
                               res_or_conditions += port_name;
-                              if((*in_or_conditions_tokens_it)[0] == '&')
+                              if(in_or_condition.is_bit_position)
                               {
                                  auto n_bits = vec_size == 0 ? port_size : vec_size;
-                                 auto pos = static_cast<unsigned>(std::stoul((*in_or_conditions_tokens_it).substr(1)));
+                                 auto pos = static_cast<unsigned>(in_or_condition.value);
                                  if(unique_case_condition)
                                  {
                                     res_or_conditions = "";
@@ -1886,18 +1804,15 @@ void verilog_writer::write_transition_output_functions(
                               }
                               else
                               {
-                                 res_or_conditions += std::string(" == ") +
-                                                      ((*in_or_conditions_tokens_it)[0] == '-' ? "-" : "") +
+                                 res_or_conditions += std::string(" == ") + (in_or_condition.value < 0 ? "-" : "") +
                                                       (vec_size == 0 ? STR(port_size) : STR(vec_size));
                                  if(port_size > 1 || (port_size == 1 && vec_size > 0))
                                  {
-                                    res_or_conditions += "'d" + (((*in_or_conditions_tokens_it)[0] == '-') ?
-                                                                     ((*in_or_conditions_tokens_it).substr(1)) :
-                                                                     *in_or_conditions_tokens_it);
+                                    res_or_conditions += "'d" + STR(in_or_condition.value.abs());
                                  }
                                  else
                                  {
-                                    res_or_conditions += "'b" + *in_or_conditions_tokens_it;
+                                    res_or_conditions += "'b" + STR(in_or_condition.value);
                                  }
                               }
                            }
@@ -1938,11 +1853,11 @@ void verilog_writer::write_transition_output_functions(
                   continue;
                }
                port_name = HDL_manager::convert_to_identifier(this, mod->get_out_port(ind)->get_id());
-               if(transition_outputs[ind] != '-')
+               if(transition_outputs.get(ind) != fsm_output_vector::DONT_CARE)
                {
                   if(single_proc || output_index == ind)
                   {
-                     if(transition_outputs[ind] == '2')
+                     if(transition_outputs.get(ind) == fsm_output_vector::UNDEFINED)
                      {
                         indented_output_stream->Append(port_name + " = 1'bX;\n");
                      }
@@ -1952,7 +1867,9 @@ void verilog_writer::write_transition_output_functions(
                            bypass_signals.find(ind)->second.find(present_state) ==
                                bypass_signals.find(ind)->second.end())
                         {
-                           indented_output_stream->Append(port_name + " = 1'b" + transition_outputs[ind] + ";\n");
+                           indented_output_stream->Append(
+                               port_name + " = 1'b" +
+                               (transition_outputs.get(ind) == fsm_output_vector::ONE ? "1" : "0") + ";\n");
                         }
                         else
                         {
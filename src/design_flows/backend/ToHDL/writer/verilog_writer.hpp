@@ -209,18 +209,20 @@ class verilog_writer : public language_writer
 
    /**
     * Write the transition and output functions.
+    * @param single_proc is true when all the outputs are written by a single process.
+    * @param output_index is the output written by the process when single_proc is false.
     * @param cir is the component.
+    * @param fsm is the finite state machine.
+    * @param reset_state is the reset state.
     * @param reset_port is the reset port.
+    * @param start_port is the start port.
     * @param clock_port is the clock port.
-    * @param first is the first iterator of the state table.
-    * @param end is the end iterator of the state table.
     * @param is_yosys is true when the transition table is meant for YOSYS.
     */
-   void write_transition_output_functions(
-       bool single_proc, unsigned int output_index, const structural_objectRef& cir, const std::string& reset_state,
-       const std::string& reset_port, const std::string& start_port, const std::string& clock_port,
-       std::vector<std::string>::const_iterator& first, std::vector<std::string>::const_iterator& end, bool is_yosys,
-       const std::map<unsigned int, std::map<std::string, std::set<unsigned int>>>& bypass_signals) override;
+   void write_transition_output_functions(bool single_proc, unsigned int output_index, const structural_objectRef& cir,
+                                          const fsm_descriptionConstRef& fsm, const std::string& reset_state,
+                                          const std::string& reset_port, const std::string& start_port,
+                                          const std::string& clock_port, bool is_yosys) override;
 
    /**
     * Write in the proper language the behavioral description of the module described in "Not Parsed" form.
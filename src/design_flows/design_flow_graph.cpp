@@ -51,7 +51,9 @@
 #include <boost/graph/filtered_graph.hpp>
 #include <boost/iterator/iterator_facade.hpp>
 
+#include <algorithm>
 #include <filesystem>
+#include <limits>
 #include <ostream>
 #include <utility>
 
@@ -61,12 +63,21 @@ DesignFlowStepInfo::DesignFlowStepInfo(const DesignFlowStepRef& _design_flow_ste
 {
 }
 
+DesignFlowGraph::DesignFlowGraph()
+    : min_label(std::numeric_limits<size_t>::max() / 2), max_label(min_label), acyclic(true), search_epoch(0)
+{
+}
+
 DesignFlowGraph::vertex_descriptor DesignFlowGraph::AddDesignFlowStep(const DesignFlowStepRef& design_flow_step,
                                                                       bool unnecessary)
 {
    THROW_ASSERT(design_flow_step, "Design flow step pointer must be initialized");
    auto v = graph_t::AddVertex(DesignFlowStepInfoRef(new DesignFlowStepInfo(design_flow_step, unnecessary)));
    signature_to_vertex[design_flow_step->GetSignature()] = v;
+   THROW_ASSERT(v == topological_label.size(), "Unexpected vertex descriptor");
+   topological_label.push_back(++max_label);
+   forward_mark.push_back(0);
+   backward_mark.push_back(0);
    return v;
 }
 
@@ -85,10 +96,162 @@ void DesignFlowGraph::AddDesignFlowDependence(vertex_descriptor src, vertex_desc
    }
    else
    {
+      UpdateTopologicalOrder(src, tgt);
       graph_t::AddEdge(src, tgt, type);
    }
 }
 
+void DesignFlowGraph::UpdateTopologicalOrder(vertex_descriptor src, vertex_descriptor tgt)
+{
+   if(!acyclic || topological_label[src] < topological_label[tgt])
+   {
+      return;
+   }
+   /// A vertex without successors can be moved after all the others and one without predecessors before them
+   if(src != tgt && boost::out_degree(tgt, *this) == 0)
+   {
+      topological_label[tgt] = ++max_label;
+      return;
+   }
+   if(src != tgt && boost::in_degree(src, *this) == 0)
+   {
+      topological_label[src] = --min_label;
+      return;
+   }
+   const auto lower_bound = topological_label[tgt];
+   const auto upper_bound = topological_label[src];
+   ++search_epoch;
+   /// Vertices reachable from tgt which precede src
+   std::vector<vertex_descriptor> forward(1, tgt);
+   forward_mark[tgt] = search_epoch;
+   for(size_t i = 0; i < forward.size(); ++i)
+   {
+      for(const auto& oe : boost::make_iterator_range(boost::out_edges(forward[i], *this)))
+      {
+         const auto w = boost::target(oe, *this);
+         if(w == src)
+         {
+            acyclic = false;
+            return;
+         }
+         if(topological_label[w] < upper_bound && forward_mark[w] != search_epoch)
+         {
+            forward_mark[w] = search_epoch;
+            forward.push_back(w);
+         }
+      }
+   }
+   /// Vertices reaching src which follow tgt
+   std::vector<vertex_descriptor> backward(1, src);
+   backward_mark[src] = search_epoch;
+   for(size_t i = 0; i < backward.size(); ++i)
+   {
+      for(const auto& ie : boost::make_iterator_range(boost::in_edges(backward[i], *this)))
+      {
+         const auto w = boost::source(ie, *this);
+         if(topological_label[w] > lower_bound && backward_mark[w] != search_epoch)
+         {
+            backward_mark[w] = search_epoch;
+            backward.push_back(w);
+         }
+      }
+   }
+   /// Reassign the labels of the affected vertices: first the ones reaching src, then the ones reachable from tgt
+   const auto by_label = [&](vertex_descriptor a, vertex_descriptor b) {
+      return topological_label[a] < topological_label[b];
+   };
+   std::sort(forward.begin(), forward.end(), by_label);
+   std::sort(backward.begin(), backward.end(), by_label);
+   std::vector<size_t> labels;
+   labels.reserve(forward.size() + backward.size());
+   for(const auto v : backward)
+   {
+      labels.push_back(topological_label[v]);
+   }
+   for(const auto v : forward)
+   {
+      labels.push_back(topological_label[v]);
+   }
+   std::sort(labels.begin(), labels.end());
+   auto label_it = labels.begin();
+   for(const auto v : backward)
+   {
+      topological_label[v] = *label_it++;
+   }
+   for(const auto v : forward)
+   {
+      topological_label[v] = *label_it++;
+   }
+}
+
+bool DesignFlowGraph::IsReachable(vertex_descriptor x, vertex_descriptor y) const
+{
+   if(!acyclic)
+   {
+      return graph_t::IsReachable(x, y);
+   }
+   const auto x_label = topological_label[x];
+   const auto y_label = topological_label[y];
+   if(x_label >= y_label)
+   {
+      return false;
+   }
+   if(ExistsEdge(x, y))
+   {
+      return true;
+   }
+   /// Bidirectional search restricted to the vertices whose labels are between the ones of x and y
+   ++search_epoch;
+   std::vector<vertex_descriptor> forward(1, x), backward(1, y), next;
+   forward_mark[x] = search_epoch;
+   backward_mark[y] = search_epoch;
+   while(!forward.empty() && !backward.empty())
+   {
+      next.clear();
+      if(forward.size() <= backward.size())
+      {
+         for(const auto v : forward)
+         {
+            for(const auto& oe : boost::make_iterator_range(boost::out_edges(v, *this)))
+            {
+               const auto w = boost::target(oe, *this);
+               if(backward_mark[w] == search_epoch)
+               {
+                  return true;
+               }
+               if(topological_label[w] < y_label && forward_mark[w] != search_epoch)
+               {
+                  forward_mark[w] = search_epoch;
+                  next.push_back(w);
+               }
+            }
+         }
+         forward.swap(next);
+      }
+      else
+      {
+         for(const auto v : backward)
+         {
+            for(const auto& ie : boost::make_iterator_range(boost::in_edges(v, *this)))
+            {
+               const auto w = boost::source(ie, *this);
+               if(forward_mark[w] == search_epoch)
+               {
+                  return true;
+               }
+               if(topological_label[w] > x_label && backward_mark[w] != search_epoch)
+               {
+                  backward_mark[w] = search_epoch;
+                  next.push_back(w);
+               }
+            }
+         }
+         backward.swap(next);
+      }
+   }
+   return false;
+}
+
 DesignFlowEdge DesignFlowGraph::AddType(edge_descriptor e, DesignFlowEdge type)
 {
    return GetEdgeInfo(e) |= type;
@@ -54,6 +54,7 @@
 #include <cstddef>
 #include <iosfwd>
 #include <string>
+#include <vector>
 
 CONSTREF_FORWARD_DECL(Parameter);
 CONSTREF_FORWARD_DECL(DesignFlowStepInfo);
@@ -108,6 +109,8 @@ class DesignFlowGraph
       FEEDBACK = 8
    };
 
+   DesignFlowGraph();
+
    /**
     * Add a design step
     * @param design_flow_step is the step to be added
@@ -127,6 +130,15 @@ class DesignFlowGraph
 
    DesignFlowEdge RemoveType(edge_descriptor e, DesignFlowEdge type);
 
+   /**
+    * Check if y is reachable from x. Unless the graph contains cycles, the search is pruned by means of the
+    * topological order of the steps, which is kept updated while dependences are added.
+    * @param x is the source vertex
+    * @param y is the target vertex
+    * @return true if there is a non-empty path from x to y
+    */
+   bool IsReachable(vertex_descriptor x, vertex_descriptor y) const;
+
    /**
     * Write this graph in dot format
     * @param file_name is the file where the graph has to be printed
@@ -139,6 +151,27 @@ class DesignFlowGraph
    using graph_t::WriteDot;
 
    CustomUnorderedMap<DesignFlowStep::signature_t, vertex_descriptor> signature_to_vertex;
+
+   /// Topological labels of the vertices: for each edge (u, v) topological_label[u] < topological_label[v]
+   std::vector<size_t> topological_label;
+
+   /// Lowest and highest topological labels assigned so far
+   size_t min_label;
+   size_t max_label;
+
+   /// False once a cycle has been introduced, so that the topological order is no more maintained
+   bool acyclic;
+
+   /// Marks of the vertices visited by the last forward and backward searches
+   mutable std::vector<size_t> forward_mark;
+   mutable std::vector<size_t> backward_mark;
+   mutable size_t search_epoch;
+
+   /**
+    * Restore the topological order before adding the edge (src, tgt), moving only the vertices whose labels are
+    * between the ones of tgt and src (Pearce-Kelly algorithm)
+    */
+   void UpdateTopologicalOrder(vertex_descriptor src, vertex_descriptor tgt);
 };
 using DesignFlowGraphRef = refcount<DesignFlowGraph>;
 using DesignFlowGraphConstRef = refcount<const DesignFlowGraph>;
@@ -52,8 +52,10 @@
 #include "design_flow_graph.hpp"
 #include "design_flow_step.hpp"
 #include "design_flow_step_factory.hpp"
+#include "design_flow_trace.hpp"
 #include "exceptions.hpp"
 #include "string_manipulation.hpp"
+#include "thread_pool.hpp"
 
 #include <absl/numeric/int128.h>
 
@@ -63,9 +65,12 @@
 #include <boost/iterator/iterator_facade.hpp>
 #include <boost/tuple/tuple.hpp>
 
+#include <exception>
+#include <future>
 #include <iterator>
 #include <list>
 #include <utility>
+#include <vector>
 
 #include "config_HAVE_ASSERTS.hpp"
 #include "config_HAVE_UNORDERED.hpp"
@@ -212,6 +217,25 @@ class DesignFlowStepPrioritySet
       return v;
    }
 
+   /**
+    * @brief Remove vertex from the set
+    *
+    * @param v Vertex to remove
+    * @return true If vertex was present in the set
+    * @return false If vertex was not found
+    */
+   bool erase(const vertex_descriptor v)
+   {
+      const auto k_it = _keys_map.find(v);
+      if(k_it != _keys_map.end())
+      {
+         _steps_map.erase(k_it->second);
+         _keys_map.erase(k_it);
+         return true;
+      }
+      return false;
+   }
+
    map_t::size_type size() const
    {
       return _steps_map.size();
@@ -228,12 +252,71 @@ class DesignFlowStepPrioritySet
    }
 };
 
+static std::string StatusToString(DesignFlowStep_Status status)
+{
+   switch(status)
+   {
+      case DesignFlowStep_Status::ABORTED:
+         return "ABORTED";
+      case DesignFlowStep_Status::EMPTY:
+         return "EMPTY";
+      case DesignFlowStep_Status::NONEXISTENT:
+         return "NONEXISTENT";
+      case DesignFlowStep_Status::SKIPPED:
+         return "SKIPPED";
+      case DesignFlowStep_Status::SUCCESS:
+         return "SUCCESS";
+      case DesignFlowStep_Status::UNCHANGED:
+         return "UNCHANGED";
+      case DesignFlowStep_Status::UNEXECUTED:
+         return "UNEXECUTED";
+      case DesignFlowStep_Status::UNNECESSARY:
+         return "UNNECESSARY";
+      default:
+         THROW_UNREACHABLE("");
+   }
+   return "";
+}
+
+/**
+ * Return the flow trace arguments describing a step execution
+ * @param step is the executed step
+ * @param status is the status returned by the step
+ * @param peak_rss_delta is the increase of the peak resident set size (in kilobytes) during the execution
+ */
+static DesignFlowTrace::args_t StepTraceArgs(const DesignFlowStepRef& step, DesignFlowStep_Status status,
+                                             long peak_rss_delta)
+{
+   DesignFlowTrace::args_t args;
+   args.emplace_back("status", DesignFlowTrace::Quote(StatusToString(status)));
+   if(step->GetFunctionId())
+   {
+      args.emplace_back("function_id", STR(step->GetFunctionId()));
+   }
+   args.emplace_back("peak_rss_delta_kb", STR(peak_rss_delta));
+   return args;
+}
+
+/**
+ * Return the flow trace arguments describing a step execution interrupted by an error
+ */
+static DesignFlowTrace::args_t FailedStepTraceArgs()
+{
+   return {{"status", DesignFlowTrace::Quote("FAILED")}};
+}
+
 DesignFlowManager::DesignFlowManager(const ParameterConstRef _parameters)
     : design_flow_graph(new DesignFlowGraph()),
 #ifndef NDEBUG
       feedback_design_flow_graph(new DesignFlowGraph()),
 #endif
       possibly_ready(new DesignFlowStepPrioritySet(design_flow_graph)),
+      flow_pool(_parameters->isOption(OPT_flow_jobs) && _parameters->getOption<size_t>(OPT_flow_jobs) > 1 ?
+                    new ThreadPool(_parameters->getOption<size_t>(OPT_flow_jobs)) :
+                    nullptr),
+      flow_trace(_parameters->isOption(OPT_flow_trace) ?
+                     new DesignFlowTrace(_parameters->getOption<std::filesystem::path>(OPT_flow_trace)) :
+                     nullptr),
       step_counter(0),
       parameters(_parameters),
       output_level(_parameters->getOption<int>(OPT_output_level)),
@@ -551,6 +634,19 @@ void DesignFlowManager::Exec()
 #endif
 
    INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "-->Started execution of design flow");
+   /// Writes the trace when the flow is interrupted by an error, so that failing flows produce it too
+   struct FailedFlowTraceWriter
+   {
+      const DesignFlowTraceRef trace;
+      const int uncaught_exceptions;
+      ~FailedFlowTraceWriter()
+      {
+         if(trace && std::uncaught_exceptions() > uncaught_exceptions)
+         {
+            trace->Write();
+         }
+      }
+   } const failed_flow_trace_writer{flow_trace, std::uncaught_exceptions()};
 #ifndef NDEBUG
    if(debug_level >= DEBUG_LEVEL_PARANOIC)
    {
@@ -611,79 +707,7 @@ void DesignFlowManager::Exec()
                      "-->Beginning iteration number " + STR(step_counter) + " - Considering step " + step->GetName());
 
       /// Now check if next is actually ready
-      /// First of all check if there are new dependence to add
-      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "-->Recomputing dependences");
-      DesignFlowStepSet step_dependencies, step_precedence;
-      CustomUnorderedSet<std::pair<DesignFlowStep::signature_t, bool>> already_addsteps;
-      step->ComputeRelationships(step_dependencies, DesignFlowStep::DEPENDENCE_RELATIONSHIP);
-      RecursivelyAddSteps(step_dependencies, dfs_info->status == DesignFlowStep_Status::UNNECESSARY, already_addsteps);
-      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Recomputed dependences");
-      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "-->Recomputing precedences");
-      step->ComputeRelationships(step_precedence, DesignFlowStep::PRECEDENCE_RELATIONSHIP);
-      RecursivelyAddSteps(step_precedence, true, already_addsteps);
-      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Recomputed precedences");
-      bool current_ready = true;
-      for(const auto& dep : step_dependencies)
-      {
-         const auto dep_v = design_flow_graph->GetDesignFlowStep(dep->GetSignature());
-         AddDesignFlowDependence(dep_v, next, DesignFlowGraph::DEPENDENCE);
-         const auto& pre_info = design_flow_graph->GetNodeInfo(dep_v);
-         switch(pre_info->status)
-         {
-            case DesignFlowStep_Status::ABORTED:
-            case DesignFlowStep_Status::EMPTY:
-            case DesignFlowStep_Status::SKIPPED:
-            case DesignFlowStep_Status::SUCCESS:
-            case DesignFlowStep_Status::UNCHANGED:
-            {
-               break;
-            }
-            case DesignFlowStep_Status::UNNECESSARY:
-            case DesignFlowStep_Status::UNEXECUTED:
-            {
-               current_ready = false;
-               break;
-            }
-            case DesignFlowStep_Status::NONEXISTENT:
-            default:
-            {
-               THROW_UNREACHABLE("");
-            }
-         }
-      }
-      /// Now iterate on ingoing precedence edge
-      for(const auto& prec : step_precedence)
-      {
-         const auto prec_v = design_flow_graph->GetDesignFlowStep(prec->GetSignature());
-         AddDesignFlowDependence(prec_v, next, DesignFlowGraph::PRECEDENCE);
-         const auto& pre_info = design_flow_graph->GetNodeInfo(prec_v);
-         switch(pre_info->status)
-         {
-            case DesignFlowStep_Status::ABORTED:
-            case DesignFlowStep_Status::EMPTY:
-            case DesignFlowStep_Status::SKIPPED:
-            case DesignFlowStep_Status::SUCCESS:
-            case DesignFlowStep_Status::UNCHANGED:
-            {
-               break;
-            }
-            case DesignFlowStep_Status::UNNECESSARY:
-            case DesignFlowStep_Status::UNEXECUTED:
-            {
-               current_ready = false;
-               break;
-            }
-            case DesignFlowStep_Status::NONEXISTENT:
-            {
-               THROW_UNREACHABLE("Step with nonexitent status");
-               break;
-            }
-            default:
-            {
-               THROW_UNREACHABLE("");
-            }
-         }
-      }
+      const auto current_ready = UpdateRelationships(next);
       if(profile_dfm)
       {
          STOP_TIME(before_time);
@@ -708,11 +732,24 @@ void DesignFlowManager::Exec()
          }
          continue;
       }
+      bool executed_concurrently = false;
+      bool batch_invalidations = false;
       if(dfs_info->status == DesignFlowStep_Status::UNNECESSARY)
       {
          INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level,
                         "---Skipping execution of " + step->GetName() + " since unnecessary");
          dfs_info->status = DesignFlowStep_Status::SKIPPED;
+         if(flow_trace)
+         {
+            flow_trace->AddInstant(step->GetName(), "skip", {{"status", DesignFlowTrace::Quote("UNNECESSARY")}});
+         }
+      }
+      else if(flow_pool && step->CanRunConcurrently() && step->HasToBeExecuted())
+      {
+         executed_concurrently = true;
+         const auto batch = CollectConcurrentSteps(next);
+         step_counter += batch.size() - 1;
+         executed_passes += ExecuteConcurrentSteps(batch, batch_invalidations, disable_invalidations, profile_steps);
       }
       else if(step->HasToBeExecuted())
       {
@@ -725,12 +762,25 @@ void DesignFlowManager::Exec()
          {
             START_TIME(step_execution_time);
          }
-         step->Initialize();
-         if(step->CGetDebugLevel() >= DEBUG_LEVEL_VERY_PEDANTIC)
+         const auto trace_start = flow_trace ? flow_trace->Now() : 0;
+         const auto trace_peak_rss = flow_trace ? GetPeakResidentMemory() : 0;
+         try
          {
-            step->PrintInitialIR();
+            step->Initialize();
+            if(step->CGetDebugLevel() >= DEBUG_LEVEL_VERY_PEDANTIC)
+            {
+               step->PrintInitialIR();
+            }
+            dfs_info->status = step->Exec();
+         }
+         catch(...)
+         {
+            if(flow_trace)
+            {
+               flow_trace->AddEvent(step->GetName(), "step", trace_start, flow_trace->Now(), FailedStepTraceArgs());
+            }
+            throw;
          }
-         dfs_info->status = step->Exec();
          executed_passes++;
          if(step->CGetDebugLevel() >= DEBUG_LEVEL_VERY_PEDANTIC)
          {
@@ -740,6 +790,11 @@ void DesignFlowManager::Exec()
          {
             STOP_TIME(step_execution_time);
          }
+         if(flow_trace)
+         {
+            flow_trace->AddEvent(step->GetName(), "step", trace_start, flow_trace->Now(),
+                                 StepTraceArgs(step, dfs_info->status, GetPeakResidentMemory() - trace_peak_rss));
+         }
          const std::string memory_usage =
 #ifndef NDEBUG
              std::string(" - Virtual Memory: ") + PrintVirtualDataMemoryUsage()
@@ -775,6 +830,10 @@ void DesignFlowManager::Exec()
          INDENT_OUT_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "---Skipping execution of " + step->GetName());
          dfs_info->status = DesignFlowStep_Status::UNCHANGED;
          skipped_passes++;
+         if(flow_trace)
+         {
+            flow_trace->AddInstant(step->GetName(), "skip", {{"status", DesignFlowTrace::Quote("UNCHANGED")}});
+         }
          if(profile_steps)
          {
             step_prof_info.at(next).skipped++;
@@ -785,141 +844,8 @@ void DesignFlowManager::Exec()
       {
          START_TIME(after_time);
       }
-      bool invalidations = false;
-      if(!disable_invalidations)
-      {
-         /// Add steps and edges from post dependencies
-         INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "-->Adding post-dependencies of " + step->GetName());
-         DesignFlowStepSet relationships;
-         step->ComputeRelationships(relationships, DesignFlowStep::INVALIDATION_RELATIONSHIP);
-         INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "---Got steps");
-         if(profile_steps)
-         {
-            step_prof_info.at(next).direct_invalidations += relationships.size();
-         }
-         invalidations = !relationships.empty();
-         CustomUnorderedSet<vertex_descriptor> already_deexecute;
-         for(const auto& relationship : relationships)
-         {
-            const auto relationship_signature = relationship->GetSignature();
-            const auto relationship_vertex = GetDesignFlowStep(relationship_signature);
-            THROW_ASSERT(relationship_vertex, "Missing vertex " + relationship->GetName());
-            if(design_flow_graph->IsReachable(relationship_vertex, next))
-            {
-#ifndef NDEBUG
-               AddDesignFlowDependence(next, relationship_vertex, DesignFlowGraph::FEEDBACK);
-#endif
-               const auto step_count = DeExecute(relationship_vertex, true, already_deexecute);
-               if(profile_steps)
-               {
-                  step_prof_info.at(next).total_invalidations += step_count;
-               }
-            }
-            else
-            {
-#ifndef NDEBUG
-               feedback_design_flow_graph->WriteDot(parameters->getOption<std::filesystem::path>(OPT_dot_directory) /
-                                                    "Design_Flow_Error");
-#endif
-               THROW_UNREACHABLE("Invalidating " +
-                                 design_flow_graph->CGetNodeInfo(relationship_vertex)->design_flow_step->GetName() +
-                                 " which is not before the current one");
-            }
-         }
-         INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Added post-dependencies of " + step->GetName());
-      }
-      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "-->Starting checking of new ready steps");
-      for(const auto& oe : boost::make_iterator_range(boost::out_edges(next, *design_flow_graph)))
-      {
-         const auto target = boost::target(oe, *design_flow_graph);
-         auto& target_info = design_flow_graph->GetNodeInfo(target);
-         switch(target_info->status)
-         {
-            case DesignFlowStep_Status::ABORTED:
-            case DesignFlowStep_Status::EMPTY:
-            case DesignFlowStep_Status::SKIPPED:
-            case DesignFlowStep_Status::SUCCESS:
-            case DesignFlowStep_Status::UNCHANGED:
-            {
-               /// Post dependence previously required and previously executed;
-               /// Now it is not more required, otherwise execution flag should just invalidated
-               continue;
-            }
-            case DesignFlowStep_Status::UNNECESSARY:
-            case DesignFlowStep_Status::UNEXECUTED:
-            {
-               break;
-            }
-            case DesignFlowStep_Status::NONEXISTENT:
-            default:
-            {
-               THROW_UNREACHABLE("");
-            }
-         }
-         INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level,
-                        "-->Examining successor " + target_info->design_flow_step->GetName());
-         bool target_ready = true;
-         for(const auto& ie : boost::make_iterator_range(boost::in_edges(target, *design_flow_graph)))
-         {
-            const auto source = boost::source(ie, *design_flow_graph);
-            const auto& source_info = design_flow_graph->GetNodeInfo(source);
-            INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level,
-                           "-->Examining predecessor " + source_info->design_flow_step->GetName());
-            switch(source_info->status)
-            {
-               case DesignFlowStep_Status::ABORTED:
-               case DesignFlowStep_Status::EMPTY:
-               case DesignFlowStep_Status::SKIPPED:
-               case DesignFlowStep_Status::SUCCESS:
-               case DesignFlowStep_Status::UNCHANGED:
-               {
-                  break;
-               }
-               case DesignFlowStep_Status::UNNECESSARY:
-               case DesignFlowStep_Status::UNEXECUTED:
-               {
-                  target_ready = false;
-                  break;
-               }
-               case DesignFlowStep_Status::NONEXISTENT:
-               default:
-               {
-                  THROW_UNREACHABLE("");
-               }
-            }
-            if(!target_ready)
-            {
-               INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Not ready");
-               break;
-            }
-            INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--");
-         }
-         if(target_ready)
-         {
-            INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level,
-                           "---Adding " + target_info->design_flow_step->GetName() + " to list of ready steps");
-            possibly_ready->insert(target);
-         }
-         INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--");
-      }
-      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Checked new ready steps");
-      CustomOrderedSet<DesignFlowGraph::edge_descriptor> to_be_removeds;
-      for(const auto& ie :
-          boost::make_iterator_range(boost::in_edges(design_flow_graph->CGetGraphInfo()->exit, *design_flow_graph)))
-      {
-         const auto source = boost::source(ie, *design_flow_graph);
-         if(boost::out_degree(source, *design_flow_graph) > 1)
-         {
-            to_be_removeds.insert(ie);
-         }
-      }
-      for(const auto& ie : to_be_removeds)
-      {
-         if(RemoveType(ie, DesignFlowGraph::AUXILIARY) == 0)
-         {
-            RemoveDesignFlowDependence(ie);
-         }
-      }
+      const auto invalidations =
+          executed_concurrently ? batch_invalidations : ProcessExecutedStep(next, disable_invalidations, profile_steps);
       if(profile_dfm)
       {
          STOP_TIME(after_time);
@@ -1026,10 +952,443 @@ void DesignFlowManager::Exec()
       csv_report_stream.close();
       INDENT_OUT_MEX(OUTPUT_LEVEL_NONE, output_level, "---Steps execution statistics stored in " + csv_report.string());
    }
+   if(flow_trace)
+   {
+      flow_trace->Write();
+      INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level,
+                     "---Design flow trace stored in " + parameters->getOption<std::string>(OPT_flow_trace));
+   }
    INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "---Total number of iterations: " + STR(step_counter));
    INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Ended execution of design flow");
 }
 
+bool DesignFlowManager::UpdateRelationships(const vertex_descriptor next)
+{
+   const auto& dfs_info = design_flow_graph->GetNodeInfo(next);
+   const auto& step = dfs_info->design_flow_step;
+   const auto trace_start = flow_trace ? flow_trace->Now() : 0;
+   /// First of all check if there are new dependence to add
+   INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "-->Recomputing dependences");
+   DesignFlowStepSet step_dependencies, step_precedence;
+   CustomUnorderedSet<std::pair<DesignFlowStep::signature_t, bool>> already_addsteps;
+   step->ComputeRelationships(step_dependencies, DesignFlowStep::DEPENDENCE_RELATIONSHIP);
+   RecursivelyAddSteps(step_dependencies, dfs_info->status == DesignFlowStep_Status::UNNECESSARY, already_addsteps);
+   INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Recomputed dependences");
+   INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "-->Recomputing precedences");
+   step->ComputeRelationships(step_precedence, DesignFlowStep::PRECEDENCE_RELATIONSHIP);
+   RecursivelyAddSteps(step_precedence, true, already_addsteps);
+   INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Recomputed precedences");
+   bool current_ready = true;
+   for(const auto& dep : step_dependencies)
+   {
+      const auto dep_v = design_flow_graph->GetDesignFlowStep(dep->GetSignature());
+      AddDesignFlowDependence(dep_v, next, DesignFlowGraph::DEPENDENCE);
+      const auto& pre_info = design_flow_graph->GetNodeInfo(dep_v);
+      switch(pre_info->status)
+      {
+         case DesignFlowStep_Status::ABORTED:
+         case DesignFlowStep_Status::EMPTY:
+         case DesignFlowStep_Status::SKIPPED:
+         case DesignFlowStep_Status::SUCCESS:
+         case DesignFlowStep_Status::UNCHANGED:
+         {
+            break;
+         }
+         case DesignFlowStep_Status::UNNECESSARY:
+         case DesignFlowStep_Status::UNEXECUTED:
+         {
+            current_ready = false;
+            break;
+         }
+         case DesignFlowStep_Status::NONEXISTENT:
+         default:
+         {
+            THROW_UNREACHABLE("");
+         }
+      }
+   }
+   /// Now iterate on ingoing precedence edge
+   for(const auto& prec : step_precedence)
+   {
+      const auto prec_v = design_flow_graph->GetDesignFlowStep(prec->GetSignature());
+      AddDesignFlowDependence(prec_v, next, DesignFlowGraph::PRECEDENCE);
+      const auto& pre_info = design_flow_graph->GetNodeInfo(prec_v);
+      switch(pre_info->status)
+      {
+         case DesignFlowStep_Status::ABORTED:
+         case DesignFlowStep_Status::EMPTY:
+         case DesignFlowStep_Status::SKIPPED:
+         case DesignFlowStep_Status::SUCCESS:
+         case DesignFlowStep_Status::UNCHANGED:
+         {
+            break;
+         }
+         case DesignFlowStep_Status::UNNECESSARY:
+         case DesignFlowStep_Status::UNEXECUTED:
+         {
+            current_ready = false;
+            break;
+         }
+         case DesignFlowStep_Status::NONEXISTENT:
+         {
+            THROW_UNREACHABLE("Step with nonexitent status");
+            break;
+         }
+         default:
+         {
+            THROW_UNREACHABLE("");
+         }
+      }
+   }
+   if(flow_trace)
+   {
+      flow_trace->AddEvent("Relationships of " + step->GetName(), "relationships", trace_start, flow_trace->Now(),
+                           {{"ready", current_ready ? "true" : "false"}});
+   }
+   return current_ready;
+}
+
+bool DesignFlowManager::ProcessExecutedStep(const vertex_descriptor next, const bool disable_invalidations,
+                                            const bool profile_steps)
+{
+   const auto& step = design_flow_graph->CGetNodeInfo(next)->design_flow_step;
+   bool invalidations = false;
+   if(!disable_invalidations)
+   {
+      /// Add steps and edges from post dependencies
+      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "-->Adding post-dependencies of " + step->GetName());
+      const auto trace_start = flow_trace ? flow_trace->Now() : 0;
+      size_t trace_deexecuted = 0;
+      DesignFlowStepSet relationships;
+      step->ComputeRelationships(relationships, DesignFlowStep::INVALIDATION_RELATIONSHIP);
+      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "---Got steps");
+      if(profile_steps)
+      {
+         step_prof_info.at(next).direct_invalidations += relationships.size();
+      }
+      invalidations = !relationships.empty();
+      CustomUnorderedSet<vertex_descriptor> already_deexecute;
+      for(const auto& relationship : relationships)
+      {
+         const auto relationship_signature = relationship->GetSignature();
+         const auto relationship_vertex = GetDesignFlowStep(relationship_signature);
+         THROW_ASSERT(relationship_vertex, "Missing vertex " + relationship->GetName());
+         if(design_flow_graph->IsReachable(relationship_vertex, next))
+         {
+#ifndef NDEBUG
+            AddDesignFlowDependence(next, relationship_vertex, DesignFlowGraph::FEEDBACK);
+#endif
+            const auto deexecute_start = flow_trace ? flow_trace->Now() : 0;
+            const auto step_count = DeExecute(relationship_vertex, true, already_deexecute);
+            if(profile_steps)
+            {
+               step_prof_info.at(next).total_invalidations += step_count;
+            }
+            if(flow_trace)
+            {
+               flow_trace->AddEvent("DeExecute " + relationship->GetName(), "deexecute", deexecute_start,
+                                    flow_trace->Now(), {{"deexecuted_steps", STR(step_count)}});
+               trace_deexecuted += step_count;
+            }
+         }
+         else
+         {
+#ifndef NDEBUG
+            feedback_design_flow_graph->WriteDot(parameters->getOption<std::filesystem::path>(OPT_dot_directory) /
+                                                 "Design_Flow_Error");
+#endif
+            THROW_UNREACHABLE("Invalidating " +
+                              design_flow_graph->CGetNodeInfo(relationship_vertex)->design_flow_step->GetName() +
+                              " which is not before the current one");
+         }
+      }
+      if(flow_trace && invalidations)
+      {
+         flow_trace->AddEvent("Invalidations of " + step->GetName(), "invalidation", trace_start, flow_trace->Now(),
+                              {{"invalidated_steps", STR(relationships.size())},
+                               {"deexecuted_steps", STR(trace_deexecuted)}});
+      }
+      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Added post-dependencies of " + step->GetName());
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "-->Starting checking of new ready steps");
+   for(const auto& oe : boost::make_iterator_range(boost::out_edges(next, *design_flow_graph)))
+   {
+      const auto target = boost::target(oe, *design_flow_graph);
+      auto& target_info = design_flow_graph->GetNodeInfo(target);
+      switch(target_info->status)
+      {
+         case DesignFlowStep_Status::ABORTED:
+         case DesignFlowStep_Status::EMPTY:
+         case DesignFlowStep_Status::SKIPPED:
+         case DesignFlowStep_Status::SUCCESS:
+         case DesignFlowStep_Status::UNCHANGED:
+         {
+            /// Post dependence previously required and previously executed;
+            /// Now it is not more required, otherwise execution flag should just invalidated
+            continue;
+         }
+         case DesignFlowStep_Status::UNNECESSARY:
+         case DesignFlowStep_Status::UNEXECUTED:
+         {
+            break;
+         }
+         case DesignFlowStep_Status::NONEXISTENT:
+         default:
+         {
+            THROW_UNREACHABLE("");
+         }
+      }
+      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level,
+                     "-->Examining successor " + target_info->design_flow_step->GetName());
+      bool target_ready = true;
+      for(const auto& ie : boost::make_iterator_range(boost::in_edges(target, *design_flow_graph)))
+      {
+         const auto source = boost::source(ie, *design_flow_graph);
+         const auto& source_info = design_flow_graph->GetNodeInfo(source);
+         INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level,
+                        "-->Examining predecessor " + source_info->design_flow_step->GetName());
+         switch(source_info->status)
+         {
+            case DesignFlowStep_Status::ABORTED:
+            case DesignFlowStep_Status::EMPTY:
+            case DesignFlowStep_Status::SKIPPED:
+            case DesignFlowStep_Status::SUCCESS:
+            case DesignFlowStep_Status::UNCHANGED:
+            {
+               break;
+            }
+            case DesignFlowStep_Status::UNNECESSARY:
+            case DesignFlowStep_Status::UNEXECUTED:
+            {
+               target_ready = false;
+               break;
+            }
+            case DesignFlowStep_Status::NONEXISTENT:
+            default:
+            {
+               THROW_UNREACHABLE("");
+            }
+         }
+         if(!target_ready)
+         {
+            INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Not ready");
+            break;
+         }
+         INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--");
+      }
+      if(target_ready)
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level,
+                        "---Adding " + target_info->design_flow_step->GetName() + " to list of ready steps");
+         possibly_ready->insert(target);
+      }
+      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--");
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Checked new ready steps");
+   CustomOrderedSet<DesignFlowGraph::edge_descriptor> to_be_removeds;
+   for(const auto& ie :
+       boost::make_iterator_range(boost::in_edges(design_flow_graph->CGetGraphInfo()->exit, *design_flow_graph)))
+   {
+      const auto source = boost::source(ie, *design_flow_graph);
+      if(boost::out_degree(source, *design_flow_graph) > 1)
+      {
+         to_be_removeds.insert(ie);
+      }
+   }
+   for(const auto& ie : to_be_removeds)
+   {
+      if(RemoveType(ie, DesignFlowGraph::AUXILIARY) == 0)
+      {
+         RemoveDesignFlowDependence(ie);
+      }
+   }
+   return invalidations;
+}
+
+bool DesignFlowManager::IsReady(const vertex_descriptor v) const
+{
+   for(const auto& ie : boost::make_iterator_range(boost::in_edges(v, *design_flow_graph)))
+   {
+      switch(design_flow_graph->CGetNodeInfo(boost::source(ie, *design_flow_graph))->status)
+      {
+         case DesignFlowStep_Status::ABORTED:
+         case DesignFlowStep_Status::EMPTY:
+         case DesignFlowStep_Status::SKIPPED:
+         case DesignFlowStep_Status::SUCCESS:
+         case DesignFlowStep_Status::UNCHANGED:
+         {
+            break;
+         }
+         case DesignFlowStep_Status::UNNECESSARY:
+         case DesignFlowStep_Status::UNEXECUTED:
+         {
+            return false;
+         }
+         case DesignFlowStep_Status::NONEXISTENT:
+         default:
+         {
+            THROW_UNREACHABLE("");
+         }
+      }
+   }
+   return true;
+}
+
+std::vector<DesignFlowManager::vertex_descriptor>
+DesignFlowManager::CollectConcurrentSteps(const vertex_descriptor first)
+{
+   std::vector<vertex_descriptor> batch(1, first);
+   CustomUnorderedSet<unsigned long long> contexts;
+   contexts.insert(
+       DesignFlowStep::GetSignatureContext(design_flow_graph->CGetNodeInfo(first)->design_flow_step->GetSignature()));
+   /// Candidates are considered in the same order in which the serial engine would extract them
+   std::vector<vertex_descriptor> candidates;
+   for(const auto& [step_key, ready_step] : *possibly_ready)
+   {
+      const auto& ready_info = design_flow_graph->CGetNodeInfo(ready_step);
+      if(ready_info->status == DesignFlowStep_Status::UNEXECUTED &&
+         ready_info->design_flow_step->CanRunConcurrently())
+      {
+         candidates.push_back(ready_step);
+      }
+   }
+   for(const auto candidate : candidates)
+   {
+      if(batch.size() >= flow_pool->size())
+      {
+         break;
+      }
+      const auto& candidate_info = design_flow_graph->GetNodeInfo(candidate);
+      const auto& candidate_step = candidate_info->design_flow_step;
+      const auto context = DesignFlowStep::GetSignatureContext(candidate_step->GetSignature());
+      if(contexts.count(context))
+      {
+         continue;
+      }
+      possibly_ready->erase(candidate);
+      if(!UpdateRelationships(candidate))
+      {
+         /// As in the serial engine, the step will be inserted again when its new dependencies have been executed
+         INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level,
+                        "---" + candidate_step->GetName() + " is not ready after recomputing relationships");
+         continue;
+      }
+      if(candidate_info->status != DesignFlowStep_Status::UNEXECUTED || !candidate_step->HasToBeExecuted())
+      {
+         /// Skipped steps are left to the serial engine
+         possibly_ready->insert(candidate);
+         continue;
+      }
+      contexts.insert(context);
+      batch.push_back(candidate);
+   }
+   return batch;
+}
+
+size_t DesignFlowManager::ExecuteConcurrentSteps(const std::vector<vertex_descriptor>& batch, bool& invalidations,
+                                                 const bool disable_invalidations, const bool profile_steps)
+{
+   using exec_result_t = std::pair<DesignFlowStep_Status, long>;
+   INDENT_OUT_MEX(OUTPUT_LEVEL_VERY_PEDANTIC, output_level,
+                  "-->Starting concurrent execution of " + STR(batch.size()) + " steps");
+   std::vector<std::future<exec_result_t>> results;
+   results.reserve(batch.size());
+   /// Initialization is not guaranteed to be thread safe, so it is performed before dispatching
+   for(const auto v : batch)
+   {
+      const auto step = design_flow_graph->CGetNodeInfo(v)->design_flow_step;
+      INDENT_OUT_MEX(OUTPUT_LEVEL_VERY_PEDANTIC, output_level, "---Dispatching " + step->GetName());
+      step->Initialize();
+      if(step->CGetDebugLevel() >= DEBUG_LEVEL_VERY_PEDANTIC)
+      {
+         step->PrintInitialIR();
+      }
+      const auto trace = flow_trace;
+      const auto step_name = trace ? step->GetName() : "";
+      results.push_back(flow_pool->Submit([step, trace, step_name]() -> exec_result_t {
+         /// processor time of the worker thread, the same measure taken by the serial engine for a single step
+         long step_execution_time = 0;
+         START_TTIME(step_execution_time);
+         const auto trace_start = trace ? trace->Now() : 0;
+         const auto trace_peak_rss = trace ? GetPeakResidentMemory() : 0;
+         DesignFlowStep_Status status;
+         try
+         {
+            status = step->Exec();
+         }
+         catch(...)
+         {
+            if(trace)
+            {
+               trace->AddEvent(step_name, "step", trace_start, trace->Now(), FailedStepTraceArgs());
+            }
+            throw;
+         }
+         if(trace)
+         {
+            trace->AddEvent(step_name, "step", trace_start, trace->Now(),
+                            StepTraceArgs(step, status, GetPeakResidentMemory() - trace_peak_rss));
+         }
+         STOP_TTIME(step_execution_time);
+         return std::make_pair(status, step_execution_time);
+      }));
+   }
+   /// All the workers have to be completed before any result (or exception) is considered
+   for(auto& result : results)
+   {
+      result.wait();
+   }
+   /// Results are committed in extraction order, so that invalidations are processed as in the serial engine
+   size_t committed = 0;
+   for(size_t i = 0; i < batch.size(); ++i)
+   {
+      const auto v = batch.at(i);
+      const auto& dfs_info = design_flow_graph->GetNodeInfo(v);
+      const auto& step = dfs_info->design_flow_step;
+      const auto [status, step_execution_time] = results.at(i).get();
+      if(!IsReady(v))
+      {
+         /// A previously committed step invalidated one of its dependencies: the serial engine would not have executed
+         /// it, so the result is discarded and the step will be executed again once it becomes ready
+         INDENT_OUT_MEX(OUTPUT_LEVEL_VERY_PEDANTIC, output_level,
+                        "---Discarding execution of " + step->GetName() + " since it has been invalidated");
+         if(flow_trace)
+         {
+            flow_trace->AddInstant(step->GetName(), "discard");
+         }
+         continue;
+      }
+      dfs_info->status = status;
+      ++committed;
+      if(step->CGetDebugLevel() >= DEBUG_LEVEL_VERY_PEDANTIC)
+      {
+         step->PrintFinalIR();
+      }
+      if(profile_steps)
+      {
+         auto& spi = step_prof_info.at(v);
+         spi.accumulated_execution_time += step_execution_time;
+         if(dfs_info->status == DesignFlowStep_Status::SUCCESS)
+         {
+            spi.success++;
+         }
+         else if(dfs_info->status == DesignFlowStep_Status::UNCHANGED)
+         {
+            spi.unchanged++;
+         }
+      }
+      INDENT_OUT_MEX(OUTPUT_LEVEL_VERY_PEDANTIC, output_level,
+                     "---Ended execution of " + step->GetName() +
+                         (dfs_info->status == DesignFlowStep_Status::UNCHANGED ?
+                              ":=" :
+                              (dfs_info->status == DesignFlowStep_Status::SUCCESS ? ":+" : "")) +
+                         " in " + print_cpu_time(step_execution_time) + " seconds");
+      invalidations |= ProcessExecutedStep(v, disable_invalidations, profile_steps);
+   }
+   INDENT_OUT_MEX(OUTPUT_LEVEL_VERY_PEDANTIC, output_level, "<--Ended concurrent execution");
+   return committed;
+}
+
 DesignFlowStepFactoryConstRef DesignFlowManager::CGetDesignFlowStepFactory(DesignFlowStep::StepClass step_class) const
 {
    THROW_ASSERT(design_flow_step_factories.find(step_class) != design_flow_step_factories.end(),
@@ -50,6 +50,7 @@
 #include <cstddef>
 #include <set>
 #include <string>
+#include <vector>
 
 CONSTREF_FORWARD_DECL(DesignFlowGraph);
 REF_FORWARD_DECL(DesignFlowGraph);
@@ -57,7 +58,9 @@ REF_FORWARD_DECL(DesignFlowGraphsCollection);
 enum class DesignFlowStep_Status;
 CONSTREF_FORWARD_DECL(DesignFlowStepFactory);
 REF_FORWARD_DECL(DesignFlowStepInfo);
+REF_FORWARD_DECL(DesignFlowTrace);
 REF_FORWARD_DECL(Parameter);
+REF_FORWARD_DECL(ThreadPool);
 
 class DesignFlowStepPrioritySet;
 
@@ -84,6 +87,12 @@ class DesignFlowManager final
    /// The registered factories
    CustomUnorderedMap<DesignFlowStep::StepClass, DesignFlowStepFactoryConstRef> design_flow_step_factories;
 
+   /// The pool of workers used to execute concurrent steps (null if steps are executed serially)
+   const ThreadPoolRef flow_pool;
+
+   /// The timeline of the flow execution (null if no trace has been requested)
+   const DesignFlowTraceRef flow_trace;
+
    /// Counter of current iteration
    size_t step_counter;
 
@@ -155,6 +164,47 @@ class DesignFlowManager final
       return DeExecute(starting_vertex, force_execution, already_visited);
    }
 
+   /**
+    * Recompute dependencies and precedences of a step, adding the missing steps to the design flow
+    * @param next is the step to be considered
+    * @return true if all the dependencies and precedences of the step have been executed
+    */
+   bool UpdateRelationships(const vertex_descriptor next);
+
+   /**
+    * Check if all the predecessors of a step have been executed
+    * @param v is the step to be considered
+    * @return true if the step is ready
+    */
+   bool IsReady(const vertex_descriptor v) const;
+
+   /**
+    * Manage invalidations of an executed step and look for new ready steps
+    * @param next is the executed step
+    * @param disable_invalidations specifies if invalidations have to be ignored
+    * @param profile_steps specifies if step statistics have to be collected
+    * @return true if the step invalidated some other step
+    */
+   bool ProcessExecutedStep(const vertex_descriptor next, const bool disable_invalidations, const bool profile_steps);
+
+   /**
+    * Extract from the ready steps the ones which can be executed concurrently with a given step
+    * @param first is the step which has already been selected for execution
+    * @return the steps to be executed concurrently (first included), in extraction order
+    */
+   std::vector<vertex_descriptor> CollectConcurrentSteps(const vertex_descriptor first);
+
+   /**
+    * Execute a set of steps on the worker pool and commit their results in order
+    * @param batch is the set of steps to be executed
+    * @param invalidations is set to true if any step invalidated some other step
+    * @param disable_invalidations specifies if invalidations have to be ignored
+    * @param profile_steps specifies if step statistics have to be collected
+    * @return the number of committed executions
+    */
+   size_t ExecuteConcurrentSteps(const std::vector<vertex_descriptor>& batch, bool& invalidations,
+                                 const bool disable_invalidations, const bool profile_steps);
+
 #ifndef NDEBUG
    void WriteLoopDot() const;
 #endif
@@ -229,6 +279,15 @@ class DesignFlowManager final
     * @return the created design flow step
     */
    DesignFlowStepRef CreateFlowStep(DesignFlowStep::signature_t signature) const;
+
+   /**
+    * Return the pool of workers that serially executed steps may use for their internal parallelism
+    * @return the pool of workers, null if --flow-jobs has not been requested
+    */
+   inline const ThreadPoolRef& CGetThreadPool() const
+   {
+      return flow_pool;
+   }
 };
 
 using DesignFlowManagerRef = refcount<DesignFlowManager>;
@@ -72,6 +72,16 @@ bool DesignFlowStep::IsComposed() const
    return composed;
 }
 
+bool DesignFlowStep::CanRunConcurrently() const
+{
+   return false;
+}
+
+unsigned int DesignFlowStep::GetFunctionId() const
+{
+   return 0;
+}
+
 void DesignFlowStep::Initialize()
 {
 }
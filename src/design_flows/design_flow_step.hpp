@@ -214,6 +214,20 @@ class DesignFlowStep
     */
    bool IsComposed() const;
 
+   /**
+    * Return true if Exec of this step can run on a worker thread together with other concurrent steps working on a
+    * different signature context (e.g., a different function). Such a step must only modify data owned by its own
+    * context, must only read shared data, and must not invalidate steps of other contexts.
+    * @return true if the step can be executed concurrently
+    */
+   virtual bool CanRunConcurrently() const;
+
+   /**
+    * Return the index of the function this step works on
+    * @return the function index, 0 if the step is not function specific
+    */
+   virtual unsigned int GetFunctionId() const;
+
    /**
     * Return the debug level of the step
     * @return the debug level of the step
@@ -0,0 +1,148 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file design_flow_trace.cpp
+ * @brief Timeline of the design flow execution in Chrome Trace Event format.
+ *
+ */
+#include "design_flow_trace.hpp"
+
+#include "exceptions.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+DesignFlowTrace::DesignFlowTrace(const std::filesystem::path& _trace_file)
+    : trace_file(_trace_file), origin(std::chrono::steady_clock::now())
+{
+}
+
+long long DesignFlowTrace::Now() const
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+}
+
+size_t DesignFlowTrace::GetThreadIndex()
+{
+   return threads.emplace(std::this_thread::get_id(), threads.size()).first->second;
+}
+
+void DesignFlowTrace::AddEvent(const std::string& name, const std::string& category, long long start, long long end,
+                               const args_t& args)
+{
+   std::lock_guard<std::mutex> lock(events_mutex);
+   events.push_back(Event{name, category, start, end - start, GetThreadIndex(), args});
+}
+
+void DesignFlowTrace::AddInstant(const std::string& name, const std::string& category, const args_t& args)
+{
+   const auto now = Now();
+   std::lock_guard<std::mutex> lock(events_mutex);
+   events.push_back(Event{name, category, now, -1, GetThreadIndex(), args});
+}
+
+std::string DesignFlowTrace::Quote(const std::string& str)
+{
+   std::string res = "\"";
+   for(const auto c : str)
+   {
+      if(c == '"' || c == '\\')
+      {
+         res.push_back('\\');
+         res.push_back(c);
+      }
+      else if(static_cast<unsigned char>(c) < 0x20)
+      {
+         char escaped[8];
+         std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+         res += escaped;
+      }
+      else
+      {
+         res.push_back(c);
+      }
+   }
+   return res + "\"";
+}
+
+/**
+ * Print a time in nanoseconds as the microseconds expected by the trace viewers
+ */
+static std::string PrintMicroseconds(long long ns)
+{
+   char buffer[32];
+   std::snprintf(buffer, sizeof(buffer), "%lld.%03lld", ns / 1000, ns % 1000);
+   return buffer;
+}
+
+void DesignFlowTrace::Write()
+{
+   std::lock_guard<std::mutex> lock(events_mutex);
+   std::ofstream trace_stream(trace_file);
+   if(!trace_stream)
+   {
+      THROW_WARNING("Unable to write the design flow trace to " + trace_file.string());
+      return;
+   }
+   trace_stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+   trace_stream << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"design flow\"}}";
+   for(const auto& [thread_id, thread] : threads)
+   {
+      trace_stream << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread
+                   << ",\"args\":{\"name\":" << Quote(thread ? "worker " + std::to_string(thread) : "main") << "}}";
+   }
+   for(const auto& event : events)
+   {
+      trace_stream << ",\n{\"name\":" << Quote(event.name) << ",\"cat\":" << Quote(event.category);
+      if(event.duration < 0)
+      {
+         trace_stream << ",\"ph\":\"i\",\"s\":\"t\"";
+      }
+      else
+      {
+         trace_stream << ",\"ph\":\"X\",\"dur\":" << PrintMicroseconds(event.duration);
+      }
+      trace_stream << ",\"ts\":" << PrintMicroseconds(event.start) << ",\"pid\":1,\"tid\":" << event.thread;
+      if(!event.args.empty())
+      {
+         trace_stream << ",\"args\":{";
+         for(auto it = event.args.begin(); it != event.args.end(); ++it)
+         {
+            trace_stream << (it != event.args.begin() ? "," : "") << Quote(it->first) << ":" << it->second;
+         }
+         trace_stream << "}";
+      }
+      trace_stream << "}";
+   }
+   trace_stream << "\n]}\n";
+}
@@ -0,0 +1,142 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file design_flow_trace.hpp
+ * @brief Timeline of the design flow execution in Chrome Trace Event format.
+ *
+ * The produced file can be loaded in chrome://tracing or in the Perfetto UI.
+ *
+ */
+#ifndef DESIGN_FLOW_TRACE_HPP
+#define DESIGN_FLOW_TRACE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class DesignFlowTrace
+{
+ public:
+   /// Name and JSON encoded value of the arguments of an event
+   using args_t = std::vector<std::pair<std::string, std::string>>;
+
+ private:
+   struct Event
+   {
+      /// The name of the event
+      std::string name;
+
+      /// The category of the event
+      std::string category;
+
+      /// Start time in nanoseconds from the creation of the trace
+      long long start;
+
+      /// Duration in nanoseconds (negative for instant events)
+      long long duration;
+
+      /// The index of the thread which generated the event
+      size_t thread;
+
+      /// The arguments of the event
+      args_t args;
+   };
+
+   /// The file where the trace is written
+   const std::filesystem::path trace_file;
+
+   /// Reference point of the timestamps
+   const std::chrono::steady_clock::time_point origin;
+
+   /// The recorded events
+   std::vector<Event> events;
+
+   /// Compact index of each thread which generated events
+   std::map<std::thread::id, size_t> threads;
+
+   /// Mutex protecting events and threads, since concurrent steps record their events from the worker threads
+   std::mutex events_mutex;
+
+   /**
+    * Return the index of the calling thread; events_mutex must be held
+    */
+   size_t GetThreadIndex();
+
+ public:
+   /**
+    * Constructor
+    * @param trace_file is the file where the trace is written
+    */
+   explicit DesignFlowTrace(const std::filesystem::path& trace_file);
+
+   /**
+    * Return the current time in nanoseconds from the creation of the trace
+    */
+   long long Now() const;
+
+   /**
+    * Record an event with a duration on the calling thread
+    * @param name is the name of the event
+    * @param category is the category of the event
+    * @param start is the start time returned by Now()
+    * @param end is the end time returned by Now()
+    * @param args are the arguments of the event
+    */
+   void AddEvent(const std::string& name, const std::string& category, long long start, long long end,
+                 const args_t& args = args_t());
+
+   /**
+    * Record an instant event on the calling thread
+    * @param name is the name of the event
+    * @param category is the category of the event
+    * @param args are the arguments of the event
+    */
+   void AddInstant(const std::string& name, const std::string& category, const args_t& args = args_t());
+
+   /**
+    * Encode a string as a JSON value
+    */
+   static std::string Quote(const std::string& str);
+
+   /**
+    * Write the recorded events to the trace file
+    */
+   void Write();
+};
+#endif
@@ -42,6 +42,7 @@
 
 #include "config_PANDA_DATA_INSTALLDIR.hpp"
 
+#include "Parameter.hpp"
 #include "custom_set.hpp"
 #include "fileIO.hpp"
 #include "string_manipulation.hpp"
@@ -84,7 +85,14 @@ DesignFlowStep_Status LoadDefaultTechnology::Exec()
       {
          XMLDomParser parser(relocate_compiler_path(PANDA_DATA_INSTALLDIR "/panda/design_flows/technology/", true) +
                              builtin_resources_data[i]);
-         parser.Exec();
+         if(parameters->isOption(OPT_technology_cache))
+         {
+            parser.Exec(parameters->getOption<std::filesystem::path>(OPT_technology_cache));
+         }
+         else
+         {
+            parser.Exec();
+         }
          if(parser)
          {
             // Walk the tree:
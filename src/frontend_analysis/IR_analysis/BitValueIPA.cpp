@@ -464,7 +464,7 @@ DesignFlowStep_Status BitValueIPA::Exec()
                      for(const auto& i : call_edge_info->direct_call_points)
                      {
                         INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "-->examining direct call point " + STR(i));
-                        std::deque<bit_lattice> res_tmp;
+                        bitstring res_tmp;
                         THROW_ASSERT(i, "unexpected condition");
                         const auto call_node = TM->GetTreeNode(i);
                         if(call_node->get_kind() == gimple_assign_K)
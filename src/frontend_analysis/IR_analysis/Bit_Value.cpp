@@ -104,598 +104,596 @@
 #include "compiler_wrapper.hpp"
 #include "string_manipulation.hpp" // for GET_CLASS
 
-const std::map<bit_lattice, std::map<bit_lattice, std::map<bit_lattice, std::deque<bit_lattice>>>>
-    Bit_Value::plus_expr_map = {
-        // a b carry
+const std::map<bit_lattice, std::map<bit_lattice, std::map<bit_lattice, bitstring>>> Bit_Value::plus_expr_map = {
+    // a b carry
+    {
+        bit_lattice::X,
         {
-            bit_lattice::X,
             {
+                bit_lattice::X,
                 {
-                    bit_lattice::X,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::X},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::X},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::X},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::X},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ZERO, bit_lattice::X},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::ZERO, bit_lattice::X},
                     },
                 },
+            },
+            {
+                bit_lattice::ZERO,
                 {
-                    bit_lattice::ZERO,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ZERO, bit_lattice::ONE},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::ZERO, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::ONE,
                 {
-                    bit_lattice::ONE,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ONE},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ONE, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::U,
                 {
-                    bit_lattice::U,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
             },
         },
+    },
+    {
+        bit_lattice::ZERO,
         {
-            bit_lattice::ZERO,
             {
+                bit_lattice::X,
                 {
-                    bit_lattice::X,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ZERO, bit_lattice::ONE},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::ZERO, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::ZERO,
                 {
-                    bit_lattice::ZERO,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ZERO, bit_lattice::ONE},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::ZERO, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::ONE,
                 {
-                    bit_lattice::ONE,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ONE},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ONE, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::U,
                 {
-                    bit_lattice::U,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
             },
         },
+    },
+    {
+        bit_lattice::ONE,
         {
-            bit_lattice::ONE,
             {
+                bit_lattice::X,
                 {
-                    bit_lattice::X,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ONE},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ONE, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::ZERO,
                 {
-                    bit_lattice::ZERO,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ONE},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ONE, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::ONE,
                 {
-                    bit_lattice::ONE,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ONE, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ONE, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ONE, bit_lattice::ONE},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::ONE, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::U,
                 {
-                    bit_lattice::U,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ONE, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
             },
         },
+    },
+    {
+        bit_lattice::U,
         {
-            bit_lattice::U,
             {
+                bit_lattice::X,
                 {
-                    bit_lattice::X,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::ZERO,
                 {
-                    bit_lattice::ZERO,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::ONE,
                 {
-                    bit_lattice::ONE,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ONE, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::U,
                 {
-                    bit_lattice::U,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
             },
         },
+    },
 };
 
-const std::map<bit_lattice, std::map<bit_lattice, std::map<bit_lattice, std::deque<bit_lattice>>>>
-    Bit_Value::minus_expr_map = {
-        // a b borrow
+const std::map<bit_lattice, std::map<bit_lattice, std::map<bit_lattice, bitstring>>> Bit_Value::minus_expr_map = {
+    // a b borrow
+    {
+        bit_lattice::X,
         {
-            bit_lattice::X,
             {
+                bit_lattice::X,
                 {
-                    bit_lattice::X,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::X},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::X},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::X},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::X},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ZERO, bit_lattice::X},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::ZERO, bit_lattice::X},
                     },
                 },
+            },
+            {
+                bit_lattice::ZERO,
                 {
-                    bit_lattice::ZERO,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
                     },
                 },
+            },
+            {
+                bit_lattice::ONE,
                 {
-                    bit_lattice::ONE,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ONE, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::U,
                 {
-                    bit_lattice::U,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ZERO, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
             },
         },
+    },
+    {
+        bit_lattice::ZERO,
         {
-            bit_lattice::ZERO,
             {
+                bit_lattice::X,
                 {
-                    bit_lattice::X,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ZERO, bit_lattice::ONE},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::ZERO,
                 {
-                    bit_lattice::ZERO,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ONE, bit_lattice::ONE},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::ONE,
                 {
-                    bit_lattice::ONE,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ONE, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ONE, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ONE, bit_lattice::ONE},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ONE, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::ONE, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::U,
                 {
-                    bit_lattice::U,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ONE, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
             },
         },
+    },
+    {
+        bit_lattice::ONE,
         {
-            bit_lattice::ONE,
             {
+                bit_lattice::X,
                 {
-                    bit_lattice::X,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::ZERO, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::ZERO,
                 {
-                    bit_lattice::ZERO,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ONE},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::ZERO, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::ONE,
                 {
-                    bit_lattice::ONE,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::ZERO},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ONE, bit_lattice::ONE},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::U,
                 {
-                    bit_lattice::U,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
             },
         },
+    },
+    {
+        bit_lattice::U,
         {
-            bit_lattice::U,
             {
+                bit_lattice::X,
                 {
-                    bit_lattice::X,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::ZERO,
                 {
-                    bit_lattice::ZERO,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::ZERO, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::ONE,
                 {
-                    bit_lattice::ONE,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::ONE, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
+            },
+            {
+                bit_lattice::U,
                 {
-                    bit_lattice::U,
                     {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
+                        bit_lattice::ZERO,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::ONE,
+                        {bit_lattice::U, bit_lattice::U},
+                    },
+                    {
+                        bit_lattice::U,
+                        {bit_lattice::U, bit_lattice::U},
                     },
                 },
             },
         },
+    },
 };
 
 const std::map<bit_lattice, std::map<bit_lattice, bit_lattice>> Bit_Value::bit_ior_expr_map = {
@@ -1088,7 +1086,7 @@ DesignFlowStep_Status Bit_Value::InternalExec()
 }
 
 // prints the content of a bitstring map
-void Bit_Value::print_bitstring_map(const CustomMap<unsigned int, std::deque<bit_lattice>>&
+void Bit_Value::print_bitstring_map(const CustomMap<unsigned int, bitstring>&
 #ifndef NDEBUG
                                         map
 #endif
@@ -1273,7 +1271,7 @@ void Bit_Value::initialize()
        * initialization. If this happens, optimizations on ROMs cannot be
        * aggressive enough, with worse cycles and DSP usage for CHStone benchmarks
        */
-      CustomMap<unsigned int, std::deque<bit_lattice>> private_variables;
+      CustomMap<unsigned int, bitstring> private_variables;
       INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "Initializing ROMs loaded ssa bitvalues");
       for(const auto& B : bb_topological)
       {
@@ -1324,7 +1322,7 @@ void Bit_Value::initialize()
                            function_behavior->is_variable_mem(var_node->index) && hm->Rmem->is_sds_var(var_node->index))
                         {
                            const auto vd = GetPointerS<var_decl>(var_node);
-                           std::deque<bit_lattice> current_inf;
+                           bitstring current_inf;
                            if(vd->init->get_kind() == constructor_K)
                            {
                               current_inf = constructor_bitstring(vd->init, lhs_nid);
@@ -1362,7 +1360,7 @@ void Bit_Value::initialize()
                            if(!private_variables.count(var_node->index))
                            {
                               const auto vd = GetPointerS<var_decl>(var_node);
-                              std::deque<bit_lattice> current_inf;
+                              bitstring current_inf;
                               if(vd->init)
                               {
                                  if(vd->init->get_kind() == constructor_K)
@@ -1403,7 +1401,7 @@ void Bit_Value::initialize()
                                  INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level,
                                                 "---source node: " + STR(cur_node) + " source is signed: " +
                                                     STR(source_is_signed) + " loaded is signed: " + STR(lhs_signed));
-                                 std::deque<bit_lattice> cur_bitstring;
+                                 bitstring cur_bitstring;
                                  if(cur_node->get_kind() == ssa_name_K)
                                  {
                                     const auto ssa = GetPointerS<const ssa_name>(cur_node);
@@ -52,7 +52,9 @@
 
 #include <boost/range/adaptors.hpp>
 
-std::deque<bit_lattice> Bit_Value::get_current_or_best(const tree_nodeConstRef& tn) const
+#include <deque>
+
+bitstring Bit_Value::get_current_or_best(const tree_nodeConstRef& tn) const
 {
    const auto nid = tn->index;
    const auto node = tn;
@@ -64,17 +66,17 @@ std::deque<bit_lattice> Bit_Value::get_current_or_best(const tree_nodeConstRef&
    return best.at(nid);
 }
 
-std::deque<bit_lattice> Bit_Value::backward_chain(const tree_nodeConstRef& ssa_node) const
+bitstring Bit_Value::backward_chain(const tree_nodeConstRef& ssa_node) const
 {
    const auto ssa = GetPointerS<const ssa_name>(ssa_node);
    const auto ssa_nid = ssa->index;
-   std::deque<bit_lattice> res = create_x_bitstring(1);
+   bitstring res = create_x_bitstring(1);
    for(const auto& stmt_use : ssa->CGetUseStmts())
    {
       const auto user_stmt = stmt_use.first;
       const auto user_kind = user_stmt->get_kind();
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Analyzing use - " + STR(user_stmt));
-      std::deque<bit_lattice> user_res;
+      bitstring user_res;
       if(user_kind == gimple_assign_K)
       {
          const auto ga = GetPointerS<const gimple_assign>(user_stmt);
@@ -138,7 +140,7 @@ std::deque<bit_lattice> Bit_Value::backward_chain(const tree_nodeConstRef& ssa_n
                   const auto p_decl_id = AppM->getSSAFromParm(called_id, (*f_it)->index);
                   const auto parmssa = TM->GetTreeNode(p_decl_id);
                   const auto pd = GetPointerS<const ssa_name>(parmssa);
-                  std::deque<bit_lattice> tmp;
+                  bitstring tmp;
                   if(pd->bit_values.empty())
                   {
                      tmp = create_u_bitstring(tree_helper::TypeSize(parmssa));
@@ -319,9 +321,9 @@ void Bit_Value::backward()
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Performed backward transfer");
 }
 
-std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, unsigned int res_nid) const
+bitstring Bit_Value::backward_transfer(const gimple_assign* ga, unsigned int res_nid) const
 {
-   std::deque<bit_lattice> res;
+   bitstring res;
    if(tree_helper::IsConstant(TM->GetTreeNode(res_nid)))
    {
       return res;
@@ -622,7 +624,7 @@ std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, un
                   {
                      res.pop_front();
                   }
-                  res.front() = bit_inf(sign_bit, res.front());
+                  res.set(0, bit_inf(sign_bit, res.front()));
                }
                else
                {
@@ -780,11 +782,11 @@ std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, un
                {
                   if(op_signed_p && (res.size() == index + log2 + 1))
                   {
-                     res[index] = bit_lattice::ZERO;
+                     res.set(index, bit_lattice::ZERO);
                   }
                   else
                   {
-                     res[index] = bit_lattice::X;
+                     res.set(index, bit_lattice::X);
                   }
                }
             }
@@ -806,11 +808,11 @@ std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, un
                   {
                      if(op_signed_p && (res.size() == index + log2 + 1))
                      {
-                        res[index] = bit_lattice::ZERO;
+                        res.set(index, bit_lattice::ZERO);
                      }
                      else
                      {
-                        res[index] = bit_lattice::X;
+                        res.set(index, bit_lattice::X);
                      }
                   }
                }
@@ -887,11 +889,11 @@ std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, un
                   {
                      if(op_signed_p && (res.size() == index + log2 + 1))
                      {
-                        res[index] = bit_lattice::ZERO;
+                        res.set(index, bit_lattice::ZERO);
                      }
                      else
                      {
-                        res[index] = bit_lattice::X;
+                        res.set(index, bit_lattice::X);
                      }
                   }
                }
@@ -925,7 +927,7 @@ std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, un
                    static_cast<decltype(lhs_bitstring)::difference_type>(lhs_bitstring.size() + shift_value - lhs_size);
                if(std::find(lhs_bitstring.begin(), lhs_sign_extend_end, bit_lattice::U) != lhs_sign_extend_end)
                {
-                  res.front() = bit_lattice::U;
+                  res.set(0, bit_lattice::U);
                }
             }
          }
@@ -1216,7 +1218,7 @@ std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, un
                   const auto p_decl_id = AppM->getSSAFromParm(called_id, (*f_it)->index);
                   const auto parmssa = TM->GetTreeNode(p_decl_id);
                   const auto pd = GetPointerS<const ssa_name>(parmssa);
-                  std::deque<bit_lattice> tmp;
+                  bitstring tmp;
                   if(pd->bit_values.empty())
                   {
                      tmp = create_u_bitstring(tree_helper::TypeSize(parmssa));
@@ -54,7 +54,9 @@
 
 #include <boost/range/adaptors.hpp>
 
-std::deque<bit_lattice> Bit_Value::get_current(const tree_nodeConstRef& tn) const
+#include <deque>
+
+bitstring Bit_Value::get_current(const tree_nodeConstRef& tn) const
 {
    if(tn->get_kind() == ssa_name_K || tn->get_kind() == parm_decl_K)
    {
@@ -67,7 +69,7 @@ std::deque<bit_lattice> Bit_Value::get_current(const tree_nodeConstRef& tn) cons
       return best.at(tn->index);
    }
    THROW_UNREACHABLE("Unexpected node kind: " + tn->get_kind_text());
-   return std::deque<bit_lattice>();
+   return bitstring();
 }
 
 void Bit_Value::forward()
@@ -357,9 +359,9 @@ void Bit_Value::forward()
    }
 }
 
-std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) const
+bitstring Bit_Value::forward_transfer(const gimple_assign* ga) const
 {
-   std::deque<bit_lattice> res;
+   bitstring res;
    const auto& lhs = ga->op0;
    const auto& rhs = ga->op1;
    const auto lhs_signed = IsSignedIntegerType(lhs);
@@ -447,7 +449,7 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
                case bit_lattice::X:
                case bit_lattice::U:
                {
-                  std::deque<bit_lattice> negated_bitstring;
+                  bitstring negated_bitstring;
                   bit_lattice borrow = bit_lattice::ZERO;
                   for(const auto& bit : boost::adaptors::reverse(op_bitstring))
                   {
@@ -1205,7 +1207,7 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
             auto op1_it = op1_bitstring.crbegin();
             for(auto pos = 0u; op1_it != op1_bitstring.crend() && pos < res_bitsize; ++op1_it, ++pos)
             {
-               std::deque<bit_lattice> temp_op1;
+               bitstring temp_op1;
                while(temp_op1.size() < pos)
                {
                   temp_op1.push_front(bit_lattice::ZERO);
@@ -1216,7 +1218,7 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
                   temp_op1.push_front(bit_and_expr_map.at(*op0_it).at(*op1_it));
                }
                bit_lattice carry1 = bit_lattice::ZERO;
-               std::deque<bit_lattice> temp_res;
+               bitstring temp_res;
                auto temp_op1_it = temp_op1.crbegin();
                const auto temp_op1_end = temp_op1.crend();
                auto res_it = res.crbegin();
@@ -1644,7 +1646,7 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
             const auto op0_end = op0_bitstring.crend();
             const auto op1_end = op1_bitstring.crend();
             auto carry1 = bit_lattice::ZERO;
-            std::deque<bit_lattice> res_int;
+            bitstring res_int;
             for(auto bit_index = 0u; bit_index < lhs_size && op0_it != op0_end && op1_it != op1_end;
                 op0_it++, op1_it++, bit_index++)
             {
@@ -148,7 +148,9 @@ DesignFlowStep_Status Bit_Value_opt::InternalExec()
    THROW_ASSERT(fd->body, "Function has no implementation");
    modified = false;
    optimize(fd, TM, IRman);
-   modified ? function_behavior->UpdateBBVersion() : 0;
+   modified ? function_behavior->UpdateBBVersion(FunctionBehavior::IR_STMT | FunctionBehavior::IR_SSA |
+                                                 FunctionBehavior::IR_TYPES) :
+              0;
    return modified ? DesignFlowStep_Status::SUCCESS : DesignFlowStep_Status::UNCHANGED;
 }
 
@@ -378,7 +378,7 @@ DesignFlowStep_Status CSE::InternalExec()
       restart_phi_opt = false;
    }
    INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "---CSE: number of equivalent statement = " + STR(n_equiv_stmt));
-   IR_changed ? function_behavior->UpdateBBVersion() : 0;
+   IR_changed ? function_behavior->UpdateBBVersion(FunctionBehavior::IR_STMT | FunctionBehavior::IR_SSA) : 0;
    return IR_changed ? DesignFlowStep_Status::SUCCESS : DesignFlowStep_Status::UNCHANGED;
 }
 
@@ -76,6 +76,7 @@
 #include "tree_manipulation.hpp"
 #include "tree_node.hpp"
 
+#include <cstdlib>
 #include <regex>
 
 #define EPSILON 0.000000001
@@ -292,6 +293,124 @@ static std::pair<tree_nodeRef, unsigned int> ResolvePointerAlias(const CallGraph
    return {base_var, fid};
 }
 
+static tree_nodeConstRef GetSingleDefStmt(const tree_nodeConstRef& tn)
+{
+   const auto ssa = GetPointer<const ssa_name>(tn);
+   if(!ssa || ssa->virtual_flag)
+   {
+      return nullptr;
+   }
+   const auto def_stmts = ssa->CGetDefStmts();
+   return def_stmts.size() == 1 ? *def_stmts.begin() : nullptr;
+}
+
+/**
+ * Compute the distance between the values taken by an address in two consecutive iterations of the loop computing it
+ * @param addr is the address (or address offset) to be analyzed
+ * @param stride is set to the distance in bytes
+ * @param depth is the current recursion depth
+ * @return true if addr is an affine function of simple induction variables and loop invariants
+ */
+static bool GetAddressStride(const tree_nodeConstRef& addr, long long& stride, unsigned int depth = 0U)
+{
+   stride = 0LL;
+   if(addr->get_kind() == integer_cst_K)
+   {
+      return true;
+   }
+   const auto def_stmt = GetSingleDefStmt(addr);
+   if(!def_stmt || depth > 8U)
+   {
+      return false;
+   }
+   if(def_stmt->get_kind() == gimple_nop_K)
+   {
+      return true;
+   }
+   if(const auto gp = GetPointer<const gimple_phi>(def_stmt))
+   {
+      /// Simple induction variable: res = phi(init, res + step)
+      for(const auto& def_edge : gp->CGetDefEdgesList())
+      {
+         const auto incr = GetPointer<const gimple_assign>(GetSingleDefStmt(def_edge.first));
+         if(incr && (incr->op1->get_kind() == plus_expr_K || incr->op1->get_kind() == pointer_plus_expr_K))
+         {
+            const auto be = GetPointerS<const binary_expr>(incr->op1);
+            if(be->op0->index == gp->res->index && be->op1->get_kind() == integer_cst_K)
+            {
+               stride = static_cast<long long>(tree_helper::GetConstValue(be->op1));
+               return true;
+            }
+         }
+      }
+      return false;
+   }
+   const auto ga = GetPointer<const gimple_assign>(def_stmt);
+   if(!ga)
+   {
+      return false;
+   }
+   const auto op1_kind = ga->op1->get_kind();
+   if(op1_kind == ssa_name_K || op1_kind == integer_cst_K)
+   {
+      return GetAddressStride(ga->op1, stride, depth + 1U);
+   }
+   if(op1_kind == nop_expr_K || op1_kind == convert_expr_K || op1_kind == view_convert_expr_K)
+   {
+      return GetAddressStride(GetPointerS<const unary_expr>(ga->op1)->op, stride, depth + 1U);
+   }
+   const auto be = GetPointer<const binary_expr>(ga->op1);
+   if(!be)
+   {
+      return false;
+   }
+   long long stride0, stride1;
+   if(!GetAddressStride(be->op0, stride0, depth + 1U) || !GetAddressStride(be->op1, stride1, depth + 1U))
+   {
+      return false;
+   }
+   switch(op1_kind)
+   {
+      case plus_expr_K:
+      case pointer_plus_expr_K:
+         stride = stride0 + stride1;
+         return true;
+      case minus_expr_K:
+         stride = stride0 - stride1;
+         return true;
+      case mult_expr_K:
+         if(be->op1->get_kind() == integer_cst_K)
+         {
+            stride = stride0 * static_cast<long long>(tree_helper::GetConstValue(be->op1));
+            return true;
+         }
+         if(be->op0->get_kind() == integer_cst_K)
+         {
+            stride = stride1 * static_cast<long long>(tree_helper::GetConstValue(be->op0));
+            return true;
+         }
+         return stride0 == 0 && stride1 == 0;
+      case lshift_expr_K:
+         if(be->op1->get_kind() == integer_cst_K)
+         {
+            stride = stride0 * (1LL << static_cast<long long>(tree_helper::GetConstValue(be->op1)));
+            return true;
+         }
+         return stride0 == 0 && stride1 == 0;
+      default:
+         return stride0 == 0 && stride1 == 0;
+   }
+}
+
+static bool IsRestrictPointer(const tree_nodeConstRef& type)
+{
+   const auto tn = GetPointer<const type_node>(type);
+   return tn && (tn->qual == TreeVocabularyTokenTypes_TokenEnum::TOK_QUAL_R ||
+                 tn->qual == TreeVocabularyTokenTypes_TokenEnum::TOK_QUAL_VR ||
+                 tn->qual == TreeVocabularyTokenTypes_TokenEnum::TOK_QUAL_CR ||
+                 tn->qual == TreeVocabularyTokenTypes_TokenEnum::TOK_QUAL_CVR);
+}
+
 InterfaceInfer::InterfaceInfer(const application_managerRef _AppM, const DesignFlowManagerConstRef _design_flow_manager,
                                const ParameterConstRef _parameters)
     : ApplicationFrontendFlowStep(_AppM, INTERFACE_INFER, _design_flow_manager, _parameters), already_executed(false)
@@ -570,6 +689,35 @@ DesignFlowStep_Status InterfaceInfer::Exec()
          INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--");
       }
 
+      /*
+       * The burst adapter of a bundle keeps the last line read in a buffer which is invalidated only by the flush at
+       * the end of the function, so a write through another m_axi bundle to the same line would not be seen. The burst
+       * adapter is thus used only when the bundle is the only m_axi one or all its pointers are restrict qualified.
+       */
+      std::set<std::string> maxi_bundles;
+      std::set<std::string> aliased_bundles;
+      for(const auto& arg : fd->list_of_args)
+      {
+         const auto arg_type = tree_helper::CGetType(arg);
+         const auto parm_it = func_arch->parms.find(get_decl_name(arg));
+         if(!tree_helper::IsPointerType(arg_type) || parm_it == func_arch->parms.end() ||
+            parm_it->second.find(FunctionArchitecture::parm_bundle) == parm_it->second.end())
+         {
+            continue;
+         }
+         const auto& bundle = parm_it->second.at(FunctionArchitecture::parm_bundle);
+         const auto iface_it = func_arch->ifaces.find(bundle);
+         if(iface_it != func_arch->ifaces.end() && iface_it->second.count(FunctionArchitecture::iface_mode) &&
+            iface_it->second.at(FunctionArchitecture::iface_mode) == "m_axi")
+         {
+            maxi_bundles.insert(bundle);
+            if(!IsRestrictPointer(arg_type))
+            {
+               aliased_bundles.insert(bundle);
+            }
+         }
+      }
+
       std::map<std::string, TreeNodeSet> bundle_vdefs;
       for(const auto& arg : fd->list_of_args)
       {
@@ -777,13 +925,56 @@ DesignFlowStep_Status InterfaceInfer::Exec()
 
                THROW_ASSERT(info.bitwidth, "Expected non-zero bitwidth");
 
+               const auto burst_may_alias =
+                   maxi_bundles.size() > 1 && aliased_bundles.count(parm_attrs.at(FunctionArchitecture::parm_bundle));
+               if(interface_type == "m_axi" && parameters->isOption(OPT_m_axi_burst_length) && info.bitwidth >= 8 &&
+                  !(info.bitwidth & (info.bitwidth - 1)) &&
+                  iface_attrs.find(FunctionArchitecture::iface_cache_line_count) == iface_attrs.end() &&
+                  iface_attrs.find(FunctionArchitecture::iface_burst_length) == iface_attrs.end() && !burst_may_alias)
+               {
+                  /// A burst must not cross a 4KB boundary
+                  const auto burst_length = std::min(parameters->getOption<unsigned long long>(OPT_m_axi_burst_length),
+                                                     4096ULL / (info.bitwidth / 8ULL));
+                  const auto line_bytes = static_cast<long long>(burst_length * (info.bitwidth / 8ULL));
+                  size_t burst_accesses = 0;
+                  const auto count_burst_accesses = [&](const std::list<tree_nodeRef>& stmts, bool is_write) {
+                     for(const auto& stmt : stmts)
+                     {
+                        const auto ga = GetPointer<const gimple_assign>(stmt);
+                        const auto mr = ga ? GetPointer<const mem_ref>(is_write ? ga->op0 : ga->op1) : nullptr;
+                        long long stride;
+                        if(mr && GetAddressStride(mr->op0, stride) && stride != 0 &&
+                           2 * std::abs(stride) <= line_bytes)
+                        {
+                           INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level,
+                                          "---Stride " + STR(stride) + " access: " + stmt->ToString());
+                           ++burst_accesses;
+                        }
+                     }
+                  };
+                  count_burst_accesses(readStmt, false);
+                  count_burst_accesses(writeStmt, true);
+                  if(burst_length > 1 && burst_accesses)
+                  {
+                     iface_attrs[FunctionArchitecture::iface_burst_length] = STR(burst_length);
+                  }
+               }
+               else if(interface_type == "m_axi" && parameters->isOption(OPT_m_axi_burst_length) && burst_may_alias)
+               {
+                  INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level,
+                                 "---Single-beat adapter for bundle " +
+                                     parm_attrs.at(FunctionArchitecture::parm_bundle) +
+                                     ": it may alias other m_axi bundles, qualify its pointers as restrict");
+               }
+
                std::set<std::string> operationsR, operationsW;
                const auto interface_datatype = tree_man->GetCustomIntegerType(info.bitwidth, true);
                const auto commonRWSignature = interface_type == "array" || interface_type == "m_axi";
                const auto& bundle_name = iface_attrs.at(FunctionArchitecture::iface_name);
                const auto require_flush =
                    interface_type == "m_axi" &&
-                   iface_attrs.find(FunctionArchitecture::iface_cache_line_count) != iface_attrs.end();
+                   (iface_attrs.find(FunctionArchitecture::iface_cache_line_count) != iface_attrs.end() ||
+                    iface_attrs.find(FunctionArchitecture::iface_burst_length) != iface_attrs.end());
                const auto store_vdef = [&](const tree_nodeRef& stmt) {
                   if(require_flush)
                   {
@@ -834,6 +1025,11 @@ DesignFlowStep_Status InterfaceInfer::Exec()
          }
          INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level,
                         "---Alignment : " + iface_attrs.at(FunctionArchitecture::iface_alignment));
+         if(iface_attrs.find(FunctionArchitecture::iface_burst_length) != iface_attrs.end())
+         {
+            INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level,
+                           "---Burst     : " + iface_attrs.at(FunctionArchitecture::iface_burst_length));
+         }
          INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "<--");
       }
       /* Add cache flush operation */
@@ -2467,16 +2663,6 @@ void InterfaceInfer::create_resource_m_axi(const std::set<std::string>& operatio
       const auto fu = GetPointerS<functional_unit>(TechMan->get_fu(ResourceName, INTERFACE_LIBRARY));
       fu->area_m = area_info::factory(parameters);
       fu->area_m->set_area_value(0);
-      if(iface_attrs.find(FunctionArchitecture::iface_cache_line_count) != iface_attrs.end())
-      {
-         const auto flushName = ENCODE_FDNAME(bundle_name, "_Flush_", "m_axi");
-         TechMan->add_operation(INTERFACE_LIBRARY, ResourceName, flushName);
-         const auto op = GetPointer<operation>(fu->get_operation(flushName));
-         op->time_m = time_info::factory(parameters);
-         op->bounded = false;
-         op->time_m->set_execution_time(HLS_D->get_technology_manager()->CGetSetupHoldTime() + EPSILON, 0);
-         op->time_m->set_synthesis_dependent(true);
-      }
       HLSMgr->global_resource_constraints[std::make_pair(ResourceName, INTERFACE_LIBRARY)] = std::make_pair(1U, 1U);
       INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "<--Interface resource created");
    }
@@ -2492,6 +2678,19 @@ void InterfaceInfer::create_resource_m_axi(const std::set<std::string>& operatio
 
    /* Flush Op */
    const auto fu = GetPointerS<functional_unit>(TechMan->get_fu(ResourceName, INTERFACE_LIBRARY));
+   const auto& iface_attrs = func_arch->ifaces.at(bundle_name);
+   const auto flushName = ENCODE_FDNAME(bundle_name, "_Flush_", "m_axi");
+   if((iface_attrs.find(FunctionArchitecture::iface_cache_line_count) != iface_attrs.end() ||
+       iface_attrs.find(FunctionArchitecture::iface_burst_length) != iface_attrs.end()) &&
+      !fu->get_operation(flushName))
+   {
+      TechMan->add_operation(INTERFACE_LIBRARY, ResourceName, flushName);
+      const auto op = GetPointer<operation>(fu->get_operation(flushName));
+      op->time_m = time_info::factory(parameters);
+      op->bounded = false;
+      op->time_m->set_execution_time(HLS_D->get_technology_manager()->CGetSetupHoldTime() + EPSILON, 0);
+      op->time_m->set_synthesis_dependent(true);
+   }
 
    for(const auto& fdName : operationsR)
    {
@@ -71,6 +71,7 @@
 #include "utility.hpp"
 #include "var_pp_functor.hpp"
 
+#include <deque>
 #include <filesystem>
 #include <map>
 #include <set>
@@ -1225,7 +1226,7 @@ int VarNode::updateIR(const tree_managerRef& TM,
    }
 
 #ifdef BITVALUE_UPDATE
-   auto updateBitValue = [&](ssa_name* ssa, const std::deque<bit_lattice>& bv) -> int {
+   auto updateBitValue = [&](ssa_name* ssa, const bitstring& bv) -> int {
       const auto curr_bv = string_to_bitstring(ssa->bit_values);
       if(isBetter(bitstring_to_string(bv), ssa->bit_values))
       {
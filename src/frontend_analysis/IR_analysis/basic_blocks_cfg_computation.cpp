@@ -90,6 +90,12 @@ BasicBlocksCfgComputation::BasicBlocksCfgComputation(const ParameterConstRef _pa
 
 BasicBlocksCfgComputation::~BasicBlocksCfgComputation() = default;
 
+unsigned int BasicBlocksCfgComputation::GetIRDependencies() const
+{
+   /// only the topology of the basic block control flow graph is considered
+   return FunctionBehavior::IR_CFG;
+}
+
 CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::FunctionRelationship>>
 BasicBlocksCfgComputation::ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const
 {
@@ -59,6 +59,8 @@ class BasicBlocksCfgComputation : public FunctionFrontendFlowStep
    CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>>
    ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
 
+   unsigned int GetIRDependencies() const override;
+
  public:
    /**
     * Constructor
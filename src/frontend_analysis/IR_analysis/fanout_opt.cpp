@@ -258,7 +258,7 @@ DesignFlowStep_Status fanout_opt::InternalExec()
       }
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Considered BB" + STR(block.first));
    }
-   IR_changed ? function_behavior->UpdateBBVersion() : 0;
+   IR_changed ? function_behavior->UpdateBBVersion(FunctionBehavior::IR_STMT | FunctionBehavior::IR_SSA) : 0;
    return IR_changed ? DesignFlowStep_Status::SUCCESS : DesignFlowStep_Status::UNCHANGED;
 }
 
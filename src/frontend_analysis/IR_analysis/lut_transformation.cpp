@@ -1898,7 +1898,7 @@ DesignFlowStep_Status lut_transformation::InternalExec()
 
    if(modified)
    {
-      function_behavior->UpdateBBVersion();
+      function_behavior->UpdateBBVersion(FunctionBehavior::IR_STMT | FunctionBehavior::IR_SSA);
       return DesignFlowStep_Status::SUCCESS;
    }
    return DesignFlowStep_Status::UNCHANGED;
@@ -189,7 +189,7 @@ DesignFlowStep_Status mult_expr_fracturing::Exec()
    for(const auto& i : fun_id_to_restart)
    {
       const auto FB = AppM->GetFunctionBehavior(i);
-      FB->UpdateBBVersion();
+      FB->UpdateBBVersion(FunctionBehavior::IR_STMT | FunctionBehavior::IR_SSA);
    }
    return fun_id_to_restart.empty() ? DesignFlowStep_Status::UNCHANGED : DesignFlowStep_Status::SUCCESS;
 }
@@ -591,7 +591,7 @@ DesignFlowStep_Status CondExprRestructuring::InternalExec()
 
    if(modified)
    {
-      function_behavior->UpdateBBVersion();
+      function_behavior->UpdateBBVersion(FunctionBehavior::IR_STMT | FunctionBehavior::IR_SSA);
    }
    return modified ? DesignFlowStep_Status::SUCCESS : DesignFlowStep_Status::UNCHANGED;
 }
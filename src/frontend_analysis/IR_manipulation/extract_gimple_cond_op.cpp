@@ -126,6 +126,6 @@ DesignFlowStep_Status ExtractGimpleCondOp::InternalExec()
          }
       }
    }
-   bb_modified ? function_behavior->UpdateBBVersion() : 0;
+   bb_modified ? function_behavior->UpdateBBVersion(FunctionBehavior::IR_STMT | FunctionBehavior::IR_SSA) : 0;
    return bb_modified ? DesignFlowStep_Status::SUCCESS : DesignFlowStep_Status::UNCHANGED;
 }
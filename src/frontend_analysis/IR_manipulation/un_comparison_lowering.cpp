@@ -184,7 +184,7 @@ DesignFlowStep_Status UnComparisonLowering::InternalExec()
    }
    if(modified)
    {
-      function_behavior->UpdateBBVersion();
+      function_behavior->UpdateBBVersion(FunctionBehavior::IR_STMT | FunctionBehavior::IR_SSA);
    }
    return modified ? DesignFlowStep_Status::SUCCESS : DesignFlowStep_Status::UNCHANGED;
 }
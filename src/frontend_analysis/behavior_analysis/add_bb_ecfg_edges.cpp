@@ -79,6 +79,12 @@ AddBbEcfgEdges::AddBbEcfgEdges(const application_managerRef _AppM, unsigned int
 
 AddBbEcfgEdges::~AddBbEcfgEdges() = default;
 
+unsigned int AddBbEcfgEdges::GetIRDependencies() const
+{
+   /// only the topology of the basic block control flow graph is considered
+   return FunctionBehavior::IR_CFG;
+}
+
 CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::FunctionRelationship>>
 AddBbEcfgEdges::ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const
 {
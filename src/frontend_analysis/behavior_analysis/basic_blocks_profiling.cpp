@@ -60,6 +60,9 @@
 #include "utility.hpp"
 
 #include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <string>
 #include <utility>
 #include <vector>
@@ -102,6 +105,114 @@ void BasicBlocksProfiling::Initialize()
    }
 }
 
+void BasicBlocksProfiling::ReadProfile(const std::filesystem::path& profile_data_name) const
+{
+   std::ifstream profile_file(profile_data_name, std::ios::binary);
+   if(!profile_file.is_open())
+   {
+      THROW_ERROR_CODE(PROFILING_EC, "Error during opening of profile data file " + profile_data_name.string());
+   }
+   const std::string profile((std::istreambuf_iterator<char>(profile_file)), std::istreambuf_iterator<char>());
+   const size_t magic_size = sizeof(STR_CST_host_profiling_magic) - 1;
+   if(profile.compare(0, magic_size, STR_CST_host_profiling_magic))
+   {
+      THROW_ERROR_CODE(PROFILING_EC, "Malformed profile data file " + profile_data_name.string());
+   }
+   size_t offset = magic_size;
+   const auto read = [&](void* destination, size_t size) {
+      if(profile.size() - offset < size)
+      {
+         THROW_ERROR_CODE(PROFILING_EC, "Truncated profile data file " + profile_data_name.string());
+      }
+      memcpy(destination, profile.data() + offset, size);
+      offset += size;
+   };
+   while(offset < profile.size())
+   {
+      unsigned int header[3];
+      read(header, sizeof(header));
+      const auto function_behavior = AppM->CGetFunctionBehavior(header[1]);
+      const auto profiling_information = function_behavior->profiling_information;
+      const auto fbb = function_behavior->CGetBBGraph(FunctionBehavior::FBB);
+      const auto& bb_index_map = fbb->CGetBBGraphInfo()->bb_index_map;
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                     "---Found block " + STR(header[0]) + " of function " +
+                         function_behavior->CGetBehavioralHelper()->get_function_name());
+      switch(header[0])
+      {
+         case NUM_CST_host_profiling_bb_block:
+         {
+            std::vector<unsigned long long int> executions(header[2]);
+            read(executions.data(), executions.size() * sizeof(unsigned long long int));
+            for(unsigned int bb_index = 0; bb_index < header[2]; ++bb_index)
+            {
+               const auto bb_vertex = bb_index_map.find(bb_index);
+               if(bb_vertex != bb_index_map.end())
+               {
+                  profiling_information->bb_executions[bb_vertex->second] = executions[bb_index];
+               }
+               else
+               {
+                  THROW_ASSERT(executions[bb_index] == 0, STR(executions[bb_index]));
+               }
+            }
+            break;
+         }
+         case NUM_CST_host_profiling_edge_block:
+         {
+            std::vector<unsigned int> edge_bbs(2 * header[2]);
+            std::vector<unsigned long long int> executions(header[2]);
+            read(edge_bbs.data(), edge_bbs.size() * sizeof(unsigned int));
+            read(executions.data(), executions.size() * sizeof(unsigned long long int));
+            for(unsigned int edge_index = 0; edge_index < header[2]; ++edge_index)
+            {
+               const auto source = bb_index_map.find(edge_bbs[2 * edge_index]);
+               const auto target = bb_index_map.find(edge_bbs[2 * edge_index + 1]);
+               if(source == bb_index_map.end() || target == bb_index_map.end())
+               {
+                  continue;
+               }
+               OutEdgeIterator oe, oe_end;
+               for(boost::tie(oe, oe_end) = boost::out_edges(source->second, *fbb); oe != oe_end; ++oe)
+               {
+                  if(boost::target(*oe, *fbb) == target->second)
+                  {
+                     profiling_information->edge_executions[*oe] = executions[edge_index];
+                  }
+               }
+            }
+            break;
+         }
+         case NUM_CST_host_profiling_loop_block:
+         {
+            const auto loop_id = header[2];
+            unsigned long long int entries, total, max;
+            read(&entries, sizeof(entries));
+            read(&total, sizeof(total));
+            read(&max, sizeof(max));
+            auto& trip_histogram = profiling_information->trip_histograms[loop_id];
+            trip_histogram.resize(NUM_CST_host_profiling_trip_bins);
+            read(trip_histogram.data(), trip_histogram.size() * sizeof(unsigned long long int));
+            if(entries)
+            {
+               /// the trip count of an execution is the number of executions of the header, i.e., the number of
+               /// traversed feedback edges plus one
+               profiling_information->avg_iterations[loop_id] =
+                   static_cast<long double>(total) / static_cast<long double>(entries);
+               profiling_information->abs_iterations[loop_id] = total - entries;
+               profiling_information->max_iterations[loop_id] = max;
+            }
+            break;
+         }
+         default:
+         {
+            THROW_ERROR_CODE(PROFILING_EC, "Unknown block " + STR(header[0]) + " in profile data file " +
+                                               profile_data_name.string());
+         }
+      }
+   }
+}
+
 DesignFlowStep_Status BasicBlocksProfiling::Exec()
 {
    const auto temporary_path = parameters->getOption<std::filesystem::path>(OPT_output_temporary_directory);
@@ -109,12 +220,19 @@ DesignFlowStep_Status BasicBlocksProfiling::Exec()
    const auto run_name = temporary_path / "run.tmp";
    const auto profile_data_name = temporary_path / STR_CST_host_profiling_data;
 
-   const CompilerWrapperConstRef compiler_wrapper(
-       new CompilerWrapper(parameters, parameters->getOption<CompilerWrapper_CompilerTarget>(OPT_host_compiler),
-                           CompilerWrapper_OptimizationSet::O1));
-   CustomSet<std::string> tp_files;
-   tp_files.insert(profiling_source_file);
-   compiler_wrapper->CreateExecutable(tp_files, run_name.string(), "");
+   /// the profile of a run is identified by the instrumented source, the host compiler and the execution context
+   std::string cache_key_prefix;
+   if(parameters->isOption(OPT_host_profiling_cache))
+   {
+      std::ifstream source_file(profiling_source_file);
+      cache_key_prefix =
+          "host-profiling " +
+          STR(static_cast<int>(parameters->getOption<CompilerWrapper_CompilerTarget>(OPT_host_compiler))) + "\n" +
+          (parameters->isOption(OPT_path) ? parameters->getOption<std::string>(OPT_path) : std::string()) + "\n" +
+          std::string(std::istreambuf_iterator<char>(source_file), std::istreambuf_iterator<char>());
+   }
+
+   bool compiled = false;
    std::string change_directory;
    INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "-->Starting dynamic profiling");
    if(parameters->isOption(OPT_path))
@@ -130,7 +248,39 @@ DesignFlowStep_Status BasicBlocksProfiling::Exec()
       // The argument
       std::filesystem::remove(profile_data_name);
 
-      const auto command = change_directory + "\"" + run_name.string() + "\" " + exec_argv + " ";
+      std::filesystem::path cache_entry;
+      std::string cache_key;
+      if(!cache_key_prefix.empty())
+      {
+         cache_key = cache_key_prefix + "\n" + exec_argv;
+         cache_entry = parameters->getOption<std::filesystem::path>(OPT_host_profiling_cache) /
+                       ContentDigest(cache_key);
+         const auto cached_key = [&]() -> std::string {
+            std::ifstream key_file(cache_entry / "key.txt");
+            return std::string(std::istreambuf_iterator<char>(key_file), std::istreambuf_iterator<char>());
+         }();
+         if(cached_key == cache_key && std::filesystem::exists(cache_entry / STR_CST_host_profiling_data))
+         {
+            INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level, "---Host profiling cache hit: " + cache_entry.string());
+            ReadProfile(cache_entry / STR_CST_host_profiling_data);
+            continue;
+         }
+         INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level, "---Host profiling cache miss: " + cache_entry.string());
+      }
+
+      if(!compiled)
+      {
+         const CompilerWrapperConstRef compiler_wrapper(
+             new CompilerWrapper(parameters, parameters->getOption<CompilerWrapper_CompilerTarget>(OPT_host_compiler),
+                                 CompilerWrapper_OptimizationSet::O1));
+         CustomSet<std::string> tp_files;
+         tp_files.insert(profiling_source_file);
+         compiler_wrapper->CreateExecutable(tp_files, run_name.string(), "");
+         compiled = true;
+      }
+
+      const auto command = change_directory + STR_CST_host_profiling_data_env "=\"" + profile_data_name.string() +
+                           "\" \"" + run_name.string() + "\" " + exec_argv + " ";
       const auto ret = PandaSystem(parameters, command, false, temporary_path / STR_CST_host_profiling_output);
       if(IsError(ret))
       {
@@ -140,50 +290,20 @@ DesignFlowStep_Status BasicBlocksProfiling::Exec()
          }
       }
 
-      std::ifstream profilefile(profile_data_name);
-      if(profilefile.is_open())
+      ReadProfile(profile_data_name);
+
+      if(!cache_entry.empty())
       {
-         std::string line;
-         ProfilingInformationRef profiling_information;
-         decltype(BBGraphInfo::bb_index_map) bb_index_map;
-         while(!profilefile.eof())
+         const auto stored = StoreCacheEntry(cache_entry, [&](const std::filesystem::path& staging) {
+            std::filesystem::create_directories(staging);
+            CopyFile(profile_data_name, staging / STR_CST_host_profiling_data);
+            std::ofstream key_file(staging / "key.txt");
+            key_file << cache_key;
+         });
+         if(!stored)
          {
-            getline(profilefile, line);
-            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Read " + line);
-            if(line.size())
-            {
-               const auto splitted = string_to_container<std::vector<std::string>>(line, " ");
-               THROW_ASSERT(splitted.size() == 2, line);
-               if(line.find("Function") != std::string::npos)
-               {
-                  const auto function_behavior =
-                      AppM->CGetFunctionBehavior(static_cast<unsigned>(std::stoul(splitted[1])));
-                  INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
-                                 "---Found data of function " +
-                                     function_behavior->CGetBehavioralHelper()->get_function_name());
-                  profiling_information = function_behavior->profiling_information;
-                  bb_index_map = function_behavior->CGetBBGraph(FunctionBehavior::FBB)->CGetBBGraphInfo()->bb_index_map;
-               }
-               else
-               {
-                  const auto bb_index = static_cast<unsigned>(std::stoul(splitted[0]));
-                  if(bb_index_map.find(bb_index) != bb_index_map.end())
-                  {
-                     const auto bb_vertex = bb_index_map.find(bb_index)->second;
-                     profiling_information->bb_executions[bb_vertex] = std::stoull(splitted[1]);
-                  }
-                  else
-                  {
-                     THROW_ASSERT(splitted[1] == "0", splitted[1]);
-                  }
-               }
-            }
+            THROW_WARNING("Host profiling cache entry could not be stored: " + cache_entry.string());
          }
-         profilefile.close();
-      }
-      else
-      {
-         THROW_ERROR_CODE(PROFILING_EC, "Error during opening of profile data file " + profile_data_name.string());
       }
    }
    INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "<--Ended dynamic profiling");
@@ -42,6 +42,8 @@
 
 #include "application_frontend_flow_step.hpp"
 
+#include <filesystem>
+
 /**
  * Class to perform profiling
  */
@@ -56,6 +58,12 @@ class BasicBlocksProfiling : public ApplicationFrontendFlowStep
    void ComputeRelationships(DesignFlowStepSet& relationship,
                              const DesignFlowStep::RelationshipType relationship_type) final;
 
+   /**
+    * Map the binary profile written by the instrumented executable onto the profiling information of the functions
+    * @param profile_data_name is the file storing the profile
+    */
+   void ReadProfile(const std::filesystem::path& profile_data_name) const;
+
  public:
    /**
     * Constructor.
@@ -61,6 +61,12 @@ BBCdgComputation::BBCdgComputation(const ParameterConstRef _Param, const applica
 
 BBCdgComputation::~BBCdgComputation() = default;
 
+unsigned int BBCdgComputation::GetIRDependencies() const
+{
+   /// only the topology of the basic block control flow graph is considered
+   return FunctionBehavior::IR_CFG;
+}
+
 CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::FunctionRelationship>>
 BBCdgComputation::ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const
 {
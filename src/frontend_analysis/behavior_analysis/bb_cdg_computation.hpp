@@ -56,6 +56,8 @@ class BBCdgComputation : public FunctionFrontendFlowStep
    CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>>
    ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
 
+   unsigned int GetIRDependencies() const override;
+
  public:
    /**
     * Constructor.
@@ -71,6 +71,12 @@ bb_feedback_edges_computation::bb_feedback_edges_computation(const ParameterCons
 
 bb_feedback_edges_computation::~bb_feedback_edges_computation() = default;
 
+unsigned int bb_feedback_edges_computation::GetIRDependencies() const
+{
+   /// only the topology of the basic block control flow graph is considered
+   return FunctionBehavior::IR_CFG;
+}
+
 CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::FunctionRelationship>>
 bb_feedback_edges_computation::ComputeFrontendRelationships(
     const DesignFlowStep::RelationshipType relationship_type) const
@@ -69,6 +69,8 @@ class bb_feedback_edges_computation : public FunctionFrontendFlowStep
    CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>>
    ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
 
+   unsigned int GetIRDependencies() const override;
+
  public:
    /**
     * Constructor.
@@ -66,6 +66,12 @@ BBOrderComputation::BBOrderComputation(const ParameterConstRef _Param, const app
 
 BBOrderComputation::~BBOrderComputation() = default;
 
+unsigned int BBOrderComputation::GetIRDependencies() const
+{
+   /// only the topology of the basic block control flow graph is considered
+   return FunctionBehavior::IR_CFG;
+}
+
 CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::FunctionRelationship>>
 BBOrderComputation::ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const
 {
@@ -99,6 +105,11 @@ void BBOrderComputation::Initialize()
    }
 }
 
+bool BBOrderComputation::CanRunConcurrently() const
+{
+   return true;
+}
+
 DesignFlowStep_Status BBOrderComputation::InternalExec()
 {
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
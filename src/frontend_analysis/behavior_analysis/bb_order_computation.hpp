@@ -57,6 +57,8 @@ class BBOrderComputation : public FunctionFrontendFlowStep
    CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>>
    ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
 
+   unsigned int GetIRDependencies() const override;
+
  public:
    /**
     * Constructor.
@@ -83,5 +85,10 @@ class BBOrderComputation : public FunctionFrontendFlowStep
     * Initialize the step (i.e., like a constructor, but executed just before exec
     */
    void Initialize() override;
+
+   /**
+    * Basic block levels are private to the function behavior, so functions can be analyzed concurrently
+    */
+   bool CanRunConcurrently() const override;
 };
 #endif
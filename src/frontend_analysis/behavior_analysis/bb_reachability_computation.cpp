@@ -57,6 +57,7 @@
 
 /// graph includes
 #include "graph.hpp"
+#include "graph_snapshot.hpp"
 
 /// tree includes
 #include "tree_basic_block.hpp"
@@ -78,6 +79,12 @@ BBReachabilityComputation::BBReachabilityComputation(const ParameterConstRef _Pa
 
 BBReachabilityComputation::~BBReachabilityComputation() = default;
 
+unsigned int BBReachabilityComputation::GetIRDependencies() const
+{
+   /// only the topology of the basic block control flow graph is considered
+   return FunctionBehavior::IR_CFG;
+}
+
 void BBReachabilityComputation::Initialize()
 {
    if(bb_version != 0 and bb_version != function_behavior->GetBBVersion())
@@ -87,6 +94,11 @@ void BBReachabilityComputation::Initialize()
    }
 }
 
+bool BBReachabilityComputation::CanRunConcurrently() const
+{
+   return true;
+}
+
 CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::FunctionRelationship>>
 BBReachabilityComputation::ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const
 {
@@ -117,24 +129,27 @@ DesignFlowStep_Status BBReachabilityComputation::InternalExec()
    /// The extended control flow graph of basic block
    const BBGraphConstRef ecfg = function_behavior->CGetBBGraph(FunctionBehavior::EBB);
 
+   /// The extended control flow graph is visited through a frozen copy, which keeps the same vertex and edge order
+   const GraphSnapshot<BBGraph> snapshot(*ecfg);
+   const auto& csr = snapshot.CGetGraph();
+
    /// The reachability among basic blocks
    auto& bb_reachability = function_behavior->bb_reachability;
    auto& feedback_bb_reachability = function_behavior->feedback_bb_reachability;
 
-   std::deque<vertex> container;
-   boost::topological_sort(*ecfg, std::back_inserter(container));
-   std::deque<vertex>::const_iterator it, it_end;
-   it_end = container.end();
-   for(it = container.begin(); it != it_end; ++it)
+   std::deque<GraphSnapshot<BBGraph>::Index> container;
+   boost::topological_sort(csr, std::back_inserter(container));
+   for(const auto index : container)
    {
+      const auto bb = snapshot.GetVertex(index);
       PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
-                    "  Examining basic block " + std::to_string(ecfg->CGetBBNodeInfo(*it)->block->number));
-      OutEdgeIterator eo, eo_end;
-      for(boost::tie(eo, eo_end) = boost::out_edges(*it, *ecfg); eo != eo_end; eo++)
+                    "  Examining basic block " + std::to_string(ecfg->CGetBBNodeInfo(bb)->block->number));
+      boost::graph_traits<GraphSnapshot<BBGraph>::CSRGraph>::out_edge_iterator eo, eo_end;
+      for(boost::tie(eo, eo_end) = boost::out_edges(index, csr); eo != eo_end; eo++)
       {
-         vertex previous = boost::target(*eo, *ecfg);
-         bb_reachability[*it].insert(previous);
-         bb_reachability[*it].insert(bb_reachability[previous].begin(), bb_reachability[previous].end());
+         vertex previous = snapshot.GetVertex(boost::target(*eo, csr));
+         bb_reachability[bb].insert(previous);
+         bb_reachability[bb].insert(bb_reachability[previous].begin(), bb_reachability[previous].end());
       }
    }
 
@@ -59,6 +59,8 @@ class BBReachabilityComputation : public FunctionFrontendFlowStep
    CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>>
    ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
 
+   unsigned int GetIRDependencies() const override;
+
  public:
    /**
     * Constructor.
@@ -85,6 +87,11 @@ class BBReachabilityComputation : public FunctionFrontendFlowStep
     * @return the exit status of this step
     */
    DesignFlowStep_Status InternalExec() override;
+
+   /**
+    * Reachability sets are stored in the function behavior, so functions can be analyzed concurrently
+    */
+   bool CanRunConcurrently() const override;
 };
 
 #endif
@@ -79,6 +79,12 @@ dom_post_dom_computation::dom_post_dom_computation(const ParameterConstRef _para
 
 dom_post_dom_computation::~dom_post_dom_computation() = default;
 
+unsigned int dom_post_dom_computation::GetIRDependencies() const
+{
+   /// only the topology of the basic block control flow graph is considered
+   return FunctionBehavior::IR_CFG;
+}
+
 CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::FunctionRelationship>>
 dom_post_dom_computation::ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const
 {
@@ -109,6 +115,11 @@ void dom_post_dom_computation::Initialize()
    function_behavior->post_dominators = nullptr;
 }
 
+bool dom_post_dom_computation::CanRunConcurrently() const
+{
+   return true;
+}
+
 DesignFlowStep_Status dom_post_dom_computation::InternalExec()
 {
    const BBGraphConstRef fbb = function_behavior->CGetBBGraph(FunctionBehavior::FBB);
@@ -71,6 +71,8 @@ class dom_post_dom_computation : public FunctionFrontendFlowStep
    CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>>
    ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
 
+   unsigned int GetIRDependencies() const override;
+
  public:
    /**
     * Constructor.
@@ -97,5 +99,10 @@ class dom_post_dom_computation : public FunctionFrontendFlowStep
     * Initialize the step (i.e., like a constructor, but executed just before exec
     */
    void Initialize() override;
+
+   /**
+    * Dominator trees only depend on the basic block graph of the analyzed function
+    */
+   bool CanRunConcurrently() const override;
 };
 #endif
@@ -69,6 +69,12 @@ loops_computation::loops_computation(const ParameterConstRef _parameters, const
 
 loops_computation::~loops_computation() = default;
 
+unsigned int loops_computation::GetIRDependencies() const
+{
+   /// only the topology of the basic block control flow graph is considered
+   return FunctionBehavior::IR_CFG;
+}
+
 CustomUnorderedSet<std::pair<FrontendFlowStepType, FrontendFlowStep::FunctionRelationship>>
 loops_computation::ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const
 {
@@ -96,6 +96,11 @@ void OpOrderComputation::Initialize()
    }
 }
 
+bool OpOrderComputation::CanRunConcurrently() const
+{
+   return true;
+}
+
 DesignFlowStep_Status OpOrderComputation::InternalExec()
 {
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Starting order computation on Operation CFG");
@@ -83,5 +83,10 @@ class OpOrderComputation : public FunctionFrontendFlowStep
     * Initialize the step (i.e., like a constructor, but executed just before exec
     */
    void Initialize() override;
+
+   /**
+    * Operation levels only depend on the operation graphs of the analyzed function
+    */
+   bool CanRunConcurrently() const override;
 };
 #endif
@@ -85,13 +85,17 @@ FunctionFrontendFlowStep::FunctionFrontendFlowStep(const application_managerRef
       function_behavior(_AppM->GetFunctionBehavior(_function_id)),
       function_id(_function_id),
       bb_version(0),
-      bitvalue_version(0)
+      bitvalue_version(0),
+      ir_version(0),
+      avoided_bb_version(0)
 {
    debug_level = parameters->get_class_debug_level(GET_CLASS(*this));
 }
 
 FunctionFrontendFlowStep::~FunctionFrontendFlowStep() = default;
 
+size_t FunctionFrontendFlowStep::avoided_executions = 0;
+
 DesignFlowStep::signature_t
 FunctionFrontendFlowStep::ComputeSignature(const FrontendFlowStepType frontend_flow_step_type,
                                            const unsigned int function_id)
@@ -110,6 +114,11 @@ std::string FunctionFrontendFlowStep::GetName() const
        ;
 }
 
+unsigned int FunctionFrontendFlowStep::GetFunctionId() const
+{
+   return function_id;
+}
+
 void FunctionFrontendFlowStep::ComputeRelationships(DesignFlowStepSet& relationships,
                                                     const DesignFlowStep::RelationshipType relationship_type)
 {
@@ -246,6 +255,7 @@ DesignFlowStep_Status FunctionFrontendFlowStep::Exec()
       const auto status = InternalExec();
       bb_version = function_behavior->GetBBVersion();
       bitvalue_version = function_behavior->GetBitValueVersion();
+      ir_version = function_behavior->GetIRVersion(GetIRDependencies());
       return status;
    }
    return DesignFlowStep_Status::UNCHANGED;
@@ -253,7 +263,32 @@ DesignFlowStep_Status FunctionFrontendFlowStep::Exec()
 
 bool FunctionFrontendFlowStep::HasToBeExecuted() const
 {
-   return bb_version != function_behavior->GetBBVersion();
+   const auto current_bb_version = function_behavior->GetBBVersion();
+   if(bb_version == current_bb_version)
+   {
+      return false;
+   }
+   if(bb_version != 0 && ir_version == function_behavior->GetIRVersion(GetIRDependencies()))
+   {
+      /// Only kinds of modification this step does not depend on have been applied since its last execution
+      if(avoided_bb_version != current_bb_version)
+      {
+         avoided_bb_version = current_bb_version;
+         ++avoided_executions;
+      }
+      return false;
+   }
+   return true;
+}
+
+unsigned int FunctionFrontendFlowStep::GetIRDependencies() const
+{
+   return FunctionBehavior::IR_ALL;
+}
+
+size_t FunctionFrontendFlowStep::GetAvoidedExecutions()
+{
+   return avoided_executions;
 }
 
 void FunctionFrontendFlowStep::WriteBBGraphDot(const std::string& filename) const
@@ -47,6 +47,7 @@
 #include "frontend_flow_step.hpp"
 #include "refcount.hpp"
 
+#include <cstddef>
 #include <string>
 
 REF_FORWARD_DECL(ArchManager);
@@ -78,6 +79,15 @@ class FunctionFrontendFlowStep : public FrontendFlowStep
    /// The version of the bitvalue information on which this step has been applied
    unsigned int bitvalue_version;
 
+   /// The version of the kinds of intermediate representation this step depends on when it has been applied
+   unsigned int ir_version;
+
+   /// The last version of the basic block intermediate representation whose re-execution has been avoided
+   mutable unsigned int avoided_bb_version;
+
+   /// The number of re-executions of function steps avoided since only independent parts of the IR were modified
+   static size_t avoided_executions;
+
    /**
     * Execute the step
     * @return the exit status of this step
@@ -93,6 +103,12 @@ class FunctionFrontendFlowStep : public FrontendFlowStep
    void ComputeRelationships(DesignFlowStepSet& relationship,
                              const DesignFlowStep::RelationshipType relationship_type) override;
 
+   /**
+    * Return the kinds of modification of the intermediate representation which invalidate the results of this step
+    * @return a set of FunctionBehavior::ir_change_kind (all of them by default)
+    */
+   virtual unsigned int GetIRDependencies() const;
+
  public:
    /**
     * Constructor
@@ -109,6 +125,8 @@ class FunctionFrontendFlowStep : public FrontendFlowStep
 
    std::string GetName() const final;
 
+   unsigned int GetFunctionId() const final;
+
    DesignFlowStep_Status Exec() final;
 
    bool HasToBeExecuted() const override;
@@ -127,6 +145,11 @@ class FunctionFrontendFlowStep : public FrontendFlowStep
     */
    unsigned int GetBitValueVersion() const;
 
+   /**
+    * @return the number of re-executions of function steps avoided thanks to the kinds of IR modification
+    */
+   static size_t GetAvoidedExecutions();
+
    /**
     * Compute the signature of a function frontend flow step
     * @param frontend_flow_step_type is the type of frontend flow
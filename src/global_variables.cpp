@@ -50,14 +50,14 @@
 /// Exit code
 int exit_code = EXIT_FAILURE;
 
-/// The current indentation for debug messages
-size_t indentation = 0;
+/// The current indentation for debug messages (per thread, since design flow steps may run concurrently)
+thread_local size_t indentation = 0;
 
 /// Mull stream
-std::ostream null_stream(nullptr);
+thread_local std::ostream null_stream(nullptr);
 
 /// The current message to be printed
-std::string panda_message;
+thread_local std::string panda_message;
 
 /// Transform warning into errors
 bool error_on_warning = false;
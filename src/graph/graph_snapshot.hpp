@@ -0,0 +1,168 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file graph_snapshot.hpp
+ * @brief Immutable compressed sparse row copy of a graph view
+ *
+ * The graph views (CFG, DFG, FLG, ...) are filtered graphs whose edge selector is evaluated on every edge visit.
+ * Analyses which only read a view and visit it several times can freeze it once into a GraphSnapshot: vertices get
+ * dense indices and in/out edges are stored in contiguous arrays, while the original descriptors can still be
+ * retrieved to store the results.
+ *
+ */
+#ifndef GRAPH_SNAPSHOT_HPP
+#define GRAPH_SNAPSHOT_HPP
+
+#include "custom_map.hpp"
+#include "exceptions.hpp"
+
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/graph_traits.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+template <typename Graph>
+class GraphSnapshot
+{
+ public:
+   /// The frozen graph; the bundled property of each edge is the position of the original edge
+   using CSRGraph = boost::compressed_sparse_row_graph<boost::bidirectionalS, boost::no_property, std::size_t>;
+
+   /// Dense index of a vertex in the frozen graph
+   using Index = typename boost::graph_traits<CSRGraph>::vertex_descriptor;
+
+   /// Edge of the frozen graph
+   using IndexEdge = typename boost::graph_traits<CSRGraph>::edge_descriptor;
+
+   /// Vertex of the original graph
+   using Vertex = typename boost::graph_traits<Graph>::vertex_descriptor;
+
+   /// Edge of the original graph
+   using Edge = typename boost::graph_traits<Graph>::edge_descriptor;
+
+ private:
+   /// The original vertices, in the order given by boost::vertices on the view
+   std::vector<Vertex> vertices;
+
+   /// The index of each original vertex
+   CustomUnorderedMap<Vertex, Index> indices;
+
+   /// The original edges, in the order given by boost::out_edges on the view
+   std::vector<Edge> edges;
+
+   /// The frozen graph
+   CSRGraph csr;
+
+ public:
+   /**
+    * Constructor
+    * @param g is the view to be frozen; it must not be modified while the snapshot is used
+    */
+   explicit GraphSnapshot(const Graph& g)
+   {
+      typename boost::graph_traits<Graph>::vertex_iterator v, v_end;
+      for(boost::tie(v, v_end) = boost::vertices(g); v != v_end; ++v)
+      {
+         indices.emplace(*v, static_cast<Index>(vertices.size()));
+         vertices.push_back(*v);
+      }
+      std::vector<std::pair<Index, Index>> csr_edges;
+      std::vector<std::size_t> edge_ids;
+      for(Index source = 0; source < vertices.size(); ++source)
+      {
+         typename boost::graph_traits<Graph>::out_edge_iterator e, e_end;
+         for(boost::tie(e, e_end) = boost::out_edges(vertices[source], g); e != e_end; ++e)
+         {
+            const auto target = indices.find(boost::target(*e, g));
+            if(target == indices.end())
+            {
+               continue;
+            }
+            csr_edges.emplace_back(source, target->second);
+            edge_ids.push_back(edges.size());
+            edges.push_back(*e);
+         }
+      }
+      /// edges are already grouped by source, so the out-edge order of each vertex is preserved
+      csr = CSRGraph(boost::edges_are_unsorted_multi_pass, csr_edges.begin(), csr_edges.end(), edge_ids.begin(),
+                     vertices.size());
+   }
+
+   /**
+    * Return the frozen graph
+    */
+   const CSRGraph& CGetGraph() const
+   {
+      return csr;
+   }
+
+   /**
+    * Return the number of vertices
+    */
+   std::size_t GetNumVertices() const
+   {
+      return vertices.size();
+   }
+
+   /**
+    * Return the index of a vertex of the original graph
+    * @param v is the vertex
+    */
+   Index GetIndex(const Vertex v) const
+   {
+      THROW_ASSERT(indices.find(v) != indices.end(), "Vertex is not part of the snapshot");
+      return indices.find(v)->second;
+   }
+
+   /**
+    * Return the vertex of the original graph corresponding to an index
+    * @param index is the index
+    */
+   Vertex GetVertex(const Index index) const
+   {
+      THROW_ASSERT(index < vertices.size(), "Index out of range");
+      return vertices[index];
+   }
+
+   /**
+    * Return the edge of the original graph corresponding to an edge of the frozen graph
+    * @param e is the edge of the frozen graph
+    */
+   Edge GetEdge(const IndexEdge e) const
+   {
+      return edges[csr[e]];
+   }
+};
+#endif
@@ -48,6 +48,7 @@
 #include "dbgPrintHelper.hpp"
 #include "exceptions.hpp"
 #include "meilp_solver.hpp"
+#include "sdc_solver.hpp"
 
 #if HAVE_GLPK
 #include "glpk_solver.hpp"
@@ -126,6 +127,8 @@ meilp_solverRef meilp_solver::create_solver(supported_solvers solver_type)
       case LP_SOLVE:
          return meilp_solverRef(new lp_solve_solver());
 #endif
+      case SDC:
+         return meilp_solverRef(new sdc_solver());
       default:
          THROW_ERROR("not supported solver type");
    }
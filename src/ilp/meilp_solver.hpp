@@ -153,8 +153,9 @@ class meilp_solver
       COIN_OR, /**< COIN-OR based solver (http://www.coin-or.org/) */
 #endif
 #if HAVE_LP_SOLVE
-      LP_SOLVE /**< LP_SOLVE based solver (http://tech.groups.yahoo.com/group/lp_solve/) */
+      LP_SOLVE, /**< LP_SOLVE based solver (http://tech.groups.yahoo.com/group/lp_solve/) */
 #endif
+      SDC /**< Native solver restricted to systems of difference constraints */
    };
 
    /**
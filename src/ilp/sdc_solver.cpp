@@ -0,0 +1,352 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file sdc_solver.cpp
+ * @brief Native solver for systems of difference constraints
+ *
+ * The least solution is computed by a queue based Bellman-Ford longest path on the constraint graph. Since adding
+ * constraints can only increase the least solution, the previous one is used as starting point when the problem is
+ * solved again after new rows have been added.
+ *
+ */
+#include "sdc_solver.hpp"
+
+#include "dbgPrintHelper.hpp"
+#include "exceptions.hpp"
+#include "string_manipulation.hpp"
+
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <ostream>
+
+/// Tolerance used when comparing solution values
+#define SDC_EPSILON 1e-9
+
+sdc_solver::sdc_solver() : meilp_solver(), warm(false), integral_solution(false)
+{
+}
+
+sdc_solver::~sdc_solver() = default;
+
+void sdc_solver::make(int nvars)
+{
+   THROW_ASSERT(nvars >= 0, "expected a non-negative number of variables");
+   rows.clear();
+   objective.clear();
+   lower_bounds.clear();
+   upper_bounds.clear();
+   col_names.assign(static_cast<size_t>(nvars), "");
+   int_vars.assign(static_cast<size_t>(nvars), false);
+   out_edges.assign(static_cast<size_t>(nvars) + 1, {});
+   values.assign(static_cast<size_t>(nvars) + 1, 0.0);
+   seeded_lower_bounds.assign(static_cast<size_t>(nvars) + 1, 0.0);
+   dirty.clear();
+   warm = false;
+}
+
+int sdc_solver::add_empty_column()
+{
+   const auto var = static_cast<int>(col_names.size());
+   col_names.push_back("");
+   int_vars.push_back(false);
+   out_edges.emplace_back();
+   values.push_back(0.0);
+   seeded_lower_bounds.push_back(0.0);
+   return var;
+}
+
+void sdc_solver::add_edge(size_t u, size_t v, double w)
+{
+   out_edges[u].push_back(std::make_pair(v, w));
+   dirty.push_back(u);
+}
+
+void sdc_solver::add_row(std::map<int, double>& i_coeffs, double i_rhs, ilp_sign i_sign, const std::string& name)
+{
+   rows.push_back(row{i_coeffs, i_rhs, i_sign, name});
+   /// Nodes and coefficients of the row: a missing variable is the constant zero node
+   size_t pos_node = 0, neg_node = 0;
+   double pos_coeff = 0.0, neg_coeff = 0.0;
+   for(const auto& coeff : i_coeffs)
+   {
+      THROW_ASSERT(coeff.first >= 0 && static_cast<size_t>(coeff.first) < col_names.size(),
+                   "Variable " + STR(coeff.first) + " does not exist");
+      if(coeff.second > 0.0 && pos_node == 0)
+      {
+         pos_node = static_cast<size_t>(coeff.first) + 1;
+         pos_coeff = coeff.second;
+      }
+      else if(coeff.second < 0.0 && neg_node == 0)
+      {
+         neg_node = static_cast<size_t>(coeff.first) + 1;
+         neg_coeff = -coeff.second;
+      }
+      else if(coeff.second != 0.0)
+      {
+         THROW_ERROR("Constraint " + name + " is not a difference constraint");
+      }
+   }
+   if(pos_node && neg_node && std::fabs(pos_coeff - neg_coeff) > SDC_EPSILON)
+   {
+      THROW_ERROR("Constraint " + name + " is not a difference constraint");
+   }
+   const auto scale = pos_node ? pos_coeff : neg_coeff;
+   if(scale == 0.0)
+   {
+      THROW_ERROR("Constraint " + name + " does not involve any variable");
+   }
+   /// The row is now pos - neg (sign) rhs
+   const auto rhs = i_rhs / scale;
+   if(i_sign == G || i_sign == E)
+   {
+      add_edge(neg_node, pos_node, rhs);
+   }
+   if(i_sign == L || i_sign == E)
+   {
+      add_edge(pos_node, neg_node, -rhs);
+   }
+}
+
+void sdc_solver::objective_add(std::map<int, double>& i_coeffs, ilp_dir dir)
+{
+   objective.clear();
+   for(const auto& coeff : i_coeffs)
+   {
+      const auto value = dir == min ? coeff.second : -coeff.second;
+      if(value < 0.0)
+      {
+         THROW_ERROR("Difference constraint solver supports only objectives minimized by the least solution");
+      }
+      objective[coeff.first] = value;
+   }
+}
+
+void sdc_solver::set_int(int i)
+{
+   int_vars.at(static_cast<size_t>(i)) = true;
+}
+
+void sdc_solver::set_all_bounds()
+{
+   for(size_t var = 0; var < col_names.size(); var++)
+   {
+      const auto lb = lower_bounds.count(static_cast<int>(var)) ? lower_bounds.at(static_cast<int>(var)) : 0.0;
+      if(lb < seeded_lower_bounds[var + 1])
+      {
+         /// a relaxed bound invalidates the previous solution as starting point
+         warm = false;
+      }
+      seeded_lower_bounds[var + 1] = lb;
+   }
+   if(!warm)
+   {
+      values = seeded_lower_bounds;
+      values[0] = 0.0;
+      dirty.clear();
+      for(size_t node = 0; node < values.size(); node++)
+      {
+         dirty.push_back(node);
+      }
+   }
+   for(size_t node = 1; node < values.size(); node++)
+   {
+      if(seeded_lower_bounds[node] > values[node])
+      {
+         values[node] = seeded_lower_bounds[node];
+         dirty.push_back(node);
+      }
+   }
+}
+
+int sdc_solver::solve_internal(bool integral)
+{
+   if(integral != integral_solution)
+   {
+      warm = false;
+      integral_solution = integral;
+   }
+   set_all_bounds();
+   if(debug_level >= DEBUG_LEVEL_VERBOSE)
+   {
+      print(std::cerr);
+   }
+   const auto round = [&](size_t node, double value) -> double {
+      if(!integral || !node || !int_vars[node - 1])
+      {
+         return value;
+      }
+      const auto rounded = std::ceil(value - SDC_EPSILON);
+      /// avoid returning -0.0
+      return rounded == 0.0 ? 0.0 : rounded;
+   };
+   const auto n_nodes = values.size();
+   std::deque<size_t> queue;
+   std::vector<bool> in_queue(n_nodes, false);
+   std::vector<size_t> enqueued(n_nodes, 0);
+   for(const auto node : dirty)
+   {
+      values[node] = round(node, values[node]);
+      if(!in_queue[node])
+      {
+         in_queue[node] = true;
+         queue.push_back(node);
+      }
+   }
+   dirty.clear();
+   /// from now on values is consistent only if the propagation completes
+   warm = false;
+   while(!queue.empty())
+   {
+      const auto u = queue.front();
+      queue.pop_front();
+      in_queue[u] = false;
+      for(const auto& edge : out_edges[u])
+      {
+         const auto v = edge.first;
+         const auto candidate = round(v, values[u] + edge.second);
+         if(candidate > values[v] + SDC_EPSILON)
+         {
+            values[v] = candidate;
+            /// the constant node cannot be raised and a node relaxed more times than the number of nodes lies on a
+            /// positive cycle: in both cases the system has no solution
+            if(v == 0 || ++enqueued[v] > n_nodes)
+            {
+               INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "---Difference constraints are infeasible");
+               return 1;
+            }
+            if(!in_queue[v])
+            {
+               in_queue[v] = true;
+               queue.push_back(v);
+            }
+         }
+      }
+   }
+   for(const auto& upper_bound : upper_bounds)
+   {
+      if(values[static_cast<size_t>(upper_bound.first) + 1] > upper_bound.second + SDC_EPSILON)
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
+                        "---Upper bound of variable " + STR(upper_bound.first) + " is violated");
+         return 1;
+      }
+   }
+   warm = true;
+   return 0;
+}
+
+int sdc_solver::solve()
+{
+   return solve_internal(false);
+}
+
+int sdc_solver::solve_ilp()
+{
+   return solve_internal(true);
+}
+
+void sdc_solver::get_vars_solution(std::map<int, double>& vars) const
+{
+   vars.clear();
+   for(size_t var = 0; var < col_names.size(); var++)
+   {
+      vars[static_cast<int>(var)] = values[var + 1];
+   }
+}
+
+int sdc_solver::get_number_constraints() const
+{
+   return static_cast<int>(rows.size());
+}
+
+int sdc_solver::get_number_variables() const
+{
+   return static_cast<int>(col_names.size());
+}
+
+void sdc_solver::set_col_name(int var, const std::string& name)
+{
+   col_names.at(static_cast<size_t>(var)) = name;
+}
+
+std::string sdc_solver::get_col_name(int var)
+{
+   const auto& name = col_names.at(static_cast<size_t>(var));
+   return name.empty() ? "x" + STR(var) : name;
+}
+
+void sdc_solver::print(std::ostream& os)
+{
+   os << "Minimize\n obj:";
+   for(const auto& coeff : objective)
+   {
+      os << " + " << coeff.second << " " << get_col_name(coeff.first);
+   }
+   os << "\nSubject To\n";
+   for(const auto& r : rows)
+   {
+      os << " " << r.name << ":";
+      for(const auto& coeff : r.coeffs)
+      {
+         os << " " << (coeff.second < 0.0 ? "- " : "+ ") << std::fabs(coeff.second) << " " << get_col_name(coeff.first);
+      }
+      os << (r.sign == G ? " >= " : (r.sign == L ? " <= " : " = ")) << r.rhs << "\n";
+   }
+   os << "Bounds\n";
+   for(size_t var = 0; var < col_names.size(); var++)
+   {
+      const auto v = static_cast<int>(var);
+      os << " " << (lower_bounds.count(v) ? lower_bounds.at(v) : 0.0) << " <= " << get_col_name(v);
+      if(upper_bounds.count(v))
+      {
+         os << " <= " << upper_bounds.at(v);
+      }
+      os << "\n";
+   }
+   os << "General\n";
+   for(size_t var = 0; var < col_names.size(); var++)
+   {
+      if(int_vars[var])
+      {
+         os << " " << get_col_name(static_cast<int>(var)) << "\n";
+      }
+   }
+   os << "End\n";
+}
+
+void sdc_solver::print_to_file(const std::string& file_name)
+{
+   std::ofstream file((file_name + ".lp").c_str());
+   print(file);
+}
@@ -0,0 +1,155 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file sdc_solver.hpp
+ * @brief Native solver for systems of difference constraints
+ *
+ * The solver accepts only constraints involving at most two variables with opposite unit coefficients, as produced by
+ * SDC scheduling. Such systems are totally unimodular and their least solution is computed as a longest path on the
+ * constraint graph, without resorting to a generic (I)LP engine.
+ *
+ */
+#ifndef SDC_SOLVER_HPP
+#define SDC_SOLVER_HPP
+
+#include "meilp_solver.hpp"
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+class sdc_solver : public meilp_solver
+{
+ private:
+   /// A row of the problem as passed to add_row (kept only for printing)
+   struct row
+   {
+      std::map<int, double> coeffs;
+      double rhs;
+      ilp_sign sign;
+      std::string name;
+   };
+
+   /// The rows of the problem
+   std::vector<row> rows;
+
+   /// The names of the variables
+   std::vector<std::string> col_names;
+
+   /// True if the corresponding variable is integer
+   std::vector<bool> int_vars;
+
+   /// The objective function normalized to a minimization
+   std::map<int, double> objective;
+
+   /// Constraint graph: node 0 is the constant zero, node i + 1 is variable i; an edge (u, v, w) encodes v >= u + w
+   std::vector<std::vector<std::pair<size_t, double>>> out_edges;
+
+   /// The current least solution indexed by node
+   std::vector<double> values;
+
+   /// The lower bounds used to seed the current solution
+   std::vector<double> seeded_lower_bounds;
+
+   /// Nodes whose outgoing edges have been added after the last solve
+   std::vector<size_t> dirty;
+
+   /// True if values can be used as starting point of the next solve
+   bool warm;
+
+   /// True if the current solution has been computed enforcing integrality
+   bool integral_solution;
+
+   /**
+    * Add the edge v >= u + w to the constraint graph
+    * @param u is the source node
+    * @param v is the target node
+    * @param w is the weight
+    */
+   void add_edge(size_t u, size_t v, double w);
+
+   /**
+    * Compute the least solution satisfying all the constraints
+    * @param integral specifies if integer variables have to be rounded up
+    * @return 0 if the problem is feasible, 1 otherwise
+    */
+   int solve_internal(bool integral);
+
+   void set_all_bounds() override;
+
+   void print(std::ostream& os) override;
+
+ public:
+   /**
+    * Constructor
+    */
+   sdc_solver();
+
+   ~sdc_solver() override;
+
+   void make(int nvars) override;
+
+   int solve() override;
+
+   int solve_ilp() override;
+
+   /**
+    * Add a difference constraint; rows involving more than two variables or not unit coefficients are rejected
+    */
+   void add_row(std::map<int, double>& i_coeffs, double i_rhs, ilp_sign i_sign, const std::string& name) override;
+
+   /**
+    * Set the objective function; since the least solution is returned, after normalization to a minimization all the
+    * coefficients must be non-negative
+    */
+   void objective_add(std::map<int, double>& i_coeffs, ilp_dir dir) override;
+
+   void set_int(int i) override;
+
+   void get_vars_solution(std::map<int, double>& vars) const override;
+
+   int get_number_constraints() const override;
+
+   int get_number_variables() const override;
+
+   void set_col_name(int var, const std::string& name) override;
+
+   std::string get_col_name(int var) override;
+
+   int add_empty_column() override;
+
+   void print_to_file(const std::string& file_name) override;
+};
+#endif
@@ -46,9 +46,14 @@
 #include "parse_tree.hpp"
 
 #include "Parameter.hpp"
+#include "compiler_wrapper.hpp"
 #include "dbgPrintHelper.hpp"
+#include "exceptions.hpp"
 #include "refcount.hpp"
+#include "tree_manager.hpp"
+#include "tree_node.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 
@@ -56,11 +61,17 @@
 extern int exit_code;
 extern tree_managerRef tree_parseY(const ParameterConstRef Param, std::string fn);
 
-tree_managerRef ParseTreeFile(const ParameterConstRef& Param, const std::string& f)
+tree_managerRef ParseTreeFile(const ParameterConstRef& Param, const std::string& f, bool serial)
 {
    try
    {
-      return tree_parseY(Param, f);
+      const auto TM = tree_parseY(Param, f);
+      if(serial)
+      {
+         UniquifySSAVersions(TM);
+         CompilerWrapper::bambu_ir_info = TM->GetIRInfo();
+      }
+      return TM;
    }
    catch(const char* msg)
    {
@@ -77,3 +88,25 @@ tree_managerRef ParseTreeFile(const ParameterConstRef& Param, const std::string&
    THROW_ERROR_CODE(exit_code, "Error in tree parsing");
    return tree_managerRef();
 }
+
+void UniquifySSAVersions(const tree_managerRef& TM)
+{
+   /// number of ssa_name nodes parsed so far
+   static unsigned int parsed_versions = 0;
+   unsigned int max_vers = 0;
+   const auto last_node_id = TM->get_next_available_tree_node_id();
+   for(unsigned int i = 1; i < last_node_id; ++i)
+   {
+      if(TM->is_tree_node(i))
+      {
+         const auto tn = TM->GetTreeNode(i);
+         if(tn->get_kind() == ssa_name_K)
+         {
+            const auto sn = GetPointerS<ssa_name>(tn);
+            max_vers = std::max(max_vers, sn->vers);
+            sn->vers += parsed_versions;
+         }
+      }
+   }
+   parsed_versions += max_vers;
+}
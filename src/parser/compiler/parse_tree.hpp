@@ -61,10 +61,21 @@ REF_FORWARD_DECL(tree_manager);
  *
  * @param Param is the set of input parameters
  * @param f the input file name
- * @param debug_level is the the debug_level
+ * @param serial when false the file can be parsed concurrently with other ones: the versions of the ssa_name nodes
+ * are left local to the parsed file and the compiler version information is not stored in
+ * CompilerWrapper::bambu_ir_info, so UniquifySSAVersions must be called on the result before it is merged and the
+ * version information must be taken from tree_manager::GetIRInfo by the merging thread
  * @return the tree manager associated to the raw file.
 
 */
-tree_managerRef ParseTreeFile(const ParameterConstRef& Param, const std::string& f);
+tree_managerRef ParseTreeFile(const ParameterConstRef& Param, const std::string& f, bool serial = true);
+
+/**
+ * Shift the versions of the ssa_name nodes of a tree manager parsed with local versions so that they do not overlap
+ * with the ones of the tree managers previously processed. Calling it in file order gives the same numbering obtained
+ * by parsing the files serially. It is not thread safe.
+ * @param TM is the tree manager returned by ParseTreeFile(Param, f, false)
+ */
+void UniquifySSAVersions(const tree_managerRef& TM);
 
 #endif
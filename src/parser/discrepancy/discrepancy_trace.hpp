@@ -0,0 +1,64 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file discrepancy_trace.hpp
+ * @brief Layout of the binary trace written by the C code instrumented for the discrepancy analysis
+ *
+ * The trace starts with the DISCREPANCY_TRACE_MAGIC header, followed by fixed size little-endian records made of a
+ * 32-bit kind, a 32-bit identifier and a 64-bit value. Records of kind DISCR_TRACE_OP are followed by the raw
+ * little-endian bytes of the value assigned by the operation; their number is computed from the bitsize stored in
+ * Discrepancy::c_op_descriptors.
+ *
+ */
+#ifndef DISCREPANCY_TRACE_HPP
+#define DISCREPANCY_TRACE_HPP
+
+/// The header of the binary trace (the string terminator is not written)
+#define DISCREPANCY_TRACE_MAGIC "BAMBUDT1"
+#define DISCREPANCY_TRACE_MAGIC_SIZE 8
+
+/// The size in bytes of a record
+#define DISCREPANCY_TRACE_RECORD_SIZE 16
+
+enum discrepancy_trace_record_kind
+{
+   DISCR_TRACE_ROOT_CONTEXT = 1, ///< value: the context of the main function
+   DISCR_TRACE_CALL = 2,         ///< id: the index of the call statement
+   DISCR_TRACE_CONTEXT = 3,      ///< id: the index of the called function, value: the context of the call
+   DISCR_TRACE_CONTEXT_END = 4,  ///< end of the current context
+   DISCR_TRACE_VARDECL = 5,      ///< id: the index of the variable, value: its address
+   DISCR_TRACE_BB = 6,           ///< id: the index of the function, value: the index of the executed basic block
+   DISCR_TRACE_OP = 7            ///< id: the index in Discrepancy::c_op_descriptors, value: the current context
+};
+
+#endif
@@ -47,16 +47,249 @@
 
 // include from /utility
 #include "exceptions.hpp"
+#include "string_manipulation.hpp"
 
-REF_FORWARD_DECL(Discrepancy);
+#include "Discrepancy.hpp"
+#include "UnfoldedCallGraph.hpp"
+#include "UnfoldedCallInfo.hpp"
+#include "UnfoldedFunctionInfo.hpp"
+#include "discrepancy_trace.hpp"
+
+#include <cstring>
+#include <fcntl.h>
+#include <list>
+#include <stack>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
 
 extern void discrepancy_parseY(const std::string& fname, DiscrepancyRef Discrepancy);
 
+namespace
+{
+   /// Read-only memory mapping of a whole file, released on destruction
+   class mapped_file
+   {
+      void* mapping;
+
+      size_t length;
+
+    public:
+      explicit mapped_file(const std::string& filename) : mapping(MAP_FAILED), length(0)
+      {
+         const auto fd = open(filename.c_str(), O_RDONLY);
+         if(fd < 0)
+         {
+            THROW_ERROR("Failed opening discrepancy data file: " + filename);
+         }
+         struct stat file_stat;
+         if(fstat(fd, &file_stat) == 0 && file_stat.st_size > 0)
+         {
+            length = static_cast<size_t>(file_stat.st_size);
+            mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(mapping != MAP_FAILED)
+            {
+               madvise(mapping, length, MADV_SEQUENTIAL);
+            }
+         }
+         close(fd);
+         if(length && mapping == MAP_FAILED)
+         {
+            THROW_ERROR("Failed mapping discrepancy data file: " + filename);
+         }
+      }
+
+      ~mapped_file()
+      {
+         if(mapping != MAP_FAILED)
+         {
+            munmap(mapping, length);
+         }
+      }
+
+      mapped_file(const mapped_file&) = delete;
+      mapped_file& operator=(const mapped_file&) = delete;
+
+      const unsigned char* data() const
+      {
+         return static_cast<const unsigned char*>(mapping);
+      }
+
+      size_t size() const
+      {
+         return length;
+      }
+   };
+
+   uint64_t read_le(const unsigned char* bytes, unsigned int n_bytes)
+   {
+      uint64_t value = 0;
+      while(n_bytes--)
+      {
+         value = (value << 8) | bytes[n_bytes];
+      }
+      return value;
+   }
+
+   /*
+    * Replay the records of the binary trace with the same semantics of the
+    * actions of the textual grammar (see discrepancyParser.ypp)
+    */
+   void parse_binary_discrepancy(const unsigned char* data, const size_t size, const DiscrepancyRef& Discr)
+   {
+      const auto& descriptors = Discr->c_op_descriptors;
+      /// the trace of each descriptor is looked up only once, std::map never invalidates it
+      std::vector<std::list<std::pair<uint64_t, std::string>>*> op_traces(descriptors.size(), nullptr);
+      std::stack<uint64_t> context_stack;
+      std::stack<UnfoldedVertexDescriptor> vertex_stack;
+      unsigned int call_id = 0;
+      size_t offset = DISCREPANCY_TRACE_MAGIC_SIZE;
+      while(offset < size)
+      {
+         if(size - offset < DISCREPANCY_TRACE_RECORD_SIZE)
+         {
+            THROW_ERROR("truncated discrepancy trace record at offset " + STR(offset));
+         }
+         const auto kind = read_le(data + offset, 4);
+         const auto id = static_cast<unsigned int>(read_le(data + offset + 4, 4));
+         const auto value = read_le(data + offset + 8, 8);
+         offset += DISCREPANCY_TRACE_RECORD_SIZE;
+         if(kind != DISCR_TRACE_ROOT_CONTEXT && kind != DISCR_TRACE_CALL && context_stack.empty())
+         {
+            THROW_ERROR("malformed call stack trace at offset " + STR(offset));
+         }
+         switch(kind)
+         {
+            case DISCR_TRACE_ROOT_CONTEXT:
+            {
+               THROW_ASSERT(context_stack.empty() && vertex_stack.empty(), "initial_context = " + STR(value));
+               Discr->c_addr_map[value];
+               context_stack.push(value);
+               break;
+            }
+            case DISCR_TRACE_CALL:
+            {
+               call_id = id;
+               break;
+            }
+            case DISCR_TRACE_CONTEXT:
+            {
+               // the new address map starts as a copy of the one of the caller
+               Discr->c_addr_map[value];
+               THROW_ASSERT(Discr->c_addr_map.find(context_stack.top()) != Discr->c_addr_map.end(),
+                            "cant find address map for context " + STR(context_stack.top()));
+               auto& addr_map = Discr->c_addr_map.at(value);
+               for(const auto& a : Discr->c_addr_map.at(context_stack.top()))
+               {
+                  addr_map.insert(a);
+               }
+               context_stack.push(value);
+               if(vertex_stack.empty())
+               {
+                  // the initial context is the root function
+                  vertex_stack.push(Discr->unfolded_root_v);
+               }
+               else
+               {
+                  // look for an edge with the same call_id going to a vertex with the same called function
+                  const UnfoldedCallGraph& ufcg = Discr->DiscrepancyCallGraph;
+                  bool found = false;
+                  UnfoldedOutEdgeIterator oe_it, oe_end;
+                  for(boost::tie(oe_it, oe_end) = boost::out_edges(vertex_stack.top(), ufcg); oe_it != oe_end;
+                      ++oe_it)
+                  {
+                     const auto tgt = boost::target(*oe_it, ufcg);
+                     if(Cget_raw_edge_info<UnfoldedCallInfo>(*oe_it, ufcg)->call_id == call_id &&
+                        Cget_node_info<UnfoldedFunctionInfo>(tgt, ufcg)->f_id == id)
+                     {
+                        vertex_stack.push(tgt);
+                        found = true;
+                        break;
+                     }
+                  }
+                  if(!found)
+                  {
+                     THROW_ERROR("new target vertex not found for call " + STR(call_id) + " to function " + STR(id));
+                  }
+               }
+               THROW_ASSERT(Discr->unfolded_v_to_scope.find(vertex_stack.top()) != Discr->unfolded_v_to_scope.end(),
+                            "can't find scope for new vertex " + STR(id));
+               Discr->context_to_scope[value] = Discr->unfolded_v_to_scope.at(vertex_stack.top());
+               break;
+            }
+            case DISCR_TRACE_CONTEXT_END:
+            {
+               context_stack.pop();
+               if(!vertex_stack.empty())
+               {
+                  vertex_stack.pop();
+               }
+               break;
+            }
+            case DISCR_TRACE_VARDECL:
+            {
+               Discr->c_addr_map[context_stack.top()][id] = value;
+               break;
+            }
+            case DISCR_TRACE_BB:
+            {
+               Discr->c_control_flow_trace[id][context_stack.top()].emplace_back(static_cast<unsigned int>(value));
+               break;
+            }
+            case DISCR_TRACE_OP:
+            {
+               if(id >= descriptors.size())
+               {
+                  THROW_ERROR("unknown operation descriptor " + STR(id) + " in discrepancy trace");
+               }
+               const auto bitsize = descriptors[id].second;
+               const auto n_bytes = (bitsize + 7) / 8;
+               if(size - offset < n_bytes)
+               {
+                  THROW_ERROR("truncated discrepancy trace value at offset " + STR(offset));
+               }
+               // the textual representation of the value starts from the most significant bit
+               std::string bits(bitsize, '0');
+               for(unsigned int b = 0; b < bitsize; ++b)
+               {
+                  if((data[offset + b / 8] >> (b % 8)) & 1)
+                  {
+                     bits[bitsize - 1 - b] = '1';
+                  }
+               }
+               offset += n_bytes;
+               if(!op_traces[id])
+               {
+                  op_traces[id] = &Discr->c_op_trace[descriptors[id].first];
+               }
+               op_traces[id]->emplace_back(value, std::move(bits));
+               break;
+            }
+            default:
+            {
+               THROW_ERROR("unknown discrepancy trace record kind " + STR(kind) + " at offset " + STR(offset));
+            }
+         }
+      }
+   }
+} // namespace
+
 void parse_discrepancy(const std::string& c_trace_filename, DiscrepancyRef Discrepancy)
 {
    try
    {
-      discrepancy_parseY(c_trace_filename, Discrepancy);
+      const mapped_file trace(c_trace_filename);
+      if(trace.size() >= DISCREPANCY_TRACE_MAGIC_SIZE &&
+         !std::memcmp(trace.data(), DISCREPANCY_TRACE_MAGIC, DISCREPANCY_TRACE_MAGIC_SIZE))
+      {
+         parse_binary_discrepancy(trace.data(), trace.size(), Discrepancy);
+      }
+      else
+      {
+         // traces written by older instrumented code are textual
+         discrepancy_parseY(c_trace_filename, Discrepancy);
+      }
       return;
    }
    catch(const char* msg)
@@ -42,11 +42,240 @@
 /// Header include
 #include "xml_dom_parser.hpp"
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <utility>
+#include <vector>
 
 /// Utility include
+#include "custom_map.hpp"
+#include "exceptions.hpp"
 #include "fileIO.hpp"
 
+/// XML include
+#include "xml_document.hpp"
+#include "xml_element.hpp"
+#include "xml_text_node.hpp"
+
+/// magic string and format version of the binary snapshots of parsed documents
+#define XML_SNAPSHOT_MAGIC "PXMLBIN"
+#define XML_SNAPSHOT_VERSION 2U
+
+static bool read_file(const std::filesystem::path& filename, std::string& buffer)
+{
+   std::ifstream file(filename, std::ios::binary);
+   if(!file)
+   {
+      return false;
+   }
+   buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+   return !file.bad();
+}
+
+/**
+ * Serializer of a parsed document: names, attribute values and texts are interned in a string table written before
+ * the pre-order encoding of the element tree, so that repeated tags and values are stored once.
+ */
+class xml_snapshot_writer
+{
+   CustomUnorderedMap<std::string, uint32_t> string_ids;
+
+   std::vector<std::string> strings;
+
+   std::string tree;
+
+   void put(std::string& out, uint64_t value, size_t size)
+   {
+      out.append(reinterpret_cast<const char*>(&value), size);
+   }
+
+   void put_string(const std::string& str)
+   {
+      auto it = string_ids.find(str);
+      if(it == string_ids.end())
+      {
+         it = string_ids.insert(std::make_pair(str, static_cast<uint32_t>(strings.size()))).first;
+         strings.push_back(str);
+      }
+      put(tree, it->second, sizeof(uint32_t));
+   }
+
+   void put_element(const xml_element* element)
+   {
+      tree.push_back('E');
+      put_string(element->get_name());
+      put(tree, static_cast<uint32_t>(element->get_line()), sizeof(uint32_t));
+      const auto& attributes = element->get_attributes();
+      put(tree, attributes.size(), sizeof(uint32_t));
+      for(const auto* attribute : attributes)
+      {
+         put_string(attribute->get_name());
+         put_string(attribute->get_value());
+      }
+      /// the parser only builds elements and texts, any other kind of node is not part of the snapshot
+      std::vector<const xml_node*> children;
+      for(const auto& child : element->get_children())
+      {
+         if(GetPointer<const xml_element>(child) || GetPointer<const xml_text_node>(child))
+         {
+            children.push_back(child.get());
+         }
+      }
+      put(tree, children.size(), sizeof(uint32_t));
+      for(const auto* child : children)
+      {
+         if(const auto* child_element = dynamic_cast<const xml_element*>(child))
+         {
+            put_element(child_element);
+         }
+         else
+         {
+            tree.push_back('T');
+            put_string(static_cast<const xml_text_node*>(child)->get_content());
+         }
+      }
+   }
+
+ public:
+   std::string operator()(const xml_element* root, uint64_t source_size, const std::string& source_digest)
+   {
+      put_element(root);
+      std::string out(XML_SNAPSHOT_MAGIC, sizeof(XML_SNAPSHOT_MAGIC));
+      put(out, XML_SNAPSHOT_VERSION, sizeof(uint32_t));
+      put(out, source_size, sizeof(uint64_t));
+      put(out, source_digest.size(), sizeof(uint32_t));
+      out.append(source_digest);
+      put(out, strings.size(), sizeof(uint32_t));
+      for(const auto& str : strings)
+      {
+         put(out, str.size(), sizeof(uint32_t));
+         out.append(str);
+      }
+      out.append(tree);
+      return out;
+   }
+};
+
+/**
+ * Deserializer of the snapshots produced by xml_snapshot_writer; any inconsistency makes the snapshot invalid.
+ */
+class xml_snapshot_reader
+{
+   const std::string& buffer;
+
+   size_t pos;
+
+   bool valid;
+
+   std::vector<std::string> strings;
+
+   uint64_t get(size_t size)
+   {
+      uint64_t value = 0;
+      if(!valid || buffer.size() - pos < size)
+      {
+         valid = false;
+         return 0;
+      }
+      std::memcpy(&value, buffer.data() + pos, size);
+      pos += size;
+      return value;
+   }
+
+   const std::string& get_string()
+   {
+      static const std::string empty;
+      const auto id = get(sizeof(uint32_t));
+      if(id >= strings.size())
+      {
+         valid = false;
+         return empty;
+      }
+      return strings[id];
+   }
+
+   void get_element(xml_element* element)
+   {
+      element->set_line(static_cast<int>(get(sizeof(uint32_t))));
+      const auto n_attributes = get(sizeof(uint32_t));
+      for(uint64_t i = 0; i < n_attributes && valid; ++i)
+      {
+         const auto& attribute_name = get_string();
+         const auto& attribute_value = get_string();
+         if(valid)
+         {
+            element->set_attribute(attribute_name, attribute_value);
+         }
+      }
+      const auto n_children = get(sizeof(uint32_t));
+      for(uint64_t i = 0; i < n_children && valid; ++i)
+      {
+         const auto kind = static_cast<char>(get(1));
+         const auto& content = get_string();
+         if(!valid)
+         {
+            break;
+         }
+         if(kind == 'E')
+         {
+            get_element(element->add_child_element(content));
+         }
+         else if(kind == 'T')
+         {
+            element->add_child_text(content);
+         }
+         else
+         {
+            valid = false;
+         }
+      }
+   }
+
+ public:
+   explicit xml_snapshot_reader(const std::string& _buffer) : buffer(_buffer), pos(0), valid(true)
+   {
+   }
+
+   xml_documentRef operator()(uint64_t source_size, const std::string& source_digest)
+   {
+      if(buffer.compare(0, sizeof(XML_SNAPSHOT_MAGIC), XML_SNAPSHOT_MAGIC, sizeof(XML_SNAPSHOT_MAGIC)) != 0)
+      {
+         return xml_documentRef();
+      }
+      pos = sizeof(XML_SNAPSHOT_MAGIC);
+      if(get(sizeof(uint32_t)) != XML_SNAPSHOT_VERSION || get(sizeof(uint64_t)) != source_size ||
+         get(sizeof(uint32_t)) != source_digest.size() || !valid ||
+         buffer.compare(pos, source_digest.size(), source_digest) != 0)
+      {
+         return xml_documentRef();
+      }
+      pos += source_digest.size();
+      const auto n_strings = get(sizeof(uint32_t));
+      for(uint64_t i = 0; i < n_strings && valid; ++i)
+      {
+         const auto size = get(sizeof(uint32_t));
+         if(!valid || buffer.size() - pos < size)
+         {
+            return xml_documentRef();
+         }
+         strings.emplace_back(buffer, pos, size);
+         pos += size;
+      }
+      if(get(1) != 'E')
+      {
+         return xml_documentRef();
+      }
+      const xml_documentRef doc(new xml_document());
+      const auto& root_name = get_string();
+      if(valid)
+      {
+         get_element(doc->create_root_node(root_name));
+      }
+      return valid && pos == buffer.size() ? doc : xml_documentRef();
+   }
+};
+
 XMLDomParser::XMLDomParser(const std::string& _name, const std::string& string_to_be_parsed)
     : name(_name), to_be_parsed(string_to_be_parsed)
 
@@ -71,3 +300,45 @@ const xml_documentRef XMLDomParser::get_document() const
 {
    return doc;
 }
+
+void XMLDomParser::Exec(const std::filesystem::path& cache_directory)
+{
+   THROW_ASSERT(name == to_be_parsed, "Only files can be parsed through a snapshot");
+   std::string source;
+   if(!read_file(to_be_parsed, source))
+   {
+      /// let the parser resolve compressed variants and report missing files
+      Exec();
+      return;
+   }
+   const auto source_digest = ContentDigest(source);
+   const auto snapshot = cache_directory / (std::filesystem::path(to_be_parsed).filename().string() + "." +
+                                            ContentDigest(std::filesystem::absolute(to_be_parsed).string()) + ".xbin");
+
+   std::string snapshot_buffer;
+   if(read_file(snapshot, snapshot_buffer))
+   {
+      doc = xml_snapshot_reader(snapshot_buffer)(source.size(), source_digest);
+      if(doc)
+      {
+         return;
+      }
+      /// the snapshot of an older version of the file is removed, so that the new one can be stored: concurrent
+      /// readers are not affected since they load the whole snapshot with a single read
+      std::error_code ec;
+      std::filesystem::remove(snapshot, ec);
+   }
+
+   Exec();
+   if(!doc || !doc->get_root_node())
+   {
+      return;
+   }
+   if(!StoreCacheEntry(snapshot, [&](const std::filesystem::path& staging) {
+         std::ofstream staging_file(staging, std::ios::binary);
+         staging_file << xml_snapshot_writer()(doc->get_root_node(), source.size(), source_digest);
+      }))
+   {
+      THROW_WARNING("Snapshot of " + to_be_parsed + " could not be stored in " + cache_directory.string());
+   }
+}
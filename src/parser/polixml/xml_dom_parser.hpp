@@ -41,6 +41,7 @@
 #define XML_DOM_PARSER_HPP
 
 /// STD include
+#include <filesystem>
 #include <string>
 
 /// utility includes
@@ -89,6 +90,14 @@ class XMLDomParser
     */
    void Exec();
 
+   /**
+    * Parse an XML document from a file going through a binary snapshot of the parsed document.
+    * The snapshot stored in cache_directory is used only when it was taken from a source file with the same checksum;
+    * otherwise the file is parsed and a new snapshot is written.
+    * @param cache_directory is the directory where the snapshots are stored
+    */
+   void Exec(const std::filesystem::path& cache_directory);
+
    /** Test whether a document has been parsed.
     */
    operator bool() const;
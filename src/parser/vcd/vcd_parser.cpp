@@ -36,17 +36,96 @@
 
 // include class header
 #include "vcd_parser.hpp"
+#include <cctype>
 #include <iostream>
-// include from ./
-#include "Parameter.hpp"
 
 #include "dbgPrintHelper.hpp" // for DEBUG_LEVEL_
 #include "hash_helper.hpp"
-#include "string_manipulation.hpp" // for GET_CLASS
+#include "string_manipulation.hpp" // for STR
 #include "structural_objects.hpp"
 
-vcd_parser::vcd_parser(const ParameterConstRef& param)
-    : debug_level(param->get_class_debug_level(GET_CLASS(*this))), vcd_fp(nullptr), sig_n(0)
+/**
+ * Splits the simulation part of a vcd file in whitespace separated tokens, reading the file in large chunks.
+ * Tokens have no length limit.
+ */
+class vcd_token_reader
+{
+ public:
+   explicit vcd_token_reader(FILE* _fp) : fp(_fp), buffer(1U << 20), begin(0), end(0)
+   {
+   }
+
+   /**
+    * Reads the next token
+    * @param [out] token: the token read
+    * @return false at the end of the file
+    */
+   bool next(std::string& token)
+   {
+      token.clear();
+      while(fill())
+      {
+         const char* const data = buffer.data();
+         if(token.empty())
+         {
+            while(begin < end && isspace(static_cast<unsigned char>(data[begin])))
+            {
+               ++begin;
+            }
+         }
+         auto last = begin;
+         while(last < end && !isspace(static_cast<unsigned char>(data[last])))
+         {
+            ++last;
+         }
+         token.append(data + begin, last - begin);
+         begin = last;
+         if(begin < end && !token.empty())
+         {
+            return true;
+         }
+      }
+      return !token.empty();
+   }
+
+   /**
+    * Skips all the tokens up to the next $end
+    * @return false if $end is not found
+    */
+   bool skip_to_end()
+   {
+      std::string token;
+      while(next(token))
+      {
+         if(token.compare(0, 4, "$end") == 0)
+         {
+            return true;
+         }
+      }
+      return false;
+   }
+
+ private:
+   FILE* const fp;
+   std::vector<char> buffer;
+   size_t begin;
+   size_t end;
+
+   /**
+    * @return false if the buffer is empty and there is nothing more to read
+    */
+   bool fill()
+   {
+      if(begin == end)
+      {
+         begin = 0;
+         end = fread(buffer.data(), 1, buffer.size(), fp);
+      }
+      return begin < end;
+   }
+};
+
+vcd_parser::vcd_parser(int _debug_level) : debug_level(_debug_level), vcd_fp(nullptr), sig_n(0)
 {
 }
 
@@ -93,9 +172,31 @@ vcd_parser::vcd_trace_t vcd_parser::parse_vcd(const std::string& vcd_file_to_par
    vcd_parse_def();
    // parse waveforms
    vcd_parse_sim();
+   for(auto& scope : parse_result)
+   {
+      for(auto& signal : scope.second)
+      {
+         signal.second.shrink_to_fit();
+      }
+   }
    // ---- statistics ----
    INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
                   "Number of selected signals: " + STR(scope_and_name_to_sig_info.size()) + "/" + STR(sig_n));
+   if(debug_level >= DEBUG_LEVEL_VERBOSE)
+   {
+      size_t variations = 0;
+      size_t memory_usage = 0;
+      for(const auto& scope : parse_result)
+      {
+         for(const auto& signal : scope.second)
+         {
+            variations += signal.second.size();
+            memory_usage += signal.second.memory_usage();
+         }
+      }
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
+                     "Stored " + STR(variations) + " variations in " + STR(memory_usage) + " bytes");
+   }
    // ---- cleanup ----
    INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "-->Cleaning up VCD parser");
    fclose(vcd_fp);
@@ -103,6 +204,7 @@ vcd_parser::vcd_trace_t vcd_parser::parse_vcd(const std::string& vcd_file_to_par
    vcd_filename.clear();
    scope_and_name_to_sig_info.clear();
    vcd_id_to_scope_and_name.clear();
+   vcd_id_to_targets.clear();
    INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "<--Cleaned up VCD parser");
    return std::move(parse_result);
 }
@@ -386,121 +488,56 @@ int vcd_parser::vcd_parse_def()
    return 0;
 }
 
-/**
- * Reads the next token from the file and calls the appropriate fuction
- */
-int vcd_parser::vcd_parse_sim_vector(char* value, unsigned long timestamp)
-{
-   char sym[256];  /* String value of signal symbol */
-   int chars_read; /* Number of characters scanned in */
-
-   if(fscanf(vcd_fp, "%255s%n", sym, &chars_read) == 1)
-   {
-      if(chars_read > 256)
-      {
-         THROW_ERROR("Overflow. Read token too long");
-      }
-
-      /* add variation to signal list -> normal vector */
-      add_variation(sym, value, timestamp);
-   }
-   else
-   {
-      THROW_ERROR("Bad file format");
-   }
-
-   return 0;
-}
-
-/**
- * Reads the next token from the file and calls the appropriate function
- */
-int vcd_parser::vcd_parse_sim_real(char* value, unsigned long timestamp)
-{
-   char sym[256];  /* String value of signal symbol */
-   int chars_read; /* Number of characters scanned in */
-
-   if(fscanf(vcd_fp, "%255s%n", sym, &chars_read) == 1)
-   {
-      if(chars_read > 256)
-      {
-         THROW_ERROR("Overflow. Read token too long");
-      }
-
-      /* add variation to signal list */
-      add_variation(sym, value, timestamp);
-   }
-   else
-   {
-      THROW_ERROR("Bad file format");
-   }
-   return 0;
-}
-
 /**
  * Parses all lines that occur in the simulation portion of the VCD file.
  */
 int vcd_parser::vcd_parse_sim()
 {
-   char token[4100];                /* Current token from VCD file */
-   unsigned long last_timestep = 0; /* Value of last timestamp from file */
-   int chars_read;                  /* Number of characters scanned in */
-   bool carry_over = false;         /* Specifies if last string was too long */
+   vcd_token_reader reader(vcd_fp);
+   std::string token;                    /* Current token from VCD file */
+   std::string sym;                      /* String value of signal symbol */
+   unsigned long long last_timestep = 0; /* Value of last timestamp from file */
 
    // initialize the waveforms
    init_variations();
-   while(!feof(vcd_fp) && (fscanf(vcd_fp, "%4099s%n", token, &chars_read) == 1))
+   while(reader.next(token))
    {
-      if(chars_read < 4099)
+      if(token[0] == '$')
       {
-         if(token[0] == '$')
-         {
-            /* Maybe could be a comment area */
-            if(strncmp("comment", (token + 1), 7) == 0)
-            {
-               if(vcd_parse_skip_to_end())
-               {
-                  THROW_ERROR("missing $end token in parsed vcd file: " + vcd_filename);
-               }
-            }
-         }
-         else if((token[0] == 'b') || (token[0] == 'B'))
+         /* Maybe could be a comment area */
+         if(token.compare(1, 7, "comment") == 0)
          {
-            if(vcd_parse_sim_vector((token + 1), last_timestep))
+            if(!reader.skip_to_end())
             {
-               THROW_ERROR("can't parse binary value change for signal: " + STR(token));
-            }
-         }
-         else if((token[0] == 'r') || (token[0] == 'R') || carry_over)
-         {
-            if(vcd_parse_sim_real((token + 1), last_timestep))
-            {
-               THROW_ERROR("can't parse real value change for signal: " + STR(token));
+               THROW_ERROR("missing $end token in parsed vcd file: " + vcd_filename);
             }
-            carry_over = false;
          }
-         else if(token[0] == '#')
-         {
-            last_timestep = std::stoul(token + 1, nullptr, 10);
-         }
-         else if((token[0] == '0') || (token[0] == '1') || (token[0] == 'x') || (token[0] == 'X') ||
-                 (token[0] == 'z') || (token[0] == 'Z'))
-         {
-            /* normal signal -> add to vector */
-            char tmp[2];
-            tmp[0] = token[0];
-            tmp[1] = '\0';
-
-            add_variation(token + 1, tmp, last_timestep);
-         }
-         else
+      }
+      else if((token[0] == 'b') || (token[0] == 'B') || (token[0] == 'r') || (token[0] == 'R'))
+      {
+         /* vector or real value: the signal symbol is the next token */
+         if(!reader.next(sym))
          {
-            THROW_ERROR("Badly placed token in simulation part");
+            THROW_ERROR("can't parse value change for signal: " + token);
          }
+         token.erase(0, 1);
+         add_variation(sym, token, last_timestep);
+      }
+      else if(token[0] == '#')
+      {
+         last_timestep = std::stoull(token.substr(1), nullptr, 10);
+      }
+      else if((token[0] == '0') || (token[0] == '1') || (token[0] == 'x') || (token[0] == 'X') ||
+              (token[0] == 'z') || (token[0] == 'Z'))
+      {
+         /* normal signal -> add to vector */
+         sym.assign(token, 1, std::string::npos);
+         token.resize(1);
+         add_variation(sym, token, last_timestep);
       }
       else
       {
-         carry_over = true;
+         THROW_ERROR("Badly placed token in simulation part");
       }
    }
 
@@ -536,7 +573,6 @@ void vcd_parser::vcd_add_signal(const std::string& scope, const std::string& nam
       scope_and_name_to_sig_info.insert(std::make_pair(key, vcd_sig_info(type, isvect, msb, lsb)));
       scope_and_name_to_sig_info.at(key).vcd_id_to_bit[vcd_id] = lsb;
       vcd_id_to_scope_and_name[vcd_id].insert(key);
-      parse_result.at(scope)[name] = std::list<sig_variation>();
    }
    else
    { // some bits of the signal have already been declared
@@ -576,13 +612,27 @@ bool vcd_parser::check_signals() const
 
 void vcd_parser::init_variations()
 {
+   for(const auto& si : scope_and_name_to_sig_info)
+   {
+      const auto width = si.second.msb - si.second.lsb + 1;
+      auto& trace = parse_result.at(si.first.first).emplace(si.first.second, vcd_signal_trace(width)).first->second;
+      trace.set_value(0, std::string(width, 'x'));
+   }
    for(const auto& vcd2sn : vcd_id_to_scope_and_name)
    {
+      auto& targets = vcd_id_to_targets[vcd2sn.first];
       for(const auto& sn : vcd2sn.second)
       {
          const vcd_sig_info& siginfo = scope_and_name_to_sig_info.at(sn);
-         std::list<sig_variation>& vars = parse_result.at(sn.first).at(sn.second);
-         vars.emplace_back(0, std::string(siginfo.msb - siginfo.lsb + 1, 'x'));
+         THROW_ASSERT(!siginfo.vcd_id_to_bit.empty(),
+                      "signal " + sn.first + STR(HIERARCHY_SEPARATOR) + sn.second + " has no mapped vcd_id");
+         /*
+          * if the signal is a port vector with a separate id for every bit,
+          * the variations of this id change only the corresponding bit
+          */
+         const auto single_bit = siginfo.vcd_id_to_bit.size() > 1;
+         targets.push_back(vcd_id_target{&parse_result.at(sn.first).at(sn.second), single_bit,
+                                         single_bit ? siginfo.vcd_id_to_bit.at(vcd2sn.first) : 0});
       }
    }
 }
@@ -591,74 +641,38 @@ void vcd_parser::add_variation(const std::string& sig_id, const std::string& val
 {
    THROW_ASSERT(!value.empty(), "trying to add an empty variation for vcd id " + sig_id + " at time " + STR(ts));
    THROW_ASSERT(!sig_id.empty(), "adding a variation to unspecified vcd signal");
-   auto it = vcd_id_to_scope_and_name.find(sig_id);
-   if(it != vcd_id_to_scope_and_name.end())
+   const auto it = vcd_id_to_targets.find(sig_id);
+   if(it == vcd_id_to_targets.end())
+   {
+      return;
+   }
+   /*
+    * if another variation for a signal was already added in this cycle the
+    * trace overrides it. this can happen, especially in vcds produced by
+    * event based simulators
+    */
+   for(const auto& target : it->second)
    {
-      for(const auto& sn : it->second)
+      auto& trace = *target.trace;
+      if(target.single_bit)
       {
-         const vcd_sig_info& siginfo = scope_and_name_to_sig_info.at(sn);
-         std::list<sig_variation>& vars = parse_result.at(sn.first).at(sn.second);
-         THROW_ASSERT(vars.back().time_stamp <= ts, "Variations are not being added in time order: id = '" + sig_id +
-                                                        "', ts = " + STR(vars.back().time_stamp) + " > " + STR(ts));
-         THROW_ASSERT(!siginfo.vcd_id_to_bit.empty(),
-                      "signal " + sn.first + STR(HIERARCHY_SEPARATOR) + sn.second + " has no mapped vcd_id");
-         /* prepare the new value for variation to insert */
-         std::string new_value;
-         if(siginfo.vcd_id_to_bit.size() > 1)
-         {
-            /*
-             * the signal is a port vector with a separate id for every bit,
-             * so we must keep all the previous bits and change only the new
-             */
-            THROW_ASSERT(value.size() == 1, "variation of a bit is larger than a bit");
-            new_value = std::string(vars.back().value);
-            THROW_ASSERT(siginfo.vcd_id_to_bit.find(sig_id) != siginfo.vcd_id_to_bit.end(),
-                         "vcd id " + sig_id + " is not assigned to any bit of port" + sn.first +
-                             STR(HIERARCHY_SEPARATOR) + sn.second);
-            size_t idx = siginfo.vcd_id_to_bit.at(sig_id);
-            THROW_ASSERT(idx < new_value.size(), "vcd_id " + sig_id + " for signal " + sn.first +
-                                                     STR(HIERARCHY_SEPARATOR) + sn.second +
-                                                     " is mapped to a bit higher than port size");
-            new_value.at(new_value.size() - idx - 1) = value.front();
-         }
-         else
-         {
-            /*
-             * the signal can be a bit or a port vector, but in the vcd it
-             * has a single unique tag to represent all the bits
-             */
-            new_value = value;
-            /* check bit extension */
-            if((siginfo.msb - siginfo.lsb + 1) > value.size())
-            {
-               char leading = *new_value.begin();
-               char to_prepend = '0';
-               if(leading != '0' && leading != '1')
-               {
-                  to_prepend = leading;
-               }
-               while(new_value.size() < (siginfo.msb - siginfo.lsb + 1))
-               {
-                  new_value.insert(0, 1, to_prepend);
-               }
-            }
-         }
-
-         if(vars.back().time_stamp == ts)
-         {
-            /*
-             * another variation for this signal was already added in this
-             * cycle. this can happen, especially in vcds produced by event
-             * based simulators. in this case the last variation must
-             * override the others
-             */
-            vars.back().value = new_value;
-         }
-         else
-         {
-            vars.back().duration = ts - vars.back().time_stamp;
-            vars.emplace_back(ts, new_value);
-         }
+         THROW_ASSERT(value.size() == 1, "variation of a bit is larger than a bit");
+         THROW_ASSERT(target.bit < trace.bit_width(), "vcd_id " + sig_id + " is mapped to a bit higher than port size");
+         trace.set_bit(ts, target.bit, value.front());
+      }
+      else if(trace.bit_width() <= value.size())
+      {
+         trace.set_value(ts, value);
+      }
+      else
+      {
+         /*
+          * the signal can be a bit or a port vector, but in the vcd it
+          * has a single unique tag to represent all the bits: check bit extension
+          */
+         const char leading = value.front();
+         const char to_prepend = (leading != '0' && leading != '1') ? leading : '0';
+         trace.set_value(ts, std::string(trace.bit_width() - value.size(), to_prepend) + value);
       }
    }
 }
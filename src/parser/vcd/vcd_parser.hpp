@@ -38,23 +38,20 @@
 #define VCD_PARSER_HPP
 
 // include from STL
-#include <list>
 #include <stack>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "custom_map.hpp"
 #include "custom_set.hpp"
 
 // include from parser/vcd/
-#include "sig_variation.hpp"
+#include "vcd_signal_trace.hpp"
 
 // include from utility/
 #include "refcount.hpp"
 
-// forward declarations
-CONSTREF_FORWARD_DECL(Parameter);
-
 class vcd_sig_info
 {
  public:
@@ -87,9 +84,9 @@ class vcd_parser
  public:
    /**
     * constructor
-    * @param [in] params: is the class holding bambu parameters
+    * @param [in] debug_level: is the debug level of the parser
     */
-   explicit vcd_parser(const ParameterConstRef& params);
+   explicit vcd_parser(int debug_level);
 
    /**
     * this is the type used to select which signals have to be filtered during
@@ -104,9 +101,9 @@ class vcd_parser
     * this type is the result of a parse.
     * the primary key is the scope.
     * the secondary key is the name of the signal.
-    * the value type is std::list of sig_variation representing the waveform
+    * the value type is the compact trace of the variations representing the waveform
     */
-   using vcd_trace_t = UnorderedMapStd<std::string, CustomUnorderedMapStable<std::string, std::list<sig_variation>>>;
+   using vcd_trace_t = UnorderedMapStd<std::string, CustomUnorderedMapStable<std::string, vcd_signal_trace>>;
 
    /**
     * parses a file selecting only a predefined set of signals.
@@ -164,6 +161,25 @@ class vcd_parser
     */
    std::map<std::string, CustomUnorderedSet<std::pair<std::string, std::string>>> vcd_id_to_scope_and_name;
 
+   /**
+    * a selected signal which is updated by the variations of a vcd id
+    */
+   struct vcd_id_target
+   {
+      /// the trace of the signal
+      vcd_signal_trace* trace;
+      /// true if the vcd id represents a single bit of the signal
+      bool single_bit;
+      /// the bit represented by the vcd id, valid only if single_bit == true
+      size_t bit;
+   };
+
+   /**
+    * maps every selected vcd id to the traces it updates, built once at the beginning of the simulation part so that
+    * every value change costs a single lookup
+    */
+   CustomUnorderedMap<std::string, std::vector<vcd_id_target>> vcd_id_to_targets;
+
    /* Parses the simulation part in the vcd_file */
    int vcd_parse_sim();
 
@@ -180,12 +196,6 @@ class vcd_parser
 
    void vcd_pop_def_scope(std::stack<std::string>& scope);
 
-   /* Parses vector in simulation part */
-   int vcd_parse_sim_vector(char* value, unsigned long timestamp);
-
-   /* Parses real in sumlation part (actually unused)*/
-   int vcd_parse_sim_real(char* value, unsigned long timestamp);
-
    /**
     * Checks if a signal is to be monitored
     * @return: true if the signal has to be monitored, false if not.
@@ -0,0 +1,278 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file vcd_signal_trace.cpp
+ * @brief Compact storage for the waveform of a single vcd signal
+ */
+#include "vcd_signal_trace.hpp"
+
+#include "exceptions.hpp"
+#include "string_manipulation.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+/// character corresponding to each 2-bit code
+static const char code_to_char[] = {'0', '1', 'x', 'z'};
+
+/**
+ * @return the 2-bit code of a 4-state value character, or -1 if c is not a 4-state value
+ */
+static int char_to_code(const char c)
+{
+   switch(c)
+   {
+      case '0':
+         return 0;
+      case '1':
+         return 1;
+      case 'x':
+      case 'X':
+         return 2;
+      case 'z':
+      case 'Z':
+         return 3;
+      default:
+         return -1;
+   }
+}
+
+vcd_signal_trace::vcd_signal_trace(size_t _width) : width(_width), count(0), last_time_stamp(0)
+{
+   THROW_ASSERT(width, "vcd signal with no bits");
+}
+
+const sig_variation& vcd_signal_trace::const_iterator::operator*() const
+{
+   THROW_ASSERT(trace && index < trace->count, "dereferencing an invalid vcd trace iterator");
+   if(!decoded)
+   {
+      auto next = offset;
+      current.time_stamp = base + read_delta(trace->deltas, next);
+      current.duration = (index + 1) < trace->count ? read_delta(trace->deltas, next) :
+                                                      std::numeric_limits<decltype(current.duration)>::max();
+      current.value = trace->decode_value(index);
+      decoded = true;
+   }
+   return current;
+}
+
+vcd_signal_trace::const_iterator& vcd_signal_trace::const_iterator::operator++()
+{
+   THROW_ASSERT(trace && index < trace->count, "incrementing an invalid vcd trace iterator");
+   base += read_delta(trace->deltas, offset);
+   ++index;
+   decoded = false;
+   return *this;
+}
+
+vcd_signal_trace::const_iterator& vcd_signal_trace::const_iterator::operator--()
+{
+   THROW_ASSERT(trace && index > 0, "decrementing an invalid vcd trace iterator");
+   /* only the last byte of a LEB128 sequence has the most significant bit cleared */
+   auto start = offset - 1;
+   while(start > 0 && (trace->deltas[start - 1] & 0x80))
+   {
+      --start;
+   }
+   offset = start;
+   base -= read_delta(trace->deltas, start);
+   --index;
+   decoded = false;
+   return *this;
+}
+
+unsigned long long vcd_signal_trace::read_delta(const std::vector<uint8_t>& buffer, size_t& offset)
+{
+   unsigned long long delta = 0;
+   unsigned shift = 0;
+   uint8_t byte;
+   do
+   {
+      THROW_ASSERT(offset < buffer.size(), "truncated vcd time stamp");
+      byte = buffer[offset++];
+      delta |= static_cast<unsigned long long>(byte & 0x7F) << shift;
+      shift += 7;
+   } while(byte & 0x80);
+   return delta;
+}
+
+void vcd_signal_trace::append(unsigned long long ts)
+{
+   THROW_ASSERT(ts >= last_time_stamp, "Variations are not being added in time order: ts = " + STR(last_time_stamp) +
+                                           " > " + STR(ts));
+   auto delta = ts - last_time_stamp;
+   while(delta >= 0x80)
+   {
+      deltas.push_back(static_cast<uint8_t>(delta | 0x80));
+      delta >>= 7;
+   }
+   deltas.push_back(static_cast<uint8_t>(delta));
+   last_time_stamp = ts;
+   ++count;
+   codes.resize((count * width * 2 + 63) / 64, 0);
+}
+
+unsigned vcd_signal_trace::get_code(size_t index, size_t pos) const
+{
+   const auto bit = (index * width + pos) * 2;
+   return static_cast<unsigned>(codes[bit / 64] >> (bit % 64)) & 3U;
+}
+
+void vcd_signal_trace::set_code(size_t index, size_t pos, unsigned code)
+{
+   const auto bit = (index * width + pos) * 2;
+   auto& word = codes[bit / 64];
+   word = (word & ~(uint64_t(3) << (bit % 64))) | (uint64_t(code) << (bit % 64));
+}
+
+const char* vcd_signal_trace::find_literal(size_t index) const
+{
+   if(literals.empty() || literals.back().first < index)
+   {
+      return nullptr;
+   }
+   const auto lit_it = std::lower_bound(
+       literals.begin(), literals.end(), index,
+       [](const std::pair<size_t, size_t>& literal, const size_t i) { return literal.first < i; });
+   return lit_it->first == index ? literal_values.c_str() + lit_it->second : nullptr;
+}
+
+void vcd_signal_trace::set_back_literal(const std::string& value)
+{
+   /* the literal of the last variation is always at the end of literal_values */
+   erase_back_literal();
+   literals.emplace_back(count - 1, literal_values.size());
+   literal_values.append(value);
+   literal_values.push_back('\0');
+}
+
+void vcd_signal_trace::erase_back_literal()
+{
+   if(!literals.empty() && literals.back().first == count - 1)
+   {
+      literal_values.resize(literals.back().second);
+      literals.pop_back();
+   }
+}
+
+std::string vcd_signal_trace::decode_value(size_t index) const
+{
+   const auto literal = find_literal(index);
+   if(literal)
+   {
+      return literal;
+   }
+   std::string value(width, '0');
+   for(size_t pos = 0; pos < width; ++pos)
+   {
+      value[pos] = code_to_char[get_code(index, pos)];
+   }
+   return value;
+}
+
+void vcd_signal_trace::set_value(unsigned long long ts, const std::string& value)
+{
+   if(!count || ts != last_time_stamp)
+   {
+      append(ts);
+   }
+   const auto index = count - 1;
+   if(value.size() == width &&
+      std::all_of(value.begin(), value.end(), [](const char c) { return char_to_code(c) >= 0; }))
+   {
+      erase_back_literal();
+      for(size_t pos = 0; pos < width; ++pos)
+      {
+         set_code(index, pos, static_cast<unsigned>(char_to_code(value[pos])));
+      }
+   }
+   else
+   {
+      set_back_literal(value);
+   }
+}
+
+void vcd_signal_trace::set_bit(unsigned long long ts, size_t bit, char value)
+{
+   THROW_ASSERT(count, "setting a bit of a vcd signal with no initial value");
+   if(ts != last_time_stamp)
+   {
+      const auto prev = count - 1;
+      const auto prev_literal = find_literal(prev);
+      append(ts);
+      if(prev_literal)
+      {
+         set_back_literal(prev_literal);
+      }
+      else
+      {
+         for(size_t pos = 0; pos < width; ++pos)
+         {
+            set_code(prev + 1, pos, get_code(prev, pos));
+         }
+      }
+   }
+   const auto index = count - 1;
+   const auto code = char_to_code(value);
+   if(code < 0 && !find_literal(index))
+   {
+      set_back_literal(decode_value(index));
+   }
+   if(find_literal(index))
+   {
+      const auto size = literal_values.size() - literals.back().second - 1;
+      THROW_ASSERT(bit < size, "bit " + STR(bit) + " is out of the range of value " + decode_value(index));
+      literal_values[literals.back().second + size - bit - 1] = value;
+   }
+   else
+   {
+      THROW_ASSERT(bit < width, "bit " + STR(bit) + " is out of the range of a " + STR(width) + "-bit signal");
+      set_code(index, width - bit - 1, static_cast<unsigned>(code));
+   }
+}
+
+void vcd_signal_trace::shrink_to_fit()
+{
+   deltas.shrink_to_fit();
+   codes.shrink_to_fit();
+   literals.shrink_to_fit();
+   literal_values.shrink_to_fit();
+}
+
+size_t vcd_signal_trace::memory_usage() const
+{
+   return sizeof(*this) + deltas.capacity() + codes.capacity() * sizeof(uint64_t) +
+          literals.capacity() * sizeof(literals.front()) + literal_values.capacity();
+}
@@ -0,0 +1,258 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file vcd_signal_trace.hpp
+ * @brief Compact storage for the waveform of a single vcd signal
+ *
+ * Values are packed with two bits per 4-state bit, time stamps are stored as
+ * LEB128-encoded deltas. Variations are decoded on the fly into sig_variation
+ * objects while iterating.
+ */
+#ifndef VCD_SIGNAL_TRACE_HPP
+#define VCD_SIGNAL_TRACE_HPP
+
+#include "sig_variation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+class vcd_signal_trace
+{
+ public:
+   /**
+    * Bidirectional read-only iterator over the variations of the trace.
+    * Dereferencing returns a reference to a sig_variation decoded inside the iterator, which stays valid until the
+    * iterator is moved or destroyed.
+    */
+   class const_iterator
+   {
+    public:
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type = sig_variation;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const sig_variation*;
+      using reference = const sig_variation&;
+
+      const_iterator() : trace(nullptr), index(0), offset(0), base(0), decoded(false)
+      {
+      }
+
+      reference operator*() const;
+
+      pointer operator->() const
+      {
+         return &operator*();
+      }
+
+      const_iterator& operator++();
+
+      const_iterator operator++(int)
+      {
+         auto ret = *this;
+         ++(*this);
+         return ret;
+      }
+
+      const_iterator& operator--();
+
+      const_iterator operator--(int)
+      {
+         auto ret = *this;
+         --(*this);
+         return ret;
+      }
+
+      bool operator==(const const_iterator& other) const
+      {
+         return index == other.index && trace == other.trace;
+      }
+
+      bool operator!=(const const_iterator& other) const
+      {
+         return !(*this == other);
+      }
+
+    private:
+      friend class vcd_signal_trace;
+
+      const_iterator(const vcd_signal_trace* _trace, size_t _index, size_t _offset, unsigned long long _base)
+          : trace(_trace), index(_index), offset(_offset), base(_base), decoded(false)
+      {
+      }
+
+      const vcd_signal_trace* trace;
+
+      /// index of the current variation
+      size_t index;
+
+      /// offset in vcd_signal_trace::deltas of the encoded time stamp of the current variation
+      size_t offset;
+
+      /// time stamp of the previous variation, 0 for the first one
+      unsigned long long base;
+
+      mutable bool decoded;
+      mutable sig_variation current;
+   };
+
+   /**
+    * Constructor
+    * @param width is the number of bits of every value of the signal
+    */
+   explicit vcd_signal_trace(size_t width = 1);
+
+   size_t size() const
+   {
+      return count;
+   }
+
+   bool empty() const
+   {
+      return count == 0;
+   }
+
+   size_t bit_width() const
+   {
+      return width;
+   }
+
+   const_iterator begin() const
+   {
+      return const_iterator(this, 0, 0, 0);
+   }
+
+   const_iterator end() const
+   {
+      return const_iterator(this, count, deltas.size(), last_time_stamp);
+   }
+
+   const_iterator cbegin() const
+   {
+      return begin();
+   }
+
+   const_iterator cend() const
+   {
+      return end();
+   }
+
+   /**
+    * @return the time stamp of the last variation
+    */
+   unsigned long long back_time_stamp() const
+   {
+      return last_time_stamp;
+   }
+
+   /**
+    * Sets the value of the signal starting from time stamp ts. If the last variation has the same time stamp its
+    * value is overwritten, otherwise a new variation is appended.
+    * @param ts is the time stamp, it must not be lower than the one of the last variation
+    * @param value is the new value; it is stored packed when it is made of width 4-state characters
+    */
+   void set_value(unsigned long long ts, const std::string& value);
+
+   /**
+    * Sets a single bit of the signal starting from time stamp ts, keeping the other bits of the last variation
+    * @param ts is the time stamp, it must not be lower than the one of the last variation
+    * @param bit is the bit position, 0 being the least significant bit
+    * @param value is the new value of the bit
+    */
+   void set_bit(unsigned long long ts, size_t bit, char value);
+
+   /**
+    * Releases the memory reserved for appending further variations
+    */
+   void shrink_to_fit();
+
+   /**
+    * @return the number of bytes used to store the trace
+    */
+   size_t memory_usage() const;
+
+ private:
+   /// number of 4-state bits of every value
+   const size_t width;
+
+   /// number of variations
+   size_t count;
+
+   /// time stamp of the last variation
+   unsigned long long last_time_stamp;
+
+   /// LEB128 encoding of the differences between the time stamps of consecutive variations
+   std::vector<uint8_t> deltas;
+
+   /// 2-bit codes of the values, width codes for each variation, the first code being the most significant bit
+   std::vector<uint64_t> codes;
+
+   /**
+    * variations whose value cannot be represented as width 4-state bits (e.g. real values), sorted by index, with the
+    * offset of their null-terminated value in literal_values
+    */
+   std::vector<std::pair<size_t, size_t>> literals;
+
+   /// values of the literal variations
+   std::string literal_values;
+
+   void append(unsigned long long ts);
+
+   unsigned get_code(size_t index, size_t pos) const;
+
+   void set_code(size_t index, size_t pos, unsigned code);
+
+   std::string decode_value(size_t index) const;
+
+   /**
+    * @return the value of the variation at index if it is a literal, nullptr otherwise
+    */
+   const char* find_literal(size_t index) const;
+
+   /**
+    * Sets the value of the last variation as a literal
+    */
+   void set_back_literal(const std::string& value);
+
+   /**
+    * Removes the literal value of the last variation, if any
+    */
+   void erase_back_literal();
+
+   static unsigned long long read_delta(const std::vector<uint8_t>& buffer, size_t& offset);
+};
+
+#endif
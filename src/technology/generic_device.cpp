@@ -210,7 +210,14 @@ void generic_device::load_devices()
 
       for(const auto& parser : parsers)
       {
-         parser->Exec();
+         if(Param->isOption(OPT_technology_cache))
+         {
+            parser->Exec(Param->getOption<std::filesystem::path>(OPT_technology_cache));
+         }
+         else
+         {
+            parser->Exec();
+         }
          if(parser and *parser)
          {
             const xml_element* node = parser->get_document()->get_root_node(); // deleted by DomParser.
@@ -56,7 +56,14 @@ void read_technology_File(const std::string& fn, const technology_managerRef& TM
    try
    {
       XMLDomParser parser(fn);
-      parser.Exec();
+      if(Param->isOption(OPT_technology_cache))
+      {
+         parser.Exec(Param->getOption<std::filesystem::path>(OPT_technology_cache));
+      }
+      else
+      {
+         parser.Exec();
+      }
       if(parser)
       {
          // Walk the tree:
@@ -131,6 +131,9 @@ class tree_manager
    /// Next version number for ssa variables
    unsigned int next_vers;
 
+   /// compiler and plugin version information read from the raw file
+   std::string ir_info;
+
    /**
     * check for decl_node and return true if not suitable for symbol table or otherwise its symbol_name and
     * symbol_scope.
@@ -198,6 +201,24 @@ class tree_manager
     */
    void add_reserve(size_t additional_reserved_nodes);
 
+   /**
+    * @brief Set the compiler and plugin version information read from the raw file
+    *
+    * @param info is the version information in the format of the raw file header
+    */
+   void SetIRInfo(const std::string& info)
+   {
+      ir_info = info;
+   }
+
+   /**
+    * @return the compiler and plugin version information read from the raw file
+    */
+   const std::string& GetIRInfo() const
+   {
+      return ir_info;
+   }
+
    /**
     * @brief Replace all tree reindex occurrences with the pointed tree node
     *
@@ -49,46 +49,133 @@ using namespace boost::multiprecision;
 
 using bw_t = APInt::bw_t;
 
+/// Number of value bits of the inline representation (sign excluded)
+#define INLINE_DIGITS 127
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wzero-as-null-pointer-constant"
-APInt::APInt() : _data(57)
+APInt::APInt() : _val(57)
 {
 }
 #pragma GCC diagnostic pop
 
+APInt::APInt(const APInt& other) : _val(other._val), _big(other._big ? new number(*other._big) : nullptr)
+{
+}
+
+APInt& APInt::operator=(const APInt& other)
+{
+   if(this != &other)
+   {
+      _val = other._val;
+      if(!other._big)
+      {
+         _big.reset();
+      }
+      else if(_big)
+      {
+         *_big = *other._big;
+      }
+      else
+      {
+         _big.reset(new number(*other._big));
+      }
+   }
+   return *this;
+}
+
+APInt::number APInt::to_number() const
+{
+   if(_big)
+   {
+      return *_big;
+   }
+   const auto neg = _val < 0;
+   const auto mag = neg ? -static_cast<uinline_t>(_val) : static_cast<uinline_t>(_val);
+   number n(static_cast<uint64_t>(mag >> 64));
+   n <<= 64;
+   n |= static_cast<uint64_t>(mag);
+   return neg ? number(-n) : n;
+}
+
+void APInt::assign(const number& n)
+{
+   const auto& be = n.backend();
+   if(be.size() * backend::limb_bits <= 128)
+   {
+      uinline_t mag = 0;
+      for(unsigned i = 0; i < be.size(); ++i)
+      {
+         mag |= static_cast<uinline_t>(be.limbs()[i]) << (i * backend::limb_bits);
+      }
+      const auto limit = static_cast<uinline_t>(1) << INLINE_DIGITS;
+      if(be.sign() ? mag <= limit : mag < limit)
+      {
+         _val = static_cast<inline_t>(be.sign() ? -mag : mag);
+         _big.reset();
+         return;
+      }
+   }
+   if(_big)
+   {
+      *_big = n;
+   }
+   else
+   {
+      _big.reset(new number(n));
+   }
+}
+
 bool operator<(const APInt& lhs, const APInt& rhs)
 {
-   return lhs._data < rhs._data;
+   if(!lhs._big && !rhs._big)
+   {
+      return lhs._val < rhs._val;
+   }
+   /// a spilled value lies outside the inline range
+   if(!rhs._big)
+   {
+      return lhs._big->sign() < 0;
+   }
+   if(!lhs._big)
+   {
+      return rhs._big->sign() > 0;
+   }
+   return *lhs._big < *rhs._big;
 }
 
 bool operator>(const APInt& lhs, const APInt& rhs)
 {
-   return lhs._data > rhs._data;
+   return rhs < lhs;
 }
 
 bool operator<=(const APInt& lhs, const APInt& rhs)
 {
-   return lhs._data <= rhs._data;
+   return !(rhs < lhs);
 }
 
 bool operator>=(const APInt& lhs, const APInt& rhs)
 {
-   return lhs._data >= rhs._data;
+   return !(lhs < rhs);
 }
 
 bool operator==(const APInt& lhs, const APInt& rhs)
 {
-   return lhs._data == rhs._data;
+   if(!lhs._big && !rhs._big)
+   {
+      return lhs._val == rhs._val;
+   }
+   return lhs._big && rhs._big && *lhs._big == *rhs._big;
 }
 
 bool operator!=(const APInt& lhs, const APInt& rhs)
 {
-   return lhs._data != rhs._data;
+   return !(lhs == rhs);
 }
 
 APInt::operator bool() const
 {
-   return _data != 0;
+   return _big || _val != 0;
 }
 
 /*
@@ -146,61 +233,128 @@ APInt operator>>(const APInt& lhs, const APInt& rhs)
 
 APInt& APInt::operator+=(const APInt& rhs)
 {
-   _data += rhs._data;
+   inline_t res;
+   if(!_big && !rhs._big && !__builtin_add_overflow(_val, rhs._val, &res))
+   {
+      _val = res;
+      return *this;
+   }
+   assign(to_number() + rhs.to_number());
    return *this;
 }
 
 APInt& APInt::operator-=(const APInt& rhs)
 {
-   _data -= rhs._data;
+   inline_t res;
+   if(!_big && !rhs._big && !__builtin_sub_overflow(_val, rhs._val, &res))
+   {
+      _val = res;
+      return *this;
+   }
+   assign(to_number() - rhs.to_number());
    return *this;
 }
 
 APInt& APInt::operator*=(const APInt& rhs)
 {
-   _data *= rhs._data;
+   inline_t res;
+   if(!_big && !rhs._big && !__builtin_mul_overflow(_val, rhs._val, &res))
+   {
+      _val = res;
+      return *this;
+   }
+   assign(to_number() * rhs.to_number());
    return *this;
 }
 
 APInt& APInt::operator/=(const APInt& rhs)
 {
-   _data /= rhs._data;
+   /// division by zero and the only overflowing quotient are left to the backend
+   if(!_big && !rhs._big && rhs._val != 0 && !(rhs._val == -1 && _val == inline_min))
+   {
+      _val /= rhs._val;
+      return *this;
+   }
+   assign(to_number() / rhs.to_number());
    return *this;
 }
 
 APInt& APInt::operator%=(const APInt& rhs)
 {
-   _data %= rhs._data;
+   if(!_big && !rhs._big && rhs._val != 0)
+   {
+      _val = rhs._val == -1 ? 0 : _val % rhs._val;
+      return *this;
+   }
+   assign(to_number() % rhs.to_number());
    return *this;
 }
 
 APInt& APInt::operator&=(const APInt& rhs)
 {
-   _data &= rhs._data;
+   if(!_big && !rhs._big)
+   {
+      _val &= rhs._val;
+      return *this;
+   }
+   assign(to_number() & rhs.to_number());
    return *this;
 }
 
 APInt& APInt::operator|=(const APInt& rhs)
 {
-   _data |= rhs._data;
+   if(!_big && !rhs._big)
+   {
+      _val |= rhs._val;
+      return *this;
+   }
+   assign(to_number() | rhs.to_number());
    return *this;
 }
 
 APInt& APInt::operator^=(const APInt& rhs)
 {
-   _data ^= rhs._data;
+   if(!_big && !rhs._big)
+   {
+      _val ^= rhs._val;
+      return *this;
+   }
+   assign(to_number() ^ rhs.to_number());
    return *this;
 }
 
 APInt& APInt::operator<<=(const APInt& rhs)
 {
-   _data <<= static_cast<bw_t>(rhs._data);
+   const auto shift = static_cast<bw_t>(rhs);
+   if(!_big)
+   {
+      if(_val == 0)
+      {
+         return *this;
+      }
+      if(shift < INLINE_DIGITS)
+      {
+         const auto res = static_cast<inline_t>(static_cast<uinline_t>(_val) << shift);
+         if((res >> shift) == _val)
+         {
+            _val = res;
+            return *this;
+         }
+      }
+   }
+   assign(to_number() << shift);
    return *this;
 }
 
 APInt& APInt::operator>>=(const APInt& rhs)
 {
-   _data >>= static_cast<bw_t>(rhs._data);
+   const auto shift = static_cast<bw_t>(rhs);
+   if(!_big)
+   {
+      _val = shift <= INLINE_DIGITS ? (_val >> shift) : (_val < 0 ? -1 : 0);
+      return *this;
+   }
+   assign(*_big >> shift);
    return *this;
 }
 
@@ -209,36 +363,48 @@ APInt& APInt::operator>>=(const APInt& rhs)
  */
 APInt APInt::abs() const
 {
-   APInt abs;
-   abs._data = boost::multiprecision::abs(_data);
-   return abs;
+   if(!_big && _val != inline_min)
+   {
+      APInt abs;
+      abs._val = _val < 0 ? -_val : _val;
+      return abs;
+   }
+   return APInt(boost::multiprecision::abs(to_number()));
 }
 
 APInt APInt::operator-() const
 {
-   APInt neg;
-   neg._data = -_data;
-   return neg;
+   if(!_big && _val != inline_min)
+   {
+      APInt neg;
+      neg._val = -_val;
+      return neg;
+   }
+   return APInt(number(-to_number()));
 }
 
 APInt APInt::operator~() const
 {
-   APInt _not;
-   _not._data = ~_data;
-   return _not;
+   if(!_big)
+   {
+      APInt _not;
+      _not._val = ~_val;
+      return _not;
+   }
+   return APInt(number(~*_big));
 }
 
 APInt APInt::operator++(int)
 {
    APInt t = *this;
-   ++_data;
+   operator+=(1LL);
    return t;
 }
 
 APInt APInt::operator--(int)
 {
    APInt t = *this;
-   --_data;
+   operator-=(1LL);
    return t;
 }
 
@@ -254,22 +420,42 @@ APInt& APInt::operator--()
 
 void APInt::bit_set(bw_t i)
 {
-   _data |= 0x1_apint << i;
+   if(!_big && (i < INLINE_DIGITS || _val < 0))
+   {
+      if(i < INLINE_DIGITS)
+      {
+         _val |= static_cast<inline_t>(1) << i;
+      }
+      return;
+   }
+   assign(to_number() | (0x1_apint << i));
 }
 
 void APInt::bit_clr(bw_t i)
 {
-   _data &= ~(0x1_apint << i);
+   if(!_big && (i < INLINE_DIGITS || _val >= 0))
+   {
+      if(i < INLINE_DIGITS)
+      {
+         _val &= ~(static_cast<inline_t>(1) << i);
+      }
+      return;
+   }
+   assign(to_number() & ~(0x1_apint << i));
 }
 
 bool APInt::bit_tst(bw_t i) const
 {
-   return ((_data >> i) & 1) != 0;
+   if(!_big)
+   {
+      return ((_val >> (i < INLINE_DIGITS ? i : INLINE_DIGITS)) & 1) != 0;
+   }
+   return ((*_big >> i) & 1) != 0;
 }
 
 bool APInt::sign() const
 {
-   return _data < 0;
+   return _big ? _big->sign() < 0 : _val < 0;
 }
 
 #ifdef __clang__
@@ -285,25 +471,31 @@ bool APInt::sign() const
 APInt& APInt::extOrTrunc(bw_t bw, bool sign)
 {
    THROW_ASSERT(bw, "Minimum bitwidth of 1 is required");
+   if(bw <= INLINE_DIGITS)
+   {
+      const auto mask = (static_cast<uinline_t>(1) << bw) - 1;
+      const auto low = _big ? static_cast<uinline_t>(*_big & mask) : static_cast<uinline_t>(_val) & mask;
+      _val = static_cast<inline_t>(low);
+      _big.reset();
+      if(sign && bit_tst(bw - 1U))
+      {
+         _val -= static_cast<inline_t>(1) << bw;
+      }
+      return *this;
+   }
    const number mask = (0x1_apint << bw) - 1;
-   _data &= mask;
-   if(sign && bit_tst(bw - 1U))
+   number val = to_number() & mask;
+   if(sign && bit_test(val, bw - 1U))
    {
-      _data += (-0x1_apint << bw);
+      val += (-0x1_apint << bw);
    }
+   assign(val);
    return *this;
 }
 
 APInt APInt::extOrTrunc(bw_t bw, bool sign) const
 {
-   THROW_ASSERT(bw, "Minimum bitwidth of 1 is required");
-   const number mask = (0x1_apint << bw) - 1;
-   APInt val(_data & mask);
-   if(sign && val.bit_tst(bw - 1U))
-   {
-      val += (-0x1_apint << bw);
-   }
-   return APInt(val);
+   return APInt(*this).extOrTrunc(bw, sign);
 }
 
 bw_t APInt::trailingZeros(bw_t bw) const
@@ -334,29 +526,37 @@ bw_t APInt::trailingOnes(bw_t bw) const
 
 bw_t APInt::leadingZeros(bw_t bw) const
 {
-   if(_data < 0)
+   if(sign())
    {
       return 0;
    }
-   if(_data == 0)
+   if(!_big)
    {
-      return bw;
+      if(_val == 0)
+      {
+         return bw;
+      }
+      const auto high = static_cast<uint64_t>(static_cast<uinline_t>(_val) >> 64);
+      const bw_t significant =
+          high ? 128 - __builtin_clzll(high) : 64 - __builtin_clzll(static_cast<uint64_t>(_val));
+      THROW_ASSERT(significant <= bw, "unexpected condition");
+      return bw - significant;
    }
-   THROW_ASSERT(_data.backend().size() > 0, "unexpected condition");
-   const auto limbs = _data.backend().limbs();
+   const auto& data = *_big;
+   const auto limbs = data.backend().limbs();
    auto nchunks = bw / backend::limb_bits + ((bw % backend::limb_bits) ? 1 : 0);
-   THROW_ASSERT(_data.backend().size() <= nchunks, "unexpected condition");
+   THROW_ASSERT(data.backend().size() <= nchunks, "unexpected condition");
    bw_t lzc = 0;
    bw_t offset = 0;
-   if(_data.backend().size() < nchunks)
+   if(data.backend().size() < nchunks)
    {
-      lzc += bw - _data.backend().size() * backend::limb_bits;
+      lzc += bw - data.backend().size() * backend::limb_bits;
    }
    else
    {
       offset += (bw % backend::limb_bits) ? backend::limb_bits - (bw % backend::limb_bits) : 0;
    }
-   for(int i = _data.backend().size() - 1; i >= 0; --i)
+   for(int i = data.backend().size() - 1; i >= 0; --i)
    {
       const auto& val = limbs[i];
       if(val != 0)
@@ -394,16 +594,15 @@ bw_t APInt::leadingOnes(bw_t bw) const
 
 APInt::bw_t APInt::minBitwidth(bool sign) const
 {
-   if(_data.backend().isneg())
+   if(this->sign())
    {
       if(!sign)
       {
          return std::numeric_limits<number>::digits;
       }
-      return std::numeric_limits<number>::digits + 1 -
-             APInt(-_data - 1).leadingZeros(std::numeric_limits<number>::digits);
+      return std::numeric_limits<number>::digits + 1 - (~*this).leadingZeros(std::numeric_limits<number>::digits);
    }
-   else if(_data.is_zero())
+   else if(!*this)
    {
       return 1U;
    }
@@ -438,12 +637,14 @@ APInt APInt::getSignedMinValue(bw_t bw)
 
 std::ostream& operator<<(std::ostream& str, const APInt& v)
 {
-   str << v._data;
+   str << v.to_number();
    return str;
 }
 
 std::istream& operator>>(std::istream& str, APInt& v)
 {
-   str >> v._data;
+   APInt::number n;
+   str >> n;
+   v.assign(n);
    return str;
 }
@@ -44,12 +44,19 @@
 #define APINT_HPP
 
 #include <iostream>
+#include <memory>
 #include <string>
 #include <type_traits>
 
 #include <boost/multiprecision/cpp_int.hpp>
 #include <boost/multiprecision/cpp_int/literals.hpp>
 
+/**
+ * Arbitrary precision integer
+ * Values fitting in 128 bits are stored inline and computed with native arithmetic; the multiprecision backend is
+ * allocated only when a result does not fit. The representation is kept canonical: a value is spilled if and only if it
+ * cannot be stored inline.
+ */
 class APInt
 {
  public:
@@ -59,24 +66,63 @@ class APInt
    using bw_t = uint16_t;
 
  private:
-   number _data;
+   __extension__ typedef __int128 inline_t;
+   __extension__ typedef unsigned __int128 uinline_t;
+
+   /// The only inline value whose negation overflows
+   static constexpr inline_t inline_min = static_cast<inline_t>(static_cast<uinline_t>(1) << 127);
+
+   /// The value when it fits in 128 bits
+   inline_t _val;
+
+   /// The value when it does not fit in 128 bits, nullptr otherwise
+   std::unique_ptr<number> _big;
+
+   /**
+    * Return the value as multiprecision number
+    */
+   number to_number() const;
+
+   /**
+    * Store a multiprecision number, moving it inline if it fits
+    * @param n is the value to be stored
+    */
+   void assign(const number& n);
 
  public:
    APInt();
 
+   APInt(const APInt& other);
+
+   APInt(APInt&& other) noexcept = default;
+
+   APInt& operator=(const APInt& other);
+
+   APInt& operator=(APInt&& other) noexcept = default;
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wzero-as-null-pointer-constant"
    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-   APInt(T val) : _data(val)
+   APInt(T val) : _val(0)
    {
+      if constexpr(std::is_floating_point<T>::value)
+      {
+         assign(number(val));
+      }
+      else
+      {
+         _val = static_cast<inline_t>(val);
+      }
    }
 
-   APInt(const number& v) : _data(v)
+   APInt(const number& v) : _val(0)
    {
+      assign(v);
    }
 
-   APInt(const std::string& str) : _data(boost::lexical_cast<number>(str))
+   APInt(const std::string& str) : _val(0)
    {
+      assign(boost::lexical_cast<number>(str));
    }
 #pragma GCC diagnostic pop
 
@@ -142,7 +188,11 @@ class APInt
    explicit operator T() const
    {
       using U = typename std::make_unsigned<T>::type;
-      return static_cast<T>(static_cast<U>(_data & std::numeric_limits<U>::max()));
+      if(!_big)
+      {
+         return static_cast<T>(static_cast<U>(_val));
+      }
+      return static_cast<T>(static_cast<U>(*_big & std::numeric_limits<U>::max()));
    }
 
    static APInt getMaxValue(bw_t bw);
@@ -361,10 +361,10 @@ bw_t Range::neededBits(const APInt& a, const APInt& b, bool sign)
    return std::max(a.minBitwidth(sign), b.minBitwidth(sign));
 }
 
-RangeRef Range::fromBitValues(const std::deque<bit_lattice>& bv, bw_t bitwidth, bool isSigned)
+RangeRef Range::fromBitValues(const bitstring& bv, bw_t bitwidth, bool isSigned)
 {
    THROW_ASSERT(bv.size() <= bitwidth, "BitValues size not appropriate");
-   auto bitstring_to_int = [&](const std::deque<bit_lattice>& bv_in) {
+   auto bitstring_to_int = [&](const bitstring& bv_in) {
       long long out = isSigned && bv_in.front() == bit_lattice::ONE ? std::numeric_limits<long long>::min() : 0LL;
       auto bv_it = bv_in.crbegin();
       const auto bv_end = bv_in.crend();
@@ -381,7 +381,7 @@ RangeRef Range::fromBitValues(const std::deque<bit_lattice>& bv, bw_t bitwidth,
       }
       return out;
    };
-   auto manip = [&](const std::deque<bit_lattice>& bv_in) {
+   auto manip = [&](const bitstring& bv_in) {
       if(bv_in.size() < bitwidth)
       {
          return APInt(bitstring_to_int(sign_extend_bitstring(bv_in, isSigned, bitwidth)))
@@ -390,7 +390,7 @@ RangeRef Range::fromBitValues(const std::deque<bit_lattice>& bv, bw_t bitwidth,
       return APInt(bitstring_to_int(bv_in)).extOrTrunc(bitwidth, isSigned);
    };
    const auto max = [&]() {
-      std::deque<bit_lattice> bv_out;
+      bitstring bv_out;
       bv_out.push_back((bv.front() == bit_lattice::U || bv.front() == bit_lattice::X) ?
                            (isSigned ? bit_lattice::ZERO : bit_lattice::ONE) :
                            bv.front());
@@ -401,7 +401,7 @@ RangeRef Range::fromBitValues(const std::deque<bit_lattice>& bv, bw_t bitwidth,
       return manip(bv_out);
    }();
    const auto min = [&]() {
-      std::deque<bit_lattice> bv_out;
+      bitstring bv_out;
       bv_out.push_back((bv.front() == bit_lattice::U || bv.front() == bit_lattice::X) ?
                            (isSigned ? bit_lattice::ONE : bit_lattice::ZERO) :
                            bv.front());
@@ -416,7 +416,7 @@ RangeRef Range::fromBitValues(const std::deque<bit_lattice>& bv, bw_t bitwidth,
    return RangeRef(new Range(Regular, bitwidth, min, max));
 }
 
-std::deque<bit_lattice> Range::getBitValues(bool isSigned) const
+bitstring Range::getBitValues(bool isSigned) const
 {
    if(isEmpty() || isAnti() || isUnknown())
    {
@@ -436,7 +436,7 @@ std::deque<bit_lattice> Range::getBitValues(bool isSigned) const
       shorter = sign_extend_bitstring(shorter, isSigned, longer.size());
    }
 
-   std::deque<bit_lattice> range_bv;
+   bitstring range_bv;
    auto s_it = shorter.cbegin();
    auto l_it = longer.cbegin();
    const auto s_end = shorter.cend();
@@ -41,19 +41,194 @@
 
 #include "exceptions.hpp"
 
-std::deque<bit_lattice> create_u_bitstring(size_t lenght)
+#include <algorithm>
+#include <utility>
+
+bitstring::bitstring(size_t n, bit_lattice v)
+    : _words(2 * ((n + 63) / 64), 0), _off(0), _size(static_cast<uint32_t>(n))
+{
+   const auto code = static_cast<unsigned>(v);
+   for(size_t w = 0; w < _words.size(); w += 2)
+   {
+      _words[w] = (code & 1) ? ~UINT64_C(0) : 0;
+      _words[w + 1] = (code & 2) ? ~UINT64_C(0) : 0;
+   }
+}
+
+bitstring::bitstring(std::initializer_list<bit_lattice> il) : _off(0), _size(0)
+{
+   for(const auto v : il)
+   {
+      push_back(v);
+   }
+}
+
+uint64_t bitstring::word(unsigned plane, size_t s) const
+{
+   const auto p = _off + s;
+   const auto w = p / 64;
+   const auto b = p % 64;
+   auto res = _words[2 * w + plane] >> b;
+   if(b && 2 * (w + 1) < _words.size())
+   {
+      res |= _words[2 * (w + 1) + plane] << (64 - b);
+   }
+   return res;
+}
+
+template <typename Op>
+bitstring& bitstring::combine(const bitstring& other, Op op)
+{
+   THROW_ASSERT(_size == other._size,
+                "bitstrings of different size: " + std::to_string(_size) + " != " + std::to_string(other._size));
+   std::vector<uint64_t> res(2 * ((_size + 63) / 64));
+   for(size_t k = 0; k < res.size(); k += 2)
+   {
+      res[k] = op(word(0, 32 * k), other.word(0, 32 * k));
+      res[k + 1] = op(word(1, 32 * k), other.word(1, 32 * k));
+   }
+   _words = std::move(res);
+   _off = 0;
+   return *this;
+}
+
+bitstring& bitstring::operator|=(const bitstring& other)
+{
+   return combine(other, [](uint64_t a, uint64_t b) { return a | b; });
+}
+
+bitstring& bitstring::operator&=(const bitstring& other)
+{
+   return combine(other, [](uint64_t a, uint64_t b) { return a & b; });
+}
+
+void bitstring::push_back(bit_lattice v)
+{
+   if(_off == 0)
+   {
+      /// the free space is grown geometrically, so that the words are shifted only a logarithmic number of times
+      const auto pairs = std::max<size_t>(1, _words.size() / 2);
+      _words.insert(_words.begin(), 2 * pairs, 0);
+      _off = static_cast<uint32_t>(64 * pairs);
+   }
+   --_off;
+   ++_size;
+   put(0, v);
+}
+
+void bitstring::pop_back()
+{
+   /// the released bit is kept as free space for the next push_back
+   ++_off;
+   --_size;
+}
+
+bitstring::const_iterator bitstring::insert(const_iterator pos, size_t n, bit_lattice v)
+{
+   const auto idx = pos - begin();
+   if(idx == 0)
+   {
+      while(n--)
+      {
+         push_front(v);
+      }
+      return begin();
+   }
+   const std::vector<bit_lattice> tail(pos, end());
+   while(_size > static_cast<size_t>(idx))
+   {
+      pop_back();
+   }
+   while(n--)
+   {
+      push_back(v);
+   }
+   for(const auto t : tail)
+   {
+      push_back(t);
+   }
+   return begin() + idx;
+}
+
+bitstring::const_iterator bitstring::insert(const_iterator pos, const_iterator first, const_iterator last)
+{
+   const auto idx = pos - begin();
+   const std::vector<bit_lattice> values(first, last);
+   const std::vector<bit_lattice> tail(pos, end());
+   while(_size > static_cast<size_t>(idx))
+   {
+      pop_back();
+   }
+   for(const auto t : values)
+   {
+      push_back(t);
+   }
+   for(const auto t : tail)
+   {
+      push_back(t);
+   }
+   return begin() + idx;
+}
+
+bitstring::const_iterator bitstring::erase(const_iterator first, const_iterator last)
+{
+   const auto idx = first - begin();
+   const std::vector<bit_lattice> tail(last, end());
+   while(_size > static_cast<size_t>(idx))
+   {
+      pop_back();
+   }
+   for(const auto t : tail)
+   {
+      push_back(t);
+   }
+   return begin() + idx;
+}
+
+bool bitstring::is_constant() const
+{
+   for(size_t s = 0; s < _size; s += 64)
+   {
+      const auto mask = (_size - s) >= 64 ? ~UINT64_C(0) : ((UINT64_C(1) << (_size - s)) - 1);
+      /// exactly one of may be zero and may be one must be set
+      if(((word(0, s) ^ word(1, s)) & mask) != mask)
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+bool bitstring::operator==(const bitstring& other) const
+{
+   if(_size != other._size)
+   {
+      return false;
+   }
+   for(size_t s = 0; s < _size; s += 64)
+   {
+      const auto mask = (_size - s) >= 64 ? ~UINT64_C(0) : ((UINT64_C(1) << (_size - s)) - 1);
+      if(((word(0, s) ^ other.word(0, s)) & mask) || ((word(1, s) ^ other.word(1, s)) & mask))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+bitstring create_u_bitstring(size_t lenght)
 {
-   return std::deque<bit_lattice>(lenght, bit_lattice::U);
+   return bitstring(lenght, bit_lattice::U);
 }
 
-std::deque<bit_lattice> create_x_bitstring(size_t lenght)
+bitstring create_x_bitstring(size_t lenght)
 {
-   return std::deque<bit_lattice>(lenght, bit_lattice::X);
+   return bitstring(lenght, bit_lattice::X);
 }
 
-std::deque<bit_lattice> create_bitstring_from_constant(integer_cst_t value, unsigned long long len, bool signed_value)
+bitstring create_bitstring_from_constant(integer_cst_t value, unsigned long long len, bool signed_value)
 {
-   std::deque<bit_lattice> res;
+   bitstring res;
    if(value == 0)
    {
       res.push_front(bit_lattice::ZERO);
@@ -71,10 +246,11 @@ std::deque<bit_lattice> create_bitstring_from_constant(integer_cst_t value, unsi
    return res;
 }
 
-std::string bitstring_to_string(const std::deque<bit_lattice>& bitstring)
+std::string bitstring_to_string(const bitstring& bits)
 {
    std::string res;
-   for(const auto bit : bitstring)
+   res.reserve(bits.size());
+   for(const auto bit : bits)
    {
       switch(bit)
       {
@@ -98,9 +274,9 @@ std::string bitstring_to_string(const std::deque<bit_lattice>& bitstring)
    return res;
 }
 
-std::deque<bit_lattice> string_to_bitstring(const std::string& s)
+bitstring string_to_bitstring(const std::string& s)
 {
-   std::deque<bit_lattice> res;
+   bitstring res;
    for(const auto bit : s)
    {
       switch(bit)
@@ -125,18 +301,9 @@ std::deque<bit_lattice> string_to_bitstring(const std::string& s)
    return res;
 }
 
-bool bitstring_constant(const std::deque<bit_lattice>& a)
+bool bitstring_constant(const bitstring& a)
 {
-   bool res = true;
-   for(const auto i : a)
-   {
-      if(i == bit_lattice::U || i == bit_lattice::X)
-      {
-         res = false;
-         break;
-      }
-   }
-   return res;
+   return a.is_constant();
 }
 
 bit_lattice bit_sup(const bit_lattice a, const bit_lattice b)
@@ -163,22 +330,22 @@ bit_lattice bit_sup(const bit_lattice a, const bit_lattice b)
    }
 }
 
-std::deque<bit_lattice> sup(const std::deque<bit_lattice>& _a, const std::deque<bit_lattice>& _b,
-                            const size_t out_type_size, const bool out_is_signed, const bool out_is_bool)
+bitstring sup(const bitstring& _a, const bitstring& _b, const size_t out_type_size, const bool out_is_signed,
+              const bool out_is_bool)
 {
    THROW_ASSERT(!_a.empty() && !_b.empty(), "a = " + std::string(_a.empty() ? "empty" : bitstring_to_string(_a)) +
                                                 ", b = " + (_b.empty() ? "empty" : bitstring_to_string(_b)));
    THROW_ASSERT(out_type_size, "Size can not be zero");
    THROW_ASSERT(!out_is_bool || (out_type_size == 1), "boolean with type size != 1");
-   std::deque<bit_lattice> res;
+   bitstring res;
    if(out_is_bool)
    {
       res.push_back(bit_sup(_a.back(), _b.back()));
       return res;
    }
 
-   std::deque<bit_lattice> longer = (_a.size() >= _b.size()) ? _a : _b;
-   std::deque<bit_lattice> shorter = (_a.size() >= _b.size()) ? _b : _a;
+   bitstring longer = (_a.size() >= _b.size()) ? _a : _b;
+   bitstring shorter = (_a.size() >= _b.size()) ? _b : _a;
    while(longer.size() > out_type_size)
    {
       longer.pop_front();
@@ -222,14 +389,8 @@ std::deque<bit_lattice> sup(const std::deque<bit_lattice>& _a, const std::deque<
    //       }
    //    }
 
-   auto a_it = longer.crbegin();
-   auto b_it = shorter.crbegin();
-   const auto a_end = longer.crend();
-   const auto b_end = shorter.crend();
-   for(; a_it != a_end && b_it != b_end; a_it++, b_it++)
-   {
-      res.push_front(bit_sup(*a_it, *b_it));
-   }
+   res = longer;
+   res |= shorter;
 
    if(res.empty())
    {
@@ -303,42 +464,36 @@ bit_lattice bit_inf(const bit_lattice a, const bit_lattice b)
    }
 }
 
-std::deque<bit_lattice> inf(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                            const size_t out_type_size, const bool out_is_signed, const bool out_is_bool)
+bitstring inf(const bitstring& a, const bitstring& b, const size_t out_type_size, const bool out_is_signed,
+              const bool out_is_bool)
 {
    THROW_ASSERT(!(a.empty() && b.empty()),
                 "a.size() = " + std::to_string(a.size()) + " b.size() = " + std::to_string(b.size()));
    THROW_ASSERT(out_type_size, "");
    THROW_ASSERT(!out_is_bool || (out_type_size == 1), "boolean with type size != 1");
-   std::deque<bit_lattice> res;
+   bitstring res;
    if(out_is_bool)
    {
       res.push_back(bit_inf(a.back(), b.back()));
       return res;
    }
 
-   std::deque<bit_lattice> a_copy = a;
-   std::deque<bit_lattice> b_copy = b;
+   bitstring a_copy = a;
+   bitstring b_copy = b;
    sign_reduce_bitstring(a_copy, out_is_signed);
    sign_reduce_bitstring(b_copy, out_is_signed);
 
    // a_tmp is the longer bistring
-   std::deque<bit_lattice> a_tmp = (a_copy.size() >= b_copy.size()) ? a_copy : b_copy;
-   std::deque<bit_lattice> b_tmp = (a_copy.size() >= b_copy.size()) ? b_copy : a_copy;
+   bitstring a_tmp = (a_copy.size() >= b_copy.size()) ? a_copy : b_copy;
+   bitstring b_tmp = (a_copy.size() >= b_copy.size()) ? b_copy : a_copy;
 
    if(a_tmp.size() > b_tmp.size())
    {
       b_tmp = sign_extend_bitstring(b_tmp, out_is_signed, a_tmp.size());
    }
 
-   auto a_it = a_tmp.crbegin();
-   auto b_it = b_tmp.crbegin();
-   const auto a_end = a_tmp.crend();
-   const auto b_end = b_tmp.crend();
-   for(; a_it != a_end && b_it != b_end; a_it++, b_it++)
-   {
-      res.push_front(bit_inf(*a_it, *b_it));
-   }
+   res = a_tmp;
+   res &= b_tmp;
 
    if(res.empty())
    {
@@ -355,16 +510,16 @@ std::deque<bit_lattice> inf(const std::deque<bit_lattice>& a, const std::deque<b
 }
 
 /// function slightly different than tree_helper.cpp: sign_reduce_bitstring
-void sign_reduce_bitstring(std::deque<bit_lattice>& bitstring, bool bitstring_is_signed)
+void sign_reduce_bitstring(bitstring& bits, bool bitstring_is_signed)
 {
-   THROW_ASSERT(!bitstring.empty(), "");
-   while(bitstring.size() > 1)
+   THROW_ASSERT(!bits.empty(), "");
+   while(bits.size() > 1)
    {
       if(bitstring_is_signed)
       {
-         if(bitstring.at(0) != bit_lattice::U && bitstring.at(0) == bitstring.at(1))
+         if(bits.at(0) != bit_lattice::U && bits.at(0) == bits.at(1))
          {
-            bitstring.pop_front();
+            bits.pop_front();
          }
          else
          {
@@ -373,16 +528,16 @@ void sign_reduce_bitstring(std::deque<bit_lattice>& bitstring, bool bitstring_is
       }
       else
       {
-         if((bitstring.at(0) == bit_lattice::X && bitstring.at(1) == bit_lattice::X) ||
-            (bitstring.at(0) == bit_lattice::ZERO && bitstring.at(1) != bit_lattice::X))
+         if((bits.at(0) == bit_lattice::X && bits.at(1) == bit_lattice::X) ||
+            (bits.at(0) == bit_lattice::ZERO && bits.at(1) != bit_lattice::X))
          {
-            bitstring.pop_front();
+            bits.pop_front();
          }
-         else if(bitstring.at(0) == bit_lattice::ZERO && bitstring.at(1) == bit_lattice::X)
+         else if(bits.at(0) == bit_lattice::ZERO && bits.at(1) == bit_lattice::X)
          {
-            bitstring.pop_front();
-            bitstring.pop_front();
-            bitstring.push_front(bit_lattice::ZERO);
+            bits.pop_front();
+            bits.pop_front();
+            bits.push_front(bit_lattice::ZERO);
          }
          else
          {
@@ -392,12 +547,11 @@ void sign_reduce_bitstring(std::deque<bit_lattice>& bitstring, bool bitstring_is
    }
 }
 
-std::deque<bit_lattice> sign_extend_bitstring(const std::deque<bit_lattice>& bitstring, bool bitstring_is_signed,
-                                              size_t final_size)
+bitstring sign_extend_bitstring(const bitstring& bits, bool bitstring_is_signed, size_t final_size)
 {
    THROW_ASSERT(final_size, "cannot sign extend a bitstring to final_size 0");
-   THROW_ASSERT(final_size > bitstring.size(), "useless sign extension");
-   std::deque<bit_lattice> res = bitstring;
+   THROW_ASSERT(final_size > bits.size(), "useless sign extension");
+   bitstring res = bits;
    if(res.empty())
    {
       res.push_front(bit_lattice::X);
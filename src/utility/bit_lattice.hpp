@@ -42,9 +42,17 @@
 #define _BIT_LATTICE_HPP
 #include "panda_types.hpp"
 
-#include <deque>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
+/**
+ * Values of a bit in the bit-value lattice; the numeric value of each element is its encoding in bitstring, with bit
+ * 0 set when the bit may be zero and bit 1 set when the bit may be one
+ */
 enum class bit_lattice
 {
    U,
@@ -53,19 +61,376 @@ enum class bit_lattice
    X
 };
 
+/**
+ * Sequence of bit_lattice values, most significant bit first, with the same interface as std::deque<bit_lattice>.
+ * Bits are packed in two bitplanes (may be zero, may be one) so that sup and inf of two bitstrings reduce to bitwise OR
+ * and AND of 64-bit words. Storage keeps free space below the least significant bit, which is doubled whenever it is
+ * exhausted, so that both push_front and push_back are amortized constant time.
+ */
+class bitstring
+{
+ public:
+   using value_type = bit_lattice;
+   using size_type = size_t;
+   using difference_type = std::ptrdiff_t;
+   using reference = bit_lattice;
+   using const_reference = bit_lattice;
+
+   class const_iterator
+   {
+    private:
+      const bitstring* _bs;
+
+      std::ptrdiff_t _i;
+
+    public:
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type = bit_lattice;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const bit_lattice*;
+      using reference = bit_lattice;
+
+      const_iterator() : _bs(nullptr), _i(0)
+      {
+      }
+
+      const_iterator(const bitstring* bs, std::ptrdiff_t i) : _bs(bs), _i(i)
+      {
+      }
+
+      bit_lattice operator*() const
+      {
+         return _bs->get(_bs->_size - 1 - static_cast<size_t>(_i));
+      }
+
+      bit_lattice operator[](difference_type n) const
+      {
+         return *(*this + n);
+      }
+
+      const_iterator& operator++()
+      {
+         ++_i;
+         return *this;
+      }
+
+      const_iterator operator++(int)
+      {
+         return const_iterator(_bs, _i++);
+      }
+
+      const_iterator& operator--()
+      {
+         --_i;
+         return *this;
+      }
+
+      const_iterator operator--(int)
+      {
+         return const_iterator(_bs, _i--);
+      }
+
+      const_iterator& operator+=(difference_type n)
+      {
+         _i += n;
+         return *this;
+      }
+
+      const_iterator& operator-=(difference_type n)
+      {
+         _i -= n;
+         return *this;
+      }
+
+      const_iterator operator+(difference_type n) const
+      {
+         return const_iterator(_bs, _i + n);
+      }
+
+      friend const_iterator operator+(difference_type n, const const_iterator& it)
+      {
+         return it + n;
+      }
+
+      const_iterator operator-(difference_type n) const
+      {
+         return const_iterator(_bs, _i - n);
+      }
+
+      difference_type operator-(const const_iterator& other) const
+      {
+         return _i - other._i;
+      }
+
+      bool operator==(const const_iterator& other) const
+      {
+         return _i == other._i;
+      }
+
+      bool operator!=(const const_iterator& other) const
+      {
+         return _i != other._i;
+      }
+
+      bool operator<(const const_iterator& other) const
+      {
+         return _i < other._i;
+      }
+
+      bool operator>(const const_iterator& other) const
+      {
+         return _i > other._i;
+      }
+
+      bool operator<=(const const_iterator& other) const
+      {
+         return _i <= other._i;
+      }
+
+      bool operator>=(const const_iterator& other) const
+      {
+         return _i >= other._i;
+      }
+   };
+   using iterator = const_iterator;
+   using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+   using reverse_iterator = const_reverse_iterator;
+
+ private:
+   /// Bitplane words, interleaved: word 2*k holds the may be zero plane, word 2*k+1 the may be one plane
+   std::vector<uint64_t> _words;
+
+   /// Storage position of the least significant bit
+   uint32_t _off;
+
+   /// Number of bits
+   uint32_t _size;
+
+   /**
+    * Return the bit of given significance (0 is the least significant one)
+    */
+   bit_lattice get(size_t s) const
+   {
+      const auto p = _off + s;
+      const auto w = 2 * (p / 64);
+      const auto b = p % 64;
+      return static_cast<bit_lattice>(((_words[w] >> b) & 1) | (((_words[w + 1] >> b) & 1) << 1));
+   }
+
+   /**
+    * Set the bit of given significance (0 is the least significant one)
+    */
+   void put(size_t s, bit_lattice v)
+   {
+      const auto p = _off + s;
+      const auto w = 2 * (p / 64);
+      const auto mask = UINT64_C(1) << (p % 64);
+      const auto code = static_cast<unsigned>(v);
+      _words[w] = (code & 1) ? (_words[w] | mask) : (_words[w] & ~mask);
+      _words[w + 1] = (code & 2) ? (_words[w + 1] | mask) : (_words[w + 1] & ~mask);
+   }
+
+   /**
+    * Return 64 bits of a bitplane starting from the given significance; bits beyond the size are unspecified
+    * @param plane is 0 for the may be zero plane, 1 for the may be one plane
+    * @param s is the significance of the first bit
+    */
+   uint64_t word(unsigned plane, size_t s) const;
+
+   /**
+    * Apply a bitwise operation to the bitplanes of two bitstrings of equal size, least significant bits aligned
+    */
+   template <typename Op>
+   bitstring& combine(const bitstring& other, Op op);
+
+ public:
+   bitstring() : _off(0), _size(0)
+   {
+   }
+
+   bitstring(size_t n, bit_lattice v);
+
+   bitstring(std::initializer_list<bit_lattice> il);
+
+   template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+   bitstring(InputIt first, InputIt last) : _off(0), _size(0)
+   {
+      for(; first != last; ++first)
+      {
+         push_back(*first);
+      }
+   }
+
+   size_t size() const
+   {
+      return _size;
+   }
+
+   bool empty() const
+   {
+      return _size == 0;
+   }
+
+   void clear()
+   {
+      _words.clear();
+      _off = 0;
+      _size = 0;
+   }
+
+   bit_lattice operator[](size_t i) const
+   {
+      return get(_size - 1 - i);
+   }
+
+   bit_lattice at(size_t i) const
+   {
+      if(i >= _size)
+      {
+         throw std::out_of_range("bitstring::at");
+      }
+      return get(_size - 1 - i);
+   }
+
+   /**
+    * Set the i-th bit, counting from the most significant one
+    */
+   void set(size_t i, bit_lattice v)
+   {
+      put(_size - 1 - i, v);
+   }
+
+   bit_lattice front() const
+   {
+      return get(_size - 1);
+   }
+
+   bit_lattice back() const
+   {
+      return get(0);
+   }
+
+   void push_front(bit_lattice v)
+   {
+      if(_off + _size == 32 * _words.size())
+      {
+         _words.push_back(0);
+         _words.push_back(0);
+      }
+      put(_size++, v);
+   }
+
+   void push_back(bit_lattice v);
+
+   void emplace_back(bit_lattice v)
+   {
+      push_back(v);
+   }
+
+   void emplace_front(bit_lattice v)
+   {
+      push_front(v);
+   }
+
+   void pop_front()
+   {
+      --_size;
+   }
+
+   void pop_back();
+
+   const_iterator insert(const_iterator pos, bit_lattice v)
+   {
+      return insert(pos, 1, v);
+   }
+
+   const_iterator insert(const_iterator pos, size_t n, bit_lattice v);
+
+   const_iterator insert(const_iterator pos, const_iterator first, const_iterator last);
+
+   const_iterator erase(const_iterator pos)
+   {
+      return erase(pos, pos + 1);
+   }
+
+   const_iterator erase(const_iterator first, const_iterator last);
+
+   const_iterator begin() const
+   {
+      return const_iterator(this, 0);
+   }
+
+   const_iterator end() const
+   {
+      return const_iterator(this, static_cast<difference_type>(_size));
+   }
+
+   const_iterator cbegin() const
+   {
+      return begin();
+   }
+
+   const_iterator cend() const
+   {
+      return end();
+   }
+
+   const_reverse_iterator rbegin() const
+   {
+      return const_reverse_iterator(end());
+   }
+
+   const_reverse_iterator rend() const
+   {
+      return const_reverse_iterator(begin());
+   }
+
+   const_reverse_iterator crbegin() const
+   {
+      return rbegin();
+   }
+
+   const_reverse_iterator crend() const
+   {
+      return rend();
+   }
+
+   /**
+    * Element-wise sup with a bitstring of the same size
+    */
+   bitstring& operator|=(const bitstring& other);
+
+   /**
+    * Element-wise inf with a bitstring of the same size
+    */
+   bitstring& operator&=(const bitstring& other);
+
+   /**
+    * Return true if the bitstring contains no U and no X values
+    */
+   bool is_constant() const;
+
+   bool operator==(const bitstring& other) const;
+
+   bool operator!=(const bitstring& other) const
+   {
+      return !(*this == other);
+   }
+};
+
 /**
  * Creates a bitstring containing bits initialized at <U>
  * @param lenght the lenght of the bitstring
  * @return a bitstring of the specified length containing <U> values.
  */
-std::deque<bit_lattice> create_u_bitstring(size_t lenght);
+bitstring create_u_bitstring(size_t lenght);
 
 /**
  * Create a bitstring containing bits initialized at <X>
  * @param lenght the lenght of the bitstring
  * @return a bitstring of the specified length containing <X> values.
  */
-std::deque<bit_lattice> create_x_bitstring(size_t lenght);
+bitstring create_x_bitstring(size_t lenght);
 
 /**
  * Creates a bitstring from a constant input
@@ -74,54 +439,52 @@ std::deque<bit_lattice> create_x_bitstring(size_t lenght);
  * @param signed_value specified if this bitstring can have negative values
  * @return bitstring generated from the integer constant
  */
-std::deque<bit_lattice> create_bitstring_from_constant(integer_cst_t value_int, unsigned long long length,
-                                                       bool signed_value);
+bitstring create_bitstring_from_constant(integer_cst_t value_int, unsigned long long length, bool signed_value);
 
 /**
- * Translates a bitstring ( expressed as an std::deque of bit_lattice ) into a string of characters.
+ * Translates a bitstring into a string of characters.
  */
-std::string bitstring_to_string(const std::deque<bit_lattice>& bitstring);
+std::string bitstring_to_string(const bitstring& bits);
 
 /**
  * inverse of bitstring_to_string
  */
-std::deque<bit_lattice> string_to_bitstring(const std::string& s);
+bitstring string_to_bitstring(const std::string& s);
 
 /**
  * Checks if a bitstring is constant
  * @param a the bitstring to be checked
  * @return TRUE if the bitstring contains only 1, 0 or X but not U values
  */
-bool bitstring_constant(const std::deque<bit_lattice>& a);
+bool bitstring_constant(const bitstring& a);
 
 /**
  * Extends a bitstring
- * @param bitstring to extend
+ * @param bits is the bitstring to extend
  * @param bitstring_is_signed must be true if bitstring is signed
  * @param final_size desired length of the bitstrign
  * @return the extended bitstring
  */
-std::deque<bit_lattice> sign_extend_bitstring(const std::deque<bit_lattice>& bitstring, bool bitstring_is_signed,
-                                              size_t final_size);
+bitstring sign_extend_bitstring(const bitstring& bits, bool bitstring_is_signed, size_t final_size);
 
 /**
  * @brief Reduce the size of a bitstring
  * 	erasing all but one most significant zeros in unsigned bitstring and all
  * 	but one most significant values in signed bitstrings.
- * 	@param bitstring bitstring to reduce.
+ * 	@param bits bitstring to reduce.
  * 	@param bitstring_is_signed must be true if bitstring is signed
  */
-void sign_reduce_bitstring(std::deque<bit_lattice>& bitstring, bool bitstring_is_signed);
+void sign_reduce_bitstring(bitstring& bits, bool bitstring_is_signed);
 
 bit_lattice bit_sup(const bit_lattice a, const bit_lattice b);
 
 bit_lattice bit_inf(const bit_lattice a, const bit_lattice b);
 
-std::deque<bit_lattice> sup(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                            const size_t out_type_size, const bool out_is_signed, const bool out_is_bool);
+bitstring sup(const bitstring& a, const bitstring& b, const size_t out_type_size, const bool out_is_signed,
+              const bool out_is_bool);
 
-std::deque<bit_lattice> inf(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                            const size_t out_type_size, const bool out_is_signed, const bool out_is_bool);
+bitstring inf(const bitstring& a, const bitstring& b, const size_t out_type_size, const bool out_is_signed,
+              const bool out_is_bool);
 
 bool isBetter(const std::string& a_string, const std::string& b_string);
 
@@ -77,6 +77,31 @@ std::string PrintVirtualDataMemoryUsage()
 #endif
 }
 
+long GetPeakResidentMemory()
+{
+#ifdef _WIN32
+   PROCESS_MEMORY_COUNTERS pmc;
+   if(GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+   {
+      return (long)(pmc.PeakWorkingSetSize / 1024);
+   }
+   return 0;
+#else
+   struct rusage rusage
+   {
+   };
+   if(getrusage(RUSAGE_SELF, &rusage))
+   {
+      return 0;
+   }
+#if defined(__APPLE__)
+   return rusage.ru_maxrss / 1024;
+#else
+   return rusage.ru_maxrss;
+#endif
+#endif
+}
+
 void util_print_cpu_stats(std::ostream& os)
 {
 #ifdef _WIN32
@@ -55,7 +55,9 @@
 #undef IN
 #undef OUT
 #else
+#include <sys/resource.h>
 #include <sys/times.h>
+#include <time.h>
 #endif
 
 #include "dbgPrintHelper.hpp"
@@ -135,6 +137,47 @@ void inline dump_exec_time(const std::string& thing, long et)
 /// Macro used to store the elapsed time into time_var
 #define STOP_TIME(time_var) time_var = p_cpu_time() - (time_var)
 
+/**
+ * return a long which represents the user processor time in milliseconds consumed by the calling thread since some
+ * constant reference; it is the measure of p_cpu_time restricted to a single thread, so that it can be used by tasks
+ * running concurrently with other threads of the same process
+ */
+inline long int p_thread_cpu_time()
+{
+#ifdef _WIN32
+   FILETIME creationTime, exitTime, kernelTime, userTime;
+   if(GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+   {
+      ULARGE_INTEGER integerTime;
+      integerTime.u.LowPart = userTime.dwLowDateTime;
+      integerTime.u.HighPart = userTime.dwHighDateTime;
+      return (long)(integerTime.QuadPart / 10000);
+   }
+   else
+      return 0;
+#elif defined(RUSAGE_THREAD)
+   struct rusage usage;
+   if(getrusage(RUSAGE_THREAD, &usage))
+   {
+      return 0;
+   }
+   return long(usage.ru_utime.tv_sec) * 1000 + long(usage.ru_utime.tv_usec) / 1000;
+#else
+   struct timespec now;
+   if(clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now))
+   {
+      return 0;
+   }
+   return long(now.tv_sec) * 1000 + long(now.tv_nsec) / 1000000;
+#endif
+}
+
+/// Macro used to store the start time of the calling thread into time_var
+#define START_TTIME(time_var) time_var = p_thread_cpu_time()
+
+/// Macro used to store the elapsed time of the calling thread into time_var
+#define STOP_TTIME(time_var) time_var = p_thread_cpu_time() - (time_var)
+
 /**
  * return a long which represents the elapsed wall processor
  * time in milliseconds since some constant reference
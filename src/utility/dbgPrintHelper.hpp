@@ -91,12 +91,12 @@
 
 //@}
 
-extern size_t indentation;
+extern thread_local size_t indentation;
 
-extern std::ostream null_stream;
+extern thread_local std::ostream null_stream;
 
 /// This is the message to be printed
-extern std::string panda_message;
+extern thread_local std::string panda_message;
 
 // If we are producing a release, then no debug message will be printed at all,
 // independently of the debug level chosen: all the debug instructions are evicted
@@ -48,9 +48,13 @@
 #include "file_IO_constants.hpp"
 #include "string_manipulation.hpp"
 
+#include <absl/numeric/int128.h>
+#include <atomic>
 #include <cstdlib>
+#include <iomanip>
 #include <random>
 #include <regex>
+#include <sstream>
 
 fileIO_istreamRef fileIO_istream_open(const std::string& name)
 {
@@ -79,7 +83,7 @@ int PandaSystem(const ParameterConstRef Param, const std::string& system_command
                 const std::filesystem::path& output, const unsigned int type, const bool background,
                 const size_t timeout)
 {
-   static size_t counter = 0;
+   static std::atomic<size_t> counter(0);
    const auto run_index = counter++;
    const auto script_path = Param->getOption<std::filesystem::path>(OPT_output_temporary_directory) /
                             (STR_CST_file_IO_shell_script "_" + STR(run_index));
@@ -235,11 +239,55 @@ bool NaturalVersionOrder(const std::filesystem::path& _x, const std::filesystem:
    return _x < _y;
 }
 
+std::string ContentDigest(const std::string& data)
+{
+   const auto fnv_prime = absl::MakeUint128(0x0000000001000000ULL, 0x000000000000013BULL);
+   auto hash = absl::MakeUint128(0x6c62272e07bb0142ULL, 0x62b821756295c58dULL);
+   for(const auto c : data)
+   {
+      hash ^= static_cast<unsigned char>(c);
+      hash *= fnv_prime;
+   }
+   std::stringstream ss;
+   ss << std::hex << std::setfill('0') << std::setw(16) << absl::Uint128High64(hash) << std::setw(16)
+      << absl::Uint128Low64(hash);
+   return ss.str();
+}
+
+bool StoreCacheEntry(const std::filesystem::path& entry,
+                     const std::function<void(const std::filesystem::path&)>& write_entry)
+{
+   std::error_code ec;
+   /// the first writer wins: a concurrent run may be reading the files of an existing entry
+   if(std::filesystem::exists(entry, ec))
+   {
+      return true;
+   }
+   std::filesystem::create_directories(entry.parent_path(), ec);
+   const auto staging = unique_path(entry.string() + ".%%%%%%");
+   try
+   {
+      write_entry(staging);
+   }
+   catch(...)
+   {
+      std::filesystem::remove_all(staging, ec);
+      throw;
+   }
+   std::filesystem::rename(staging, entry, ec);
+   if(ec)
+   {
+      /// the rename fails when another run has stored the entry in the meantime
+      std::filesystem::remove_all(staging, ec);
+      return std::filesystem::exists(entry, ec);
+   }
+   return true;
+}
+
 template <typename T>
 void array_rand(T* arr, size_t size)
 {
-   static std::random_device rd;
-   static std::mt19937_64 gen(rd());
+   static thread_local std::mt19937_64 gen(std::random_device{}());
    uint64_t rnd = 0;
    size_t i;
 
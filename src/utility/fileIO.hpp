@@ -49,6 +49,7 @@
 #include "refcount.hpp"
 
 #include <filesystem>
+#include <functional>
 #include <iostream>
 #include <string>
 
@@ -196,4 +197,22 @@ bool NaturalVersionOrder(const std::filesystem::path& _x, const std::filesystem:
 
 std::filesystem::path unique_path(const std::filesystem::path& model);
 
+/**
+ * Compute the 128-bit FNV-1a digest of a buffer, used to name the entries of the on-disk caches
+ * @param data is the buffer
+ * @return the digest as a hexadecimal string of 32 characters
+ */
+std::string ContentDigest(const std::string& data);
+
+/**
+ * Store an entry of an on-disk cache shared among concurrent runs: the entry is written in a private path next to it
+ * and then renamed, so that readers never observe a partially written entry. An existing entry is never replaced or
+ * removed, since a concurrent run may be reading it: the first writer wins and the new entry is discarded.
+ * @param entry is the file or the directory of the entry; its parent directory is created if needed
+ * @param write_entry writes the entry at the private path passed as argument
+ * @return true if the entry has been stored or already exists
+ */
+bool StoreCacheEntry(const std::filesystem::path& entry,
+                     const std::function<void(const std::filesystem::path&)>& write_entry);
+
 #endif
@@ -0,0 +1,182 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file memory_image.cpp
+ * @brief Byte oriented image of an initialized memory.
+ *
+ */
+#include "memory_image.hpp"
+
+#include "exceptions.hpp"
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+
+memory_image::memory_image() : bit_size(0)
+{
+}
+
+void memory_image::append(unsigned long long value, unsigned long long bitsize)
+{
+   THROW_ASSERT(bitsize <= 64, "at most 64 bits can be appended at once: " + std::to_string(bitsize));
+   if(bitsize < 64)
+   {
+      value &= (1ULL << bitsize) - 1;
+   }
+   if(bit_size % 8 == 0 && bitsize % 8 == 0)
+   {
+      for(; bitsize; bitsize -= 8, bit_size += 8, value >>= 8)
+      {
+         bytes.push_back(static_cast<unsigned char>(value & 0xFF));
+      }
+      return;
+   }
+   while(bitsize)
+   {
+      const auto offset = bit_size % 8;
+      if(offset == 0)
+      {
+         bytes.push_back(0);
+      }
+      const auto n_bits = std::min(bitsize, 8 - offset);
+      bytes.back() = static_cast<unsigned char>(bytes.back() | ((value & ((1ULL << n_bits) - 1)) << offset));
+      value >>= n_bits;
+      bitsize -= n_bits;
+      bit_size += n_bits;
+   }
+}
+
+void memory_image::append(const integer_cst_t& value, unsigned long long bitsize)
+{
+   for(unsigned long long offset = 0; offset < bitsize; offset += 64)
+   {
+      append(static_cast<unsigned long long>(value >> offset), std::min(bitsize - offset, 64ULL));
+   }
+}
+
+void memory_image::append_zeros(unsigned long long bitsize)
+{
+   bit_size += bitsize;
+   bytes.resize((bit_size + 7) / 8, 0);
+}
+
+void memory_image::append_binary(const std::string& binary)
+{
+   /// consume the string from its least significant end, 64 bits at a time
+   auto end = binary.size();
+   while(end)
+   {
+      const auto begin = end > 64 ? end - 64 : 0;
+      unsigned long long value = 0;
+      for(auto i = begin; i < end; ++i)
+      {
+         THROW_ASSERT(binary.at(i) == '0' || binary.at(i) == '1', "unexpected binary string: " + binary);
+         value = (value << 1) | (binary.at(i) == '1' ? 1ULL : 0ULL);
+      }
+      append(value, end - begin);
+      end = begin;
+   }
+}
+
+void memory_image::align(unsigned long long word_bytes)
+{
+   THROW_ASSERT(word_bytes, "");
+   const auto n_bytes = (bit_size + 7) / 8;
+   extend(n_bytes % word_bytes ? n_bytes + word_bytes - n_bytes % word_bytes : n_bytes);
+}
+
+void memory_image::extend(unsigned long long n_bytes)
+{
+   bit_size = std::max((bit_size + 7) / 8, n_bytes) * 8;
+   bytes.resize(bit_size / 8, 0);
+}
+
+void memory_image::write_binary(std::ostream& out_a, std::ostream* out_b, unsigned long long word_bytes) const
+{
+   THROW_ASSERT(word_bytes, "");
+   static const auto byte_strings = []() {
+      std::array<std::string, 256> res;
+      for(auto b = 0U; b < 256; ++b)
+      {
+         for(auto bit = 8U; bit > 0; --bit)
+         {
+            res[b].push_back(((b >> (bit - 1)) & 1) ? '1' : '0');
+         }
+      }
+      return res;
+   }();
+   std::string line;
+   bool is_even = true;
+   for(size_t begin = 0; begin < bytes.size(); begin += word_bytes)
+   {
+      const auto end = std::min(bytes.size(), static_cast<size_t>(begin + word_bytes));
+      line.clear();
+      for(auto i = end; i > begin; --i)
+      {
+         line += byte_strings[bytes[i - 1]];
+      }
+      line.push_back('\n');
+      (is_even || !out_b ? out_a : *out_b) << line;
+      is_even = !is_even;
+   }
+   /// the two halves of a split memory always hold the same number of words
+   if(!is_even && out_b)
+   {
+      *out_b << std::string(word_bytes * 8, '0') << '\n';
+   }
+}
+
+void memory_image::write_hex(std::ostream& out, unsigned long long word_bytes) const
+{
+   THROW_ASSERT(word_bytes, "");
+   static const char hex_digits[] = "0123456789abcdef";
+   std::string line;
+   for(size_t begin = 0; begin < bytes.size(); begin += word_bytes)
+   {
+      const auto end = std::min(bytes.size(), static_cast<size_t>(begin + word_bytes));
+      line.clear();
+      for(auto i = end; i > begin; --i)
+      {
+         line.push_back(hex_digits[bytes[i - 1] >> 4]);
+         line.push_back(hex_digits[bytes[i - 1] & 0xF]);
+      }
+      line.push_back('\n');
+      out << line;
+   }
+}
+
+void memory_image::write_raw(std::ostream& out) const
+{
+   out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
@@ -0,0 +1,140 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file memory_image.hpp
+ * @brief Byte oriented image of an initialized memory.
+ *
+ * Values are appended as a little-endian bitstream: the first bit appended is bit 0 of byte 0.
+ *
+ */
+#ifndef MEMORY_IMAGE_HPP
+#define MEMORY_IMAGE_HPP
+
+#include "panda_types.hpp"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+class memory_image
+{
+ private:
+   /// The content of the memory; bits past bit_size in the last byte are always zero
+   std::vector<unsigned char> bytes;
+
+   /// Number of bits appended so far
+   unsigned long long bit_size;
+
+ public:
+   /**
+    * Constructor
+    */
+   memory_image();
+
+   /**
+    * Append the lowest bits of a value
+    * @param value is the value to be appended
+    * @param bitsize is the number of bits to be appended (at most 64)
+    */
+   void append(unsigned long long value, unsigned long long bitsize);
+
+   /**
+    * Append the lowest bits of an arbitrary precision value
+    * @param value is the value to be appended (negative values are written in two's complement)
+    * @param bitsize is the number of bits to be appended
+    */
+   void append(const integer_cst_t& value, unsigned long long bitsize);
+
+   /**
+    * Append a sequence of zero bits
+    * @param bitsize is the number of bits to be appended
+    */
+   void append_zeros(unsigned long long bitsize);
+
+   /**
+    * Append a binary string
+    * @param binary is a string of '0' and '1' where the most significant bit comes first
+    */
+   void append_binary(const std::string& binary);
+
+   /**
+    * Pad with zeros to the next byte and then to a multiple of word_bytes bytes
+    * @param word_bytes is the alignment in bytes
+    */
+   void align(unsigned long long word_bytes);
+
+   /**
+    * Pad with zeros to the next byte and then up to the given number of bytes
+    * @param n_bytes is the minimum size of the image in bytes
+    */
+   void extend(unsigned long long n_bytes);
+
+   /**
+    * Return the size of the image in bytes
+    */
+   size_t size() const
+   {
+      return bytes.size();
+   }
+
+   /**
+    * Return the content of the image
+    */
+   const std::vector<unsigned char>& data() const
+   {
+      return bytes;
+   }
+
+   /**
+    * Write the image as $readmemb lines, one memory word for each line with the most significant bit first; the last
+    * word may be shorter when the image size is not a multiple of word_bytes
+    * @param out_a is the stream receiving the even words
+    * @param out_b is the stream receiving the odd words; when null all the words are written to out_a
+    * @param word_bytes is the number of bytes of each memory word
+    */
+   void write_binary(std::ostream& out_a, std::ostream* out_b, unsigned long long word_bytes) const;
+
+   /**
+    * Write the image as $readmemh lines, one memory word for each line with the most significant digit first
+    * @param out is the output stream
+    * @param word_bytes is the number of bytes of each memory word
+    */
+   void write_hex(std::ostream& out, unsigned long long word_bytes) const;
+
+   /**
+    * Write the raw bytes of the image
+    * @param out is the output stream
+    */
+   void write_raw(std::ostream& out) const;
+};
+#endif
@@ -0,0 +1,82 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file thread_pool.cpp
+ * @brief Fixed size pool of worker threads executing independent tasks.
+ *
+ */
+#include "thread_pool.hpp"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(size_t n_threads) : stop(false)
+{
+   n_threads = std::max<size_t>(n_threads, 1);
+   workers.reserve(n_threads);
+   for(size_t i = 0; i < n_threads; ++i)
+   {
+      workers.emplace_back(&ThreadPool::WorkerLoop, this);
+   }
+}
+
+ThreadPool::~ThreadPool()
+{
+   {
+      std::lock_guard<std::mutex> lock(tasks_mutex);
+      stop = true;
+   }
+   tasks_cv.notify_all();
+   for(auto& worker : workers)
+   {
+      worker.join();
+   }
+}
+
+void ThreadPool::WorkerLoop()
+{
+   while(true)
+   {
+      std::function<void()> task;
+      {
+         std::unique_lock<std::mutex> lock(tasks_mutex);
+         tasks_cv.wait(lock, [&] { return stop || !tasks.empty(); });
+         if(tasks.empty())
+         {
+            return;
+         }
+         task = std::move(tasks.front());
+         tasks.pop_front();
+      }
+      task();
+   }
+}
@@ -0,0 +1,125 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file thread_pool.hpp
+ * @brief Fixed size pool of worker threads executing independent tasks.
+ *
+ */
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include "dbgPrintHelper.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class ThreadPool
+{
+ private:
+   /// The worker threads
+   std::vector<std::thread> workers;
+
+   /// The tasks waiting for a worker
+   std::deque<std::function<void()>> tasks;
+
+   /// Mutex protecting tasks and stop
+   std::mutex tasks_mutex;
+
+   /// Condition used to wake up the workers
+   std::condition_variable tasks_cv;
+
+   /// True when the pool is being destroyed
+   bool stop;
+
+   /**
+    * Body of each worker thread
+    */
+   void WorkerLoop();
+
+ public:
+   /**
+    * Constructor
+    * @param n_threads is the number of worker threads (at least one thread is always created)
+    */
+   explicit ThreadPool(size_t n_threads);
+
+   /**
+    * Destructor: completes the pending tasks and joins the workers
+    */
+   ~ThreadPool();
+
+   ThreadPool(const ThreadPool&) = delete;
+   ThreadPool& operator=(const ThreadPool&) = delete;
+
+   /**
+    * Return the number of worker threads
+    */
+   size_t size() const
+   {
+      return workers.size();
+   }
+
+   /**
+    * Enqueue a task; the task inherits the debug message indentation of the submitting thread.
+    * Exceptions thrown by the task are rethrown by the get() of the returned future.
+    * @param f is the callable to be executed
+    * @return the future holding the result of f
+    */
+   template <typename F>
+   std::future<std::invoke_result_t<std::decay_t<F>>> Submit(F&& f)
+   {
+      using result_t = std::invoke_result_t<std::decay_t<F>>;
+      auto task = std::make_shared<std::packaged_task<result_t()>>(std::forward<F>(f));
+      auto result = task->get_future();
+      const auto submit_indentation = indentation;
+      {
+         std::lock_guard<std::mutex> lock(tasks_mutex);
+         tasks.emplace_back([task, submit_indentation]() {
+            indentation = submit_indentation;
+            (*task)();
+         });
+      }
+      tasks_cv.notify_one();
+      return result;
+   }
+};
+#endif
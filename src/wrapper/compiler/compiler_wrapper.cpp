@@ -59,6 +59,7 @@
 #include "parse_tree.hpp"
 #include "polixml.hpp"
 #include "string_manipulation.hpp"
+#include "thread_pool.hpp"
 #include "tree_manager.hpp"
 #include "tree_node.hpp"
 #include "utility.hpp"
@@ -346,12 +347,18 @@
 #include "config_I386_LLVMVVD_OPT_EXE.hpp"
 #include "config_NPROFILE.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <fstream>
+#include <future>
 #include <list>
 #include <random>
 #include <regex>
+#include <sstream>
 #include <string>
 #include <unistd.h>
+#include <vector>
 
 enum CompilerMode : int
 {
@@ -395,7 +402,8 @@ CompilerWrapper::CompilerWrapper(const ParameterConstRef _Param, const CompilerW
 CompilerWrapper::~CompilerWrapper() = default;
 
 void CompilerWrapper::CompileFile(std::string& input_filename, const std::string& output_filename,
-                                  const std::string& parameters_line, int cm, const std::string& costTable)
+                                  const std::string& parameters_line, int cm, const std::string& costTable,
+                                  const std::string& analyzer_output_directory)
 {
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Compiling " + input_filename);
    THROW_ASSERT(cm == CM_EMPTY || (cm & ~CM_EMPTY) == cm,
@@ -403,7 +411,9 @@ void CompilerWrapper::CompileFile(std::string& input_filename, const std::string
 
    const auto compiler = GetCompiler();
    const auto output_temporary_directory = Param->getOption<std::string>(OPT_output_temporary_directory);
-   const auto compiler_output_filename = output_temporary_directory + "/" STR_CST_gcc_output;
+   /// front-end invocations may run concurrently, so each one gets its own output file
+   const auto compiler_output_filename =
+       unique_path(output_temporary_directory + "/" STR_CST_gcc_output ".%%%%%%").string();
 
    const auto isWholeProgram =
        Param->isOption(OPT_gcc_optimizations) &&
@@ -481,7 +491,7 @@ void CompilerWrapper::CompileFile(std::string& input_filename, const std::string
       {
          THROW_ERROR("Reading from standard input which does not contain any function definition");
       }
-      static int empty_counter = 0;
+      static std::atomic<int> empty_counter(0);
       real_filename = output_temporary_directory + "/empty_" + std::to_string(empty_counter++) + ".c";
       CopyFile(input_filename, real_filename);
       {
@@ -518,8 +528,8 @@ void CompilerWrapper::CompileFile(std::string& input_filename, const std::string
          command += " -Xclang -plugin-arg-" + compiler.ASTAnalyzer_plugin_name + " -Xclang -action";
          command += " -Xclang -plugin-arg-" + compiler.ASTAnalyzer_plugin_name + " -Xclang analyze";
          command += " -Xclang -plugin-arg-" + compiler.ASTAnalyzer_plugin_name + " -Xclang -outputdir";
-         command +=
-             " -Xclang -plugin-arg-" + compiler.ASTAnalyzer_plugin_name + " -Xclang " + output_temporary_directory;
+         command += " -Xclang -plugin-arg-" + compiler.ASTAnalyzer_plugin_name + " -Xclang " +
+                    (analyzer_output_directory.empty() ? output_temporary_directory : analyzer_output_directory);
 
          if(Param->isOption(OPT_input_format) &&
             (Param->getOption<Parameters_FileFormat>(OPT_input_format) == Parameters_FileFormat::FF_CPP ||
@@ -743,6 +753,49 @@ void CompilerWrapper::FillTreeManager(const tree_managerRef TM, std::vector<std:
       }
    }
 
+   /// the front-end IR cache stores the merged tree manager together with the architecture description produced by
+   /// the analyzer plugin: on a hit both compilation and IR parsing of the single source files are skipped
+   std::filesystem::path cache_entry;
+   std::string cache_key;
+   const auto original_source_files = source_files;
+   if(Param->isOption(OPT_frontend_cache) && !compile_only && !preprocess_only &&
+      std::find(source_files.begin(), source_files.end(), "-") == source_files.end())
+   {
+      cache_key = ComputeFrontendCacheKey(source_files, costTable);
+      cache_entry = Param->getOption<std::filesystem::path>(OPT_frontend_cache) / ContentDigest(cache_key);
+      const auto cached_key = [&]() -> std::string {
+         std::ifstream key_file(cache_entry / "key.txt");
+         return std::string(std::istreambuf_iterator<char>(key_file), std::istreambuf_iterator<char>());
+      }();
+      if(cached_key == cache_key && std::filesystem::exists(cache_entry / "ir.raw"))
+      {
+         INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level, "---Front-end IR cache hit: " + cache_entry.string());
+         if(std::filesystem::exists(cache_entry / "architecture.xml"))
+         {
+            CopyFile(cache_entry / "architecture.xml", output_temporary_directory + "/architecture.xml");
+         }
+         /// restore the side effects of the compilation on the source file names: rewritten sources are copied back
+         /// into the temporary directory under a fresh name
+         std::ifstream sources_file(cache_entry / "sources.txt");
+         size_t source_index;
+         std::string source_name;
+         while(sources_file >> source_index && std::getline(sources_file >> std::ws, source_name))
+         {
+            THROW_ASSERT(source_index < source_files.size(), "Corrupted front-end IR cache entry");
+            const auto restored_source =
+                unique_path(output_temporary_directory + "/cached_%%%%%%_" + source_name).string();
+            CopyFile(cache_entry / "sources" / source_name, restored_source);
+            source_files[source_index] = restored_source;
+         }
+         const auto TreeM = ParseTreeFile(Param, (cache_entry / "ir.raw").string());
+         TM->merge_tree_managers(TreeM);
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--");
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Front-end IR loaded from cache");
+         return;
+      }
+      INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level, "---Front-end IR cache miss: " + cache_entry.string());
+   }
+
 #if HAVE_I386_CLANG4_COMPILER || HAVE_I386_CLANG5_COMPILER || HAVE_I386_CLANG6_COMPILER ||    \
     HAVE_I386_CLANG7_COMPILER || HAVE_I386_CLANG8_COMPILER || HAVE_I386_CLANG9_COMPILER ||    \
     HAVE_I386_CLANG10_COMPILER || HAVE_I386_CLANG11_COMPILER || HAVE_I386_CLANG12_COMPILER || \
@@ -824,62 +877,31 @@ void CompilerWrapper::FillTreeManager(const tree_managerRef TM, std::vector<std:
       }
       return flags;
    }();
-   std::list<std::string> obj_files;
-   THROW_ASSERT(!multi_source || !(compile_only || preprocess_only), "");
-   for(auto& source_file : source_files)
-   {
+   /// compile a single source file and return the file to be linked or parsed
+   const auto compile_source = [&](std::string& source_file,
+                                   const std::string& analyzer_output_directory) -> std::string {
       const auto leaf_name = source_file == "-" ? "stdin-" : std::filesystem::path(source_file).filename().string();
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Compiling file " + source_file);
       const auto obj_file = ((compile_only || preprocess_only) && Param->isOption(OPT_output_file)) ?
                                 Param->getOption<std::string>(OPT_output_file) :
                                 unique_path(output_temporary_directory + "/" + leaf_name + ".%%%%%%.o").string();
-      CompileFile(source_file, obj_file, frontend_compiler_parameters, compiler_mode, costTable);
-      if(enable_LTO)
+      CompileFile(source_file, obj_file, frontend_compiler_parameters, compiler_mode, costTable,
+                  analyzer_output_directory);
+      if(enable_LTO || compile_only || preprocess_only)
       {
-         obj_files.push_back(obj_file);
+         return obj_file;
       }
-      else if(!(compile_only || preprocess_only))
-      {
-         auto gimple_file = output_temporary_directory + "/" + leaf_name + STR_CST_bambu_ir_suffix;
-         if(!std::filesystem::exists(gimple_file))
-         {
-            CompileFile(source_file, "", frontend_compiler_parameters, CM_EMPTY, costTable);
-            // source_file has been changed by previous call to CompileFile
-            gimple_file = output_temporary_directory + "/" + std::filesystem::path(source_file).filename().string() +
-                          STR_CST_bambu_ir_suffix;
-         }
-         obj_files.push_back(gimple_file);
-      }
-   }
-
-   if(enable_LTO)
-   {
-      const auto leaf_name = std::filesystem::path(source_files.front()).filename().string();
-      const auto ext_symbols_filename = output_temporary_directory + "/external-symbols.txt";
-      std::string lto_source = container_to_string(obj_files, STR_CST_string_separator);
-      std::string lto_obj = output_temporary_directory + "/" + leaf_name + ".lto.bc";
-      CompileFile(lto_source, lto_obj, "", CM_COMPILER_LTO, "");
-
-      lto_source = lto_obj;
-      lto_obj = output_temporary_directory + "/" + leaf_name + ".lto-opt.bc";
-      std::string opt_command = add_plugin_prefix(compiler_target, "1");
-
-      CompileFile(lto_source, lto_obj, opt_command, CM_COMPILER_OPT | CM_OPT_INTERNALIZE, costTable);
-
-      lto_source = lto_obj;
-      lto_obj = output_temporary_directory + "/" + leaf_name + ".lto-dump.bc";
-      THROW_ASSERT(std::filesystem::exists(ext_symbols_filename), "File not found: " + ext_symbols_filename);
-      const auto plugin_prefix = add_plugin_prefix(compiler_target);
-      opt_command = " --internalize-public-api-file=" + ext_symbols_filename + " " + plugin_prefix + "internalize " +
-                    clang_recipes(optimization_set, "") + " -panda-infile=" + container_to_string(source_files, ",");
-      CompileFile(lto_source, lto_obj, opt_command, CM_COMPILER_OPT | CM_OPT_DUMPGIMPLE, costTable);
-
-      const auto gimple_obj = output_temporary_directory + "/" + leaf_name + STR_CST_bambu_ir_suffix;
-      if(!std::filesystem::exists(gimple_obj))
+      auto gimple_file = output_temporary_directory + "/" + leaf_name + STR_CST_bambu_ir_suffix;
+      if(!std::filesystem::exists(gimple_file))
       {
-         THROW_ERROR("Object file not found: " + gimple_obj);
+         CompileFile(source_file, "", frontend_compiler_parameters, CM_EMPTY, costTable);
+         // source_file has been changed by previous call to CompileFile
+         gimple_file = output_temporary_directory + "/" + std::filesystem::path(source_file).filename().string() +
+                       STR_CST_bambu_ir_suffix;
       }
-      tree_managerRef TreeM = ParseTreeFile(Param, gimple_obj);
+      return gimple_file;
+   };
+   const auto merge_tree = [&](const tree_managerRef& TreeM) {
 #if !NPROFILE
       long int merge_time = 0;
       START_TIME(merge_time);
@@ -892,36 +914,257 @@ void CompilerWrapper::FillTreeManager(const tree_managerRef TM, std::vector<std:
          dump_exec_time("Tree merging time", merge_time);
       }
 #endif
+   };
+
+   THROW_ASSERT(!multi_source || !(compile_only || preprocess_only), "");
+   const auto frontend_jobs = Param->isOption(OPT_frontend_jobs) ? Param->getOption<size_t>(OPT_frontend_jobs) : 1;
+   const auto parallel_frontend = frontend_jobs > 1 && multi_source;
+   /// the analyzer plugin updates architecture.xml in place, so its invocations need private output directories
+   if(parallel_frontend && !enable_LTO && !(compiler_mode & CM_ANALYZER_ALL))
+   {
+      /// the single files are compiled and parsed concurrently, while the resulting tree managers are merged in the
+      /// order of the source files to obtain the same tree manager of the serial flow
+      ThreadPool frontend_pool(std::min(frontend_jobs, source_files.size()));
+      INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level,
+                     "---Compiling " + STR(source_files.size()) + " files with " + STR(frontend_pool.size()) +
+                         " front-end jobs");
+      std::vector<std::future<tree_managerRef>> parsed_trees;
+      for(auto& source_file : source_files)
+      {
+         parsed_trees.push_back(frontend_pool.Submit([&, &file = source_file]() -> tree_managerRef {
+            const auto obj_file = compile_source(file, "");
+            if(!std::filesystem::exists(obj_file))
+            {
+               THROW_ERROR("Object file not found: " + obj_file);
+            }
+            return ParseTreeFile(Param, obj_file, false);
+         }));
+      }
+      for(auto& parsed_tree : parsed_trees)
+      {
+         const auto TreeM = parsed_tree.get();
+         UniquifySSAVersions(TreeM);
+         bambu_ir_info = TreeM->GetIRInfo();
+         merge_tree(TreeM);
+      }
    }
-   else if(!Param->isOption(OPT_gcc_E) && !Param->isOption(OPT_gcc_S))
+   else
    {
-      for(const auto& obj_file : obj_files)
+      std::list<std::string> obj_files;
+      if(parallel_frontend)
+      {
+         /// the single files are compiled concurrently before the serial link: the analyzer plugin updates the
+         /// architecture description in place, so each invocation works on a private copy and the copies are merged
+         /// in the order of the source files
+         ThreadPool frontend_pool(std::min(frontend_jobs, source_files.size()));
+         INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level,
+                        "---Compiling " + STR(source_files.size()) + " files with " + STR(frontend_pool.size()) +
+                            " front-end jobs before linking");
+         const auto arch_file = output_temporary_directory + "/architecture.xml";
+         std::vector<std::string> arch_files;
+         std::vector<std::future<std::string>> compiled_files;
+         for(auto& source_file : source_files)
+         {
+            const auto job_directory = unique_path(output_temporary_directory + "/frontend_job.%%%%%%").string();
+            std::filesystem::create_directories(job_directory);
+            if(std::filesystem::exists(arch_file))
+            {
+               CopyFile(arch_file, job_directory + "/architecture.xml");
+            }
+            arch_files.push_back(job_directory + "/architecture.xml");
+            compiled_files.push_back(frontend_pool.Submit([&, &file = source_file, job_directory]() -> std::string {
+               return compile_source(file, job_directory);
+            }));
+         }
+         for(auto& compiled_file : compiled_files)
+         {
+            obj_files.push_back(compiled_file.get());
+         }
+         MergeArchitectureXML(arch_files);
+      }
+      else
       {
-         if(!std::filesystem::exists(obj_file))
+         for(auto& source_file : source_files)
          {
-            THROW_ERROR("Object file not found: " + obj_file);
+            const auto obj_file = compile_source(source_file, "");
+            if(enable_LTO || !(compile_only || preprocess_only))
+            {
+               obj_files.push_back(obj_file);
+            }
          }
-         tree_managerRef TreeM = ParseTreeFile(Param, obj_file);
+      }
 
-#if !NPROFILE
-         long int merge_time = 0;
-         START_TIME(merge_time);
-#endif
-         TM->merge_tree_managers(TreeM);
-#if !NPROFILE
-         STOP_TIME(merge_time);
-         if(output_level >= OUTPUT_LEVEL_VERBOSE)
+      if(enable_LTO)
+      {
+         const auto leaf_name = std::filesystem::path(source_files.front()).filename().string();
+         const auto ext_symbols_filename = output_temporary_directory + "/external-symbols.txt";
+         std::string lto_source = container_to_string(obj_files, STR_CST_string_separator);
+         std::string lto_obj = output_temporary_directory + "/" + leaf_name + ".lto.bc";
+         CompileFile(lto_source, lto_obj, "", CM_COMPILER_LTO, "");
+
+         lto_source = lto_obj;
+         lto_obj = output_temporary_directory + "/" + leaf_name + ".lto-opt.bc";
+         std::string opt_command = add_plugin_prefix(compiler_target, "1");
+
+         CompileFile(lto_source, lto_obj, opt_command, CM_COMPILER_OPT | CM_OPT_INTERNALIZE, costTable);
+
+         lto_source = lto_obj;
+         lto_obj = output_temporary_directory + "/" + leaf_name + ".lto-dump.bc";
+         THROW_ASSERT(std::filesystem::exists(ext_symbols_filename), "File not found: " + ext_symbols_filename);
+         const auto plugin_prefix = add_plugin_prefix(compiler_target);
+         opt_command = " --internalize-public-api-file=" + ext_symbols_filename + " " + plugin_prefix + "internalize " +
+                       clang_recipes(optimization_set, "") + " -panda-infile=" + container_to_string(source_files, ",");
+         CompileFile(lto_source, lto_obj, opt_command, CM_COMPILER_OPT | CM_OPT_DUMPGIMPLE, costTable);
+
+         const auto gimple_obj = output_temporary_directory + "/" + leaf_name + STR_CST_bambu_ir_suffix;
+         if(!std::filesystem::exists(gimple_obj))
          {
-            dump_exec_time("Tree merging time", merge_time);
+            THROW_ERROR("Object file not found: " + gimple_obj);
+         }
+         merge_tree(ParseTreeFile(Param, gimple_obj));
+      }
+      else if(!Param->isOption(OPT_gcc_E) && !Param->isOption(OPT_gcc_S))
+      {
+         for(const auto& obj_file : obj_files)
+         {
+            if(!std::filesystem::exists(obj_file))
+            {
+               THROW_ERROR("Object file not found: " + obj_file);
+            }
+            merge_tree(ParseTreeFile(Param, obj_file));
          }
-#endif
       }
    }
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "Ended compilation of single files");
+
+   if(!cache_entry.empty())
+   {
+      const auto stored = StoreCacheEntry(cache_entry, [&](const std::filesystem::path& staging) {
+         std::filesystem::create_directories(staging);
+         {
+            std::ofstream raw_file(staging / "ir.raw");
+            raw_file << TM;
+         }
+         const auto arch_file = output_temporary_directory + "/architecture.xml";
+         if(std::filesystem::exists(arch_file))
+         {
+            CopyFile(arch_file, staging / "architecture.xml");
+         }
+         {
+            /// source files rewritten by the compilation (e.g., extended with an empty function) are stored as well
+            std::ofstream sources_file(staging / "sources.txt");
+            for(size_t source_index = 0; source_index < source_files.size(); ++source_index)
+            {
+               if(source_files[source_index] != original_source_files[source_index])
+               {
+                  const auto source_name =
+                      STR(source_index) + "_" + std::filesystem::path(source_files[source_index]).filename().string();
+                  std::filesystem::create_directories(staging / "sources");
+                  CopyFile(source_files[source_index], staging / "sources" / source_name);
+                  sources_file << source_index << " " << source_name << "\n";
+               }
+            }
+         }
+         std::ofstream key_file(staging / "key.txt");
+         key_file << cache_key;
+      });
+      if(!stored)
+      {
+         THROW_WARNING("Front-end IR cache entry could not be stored: " + cache_entry.string());
+      }
+   }
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--");
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Front-end compiler finished");
 }
 
+void CompilerWrapper::MergeArchitectureXML(const std::vector<std::string>& architecture_files) const
+{
+   const auto arch_file = Param->getOption<std::string>(OPT_output_temporary_directory) + "/architecture.xml";
+   /// functions are sorted by symbol, as the analyzer plugin writes them
+   std::map<std::string, xml_nodeRef> functions;
+   std::vector<XMLDomParser> parsers;
+   parsers.reserve(architecture_files.size());
+   for(const auto& architecture_file : architecture_files)
+   {
+      if(!std::filesystem::exists(architecture_file))
+      {
+         continue;
+      }
+      parsers.emplace_back(architecture_file);
+      auto& parser = parsers.back();
+      parser.Exec();
+      const auto root = parser ? parser.get_document()->get_root_node() : nullptr;
+      if(!root || root->get_name() != "module")
+      {
+         THROW_ERROR("Invalid architecture description: " + architecture_file);
+      }
+      for(const auto& child : root->get_children())
+      {
+         const auto function = GetPointer<const xml_element>(child);
+         if(function && function->get_attribute("symbol"))
+         {
+            /// the description written first takes precedence
+            functions.emplace(function->get_attribute("symbol")->get_value(), child);
+         }
+      }
+   }
+   if(parsers.empty())
+   {
+      return;
+   }
+   xml_document document;
+   auto module = document.create_root_node("module");
+   for(const auto& function : functions)
+   {
+      module->add_child_element(function.second);
+   }
+   document.write_to_file_formatted(arch_file);
+}
+
+std::string CompilerWrapper::ComputeFrontendCacheKey(const std::vector<std::string>& source_files,
+                                                     const std::string& costTable) const
+{
+   const auto compiler = GetCompiler();
+   const auto output_temporary_directory = Param->getOption<std::string>(OPT_output_temporary_directory);
+   std::stringstream key;
+   key << Param->PrintVersion() << "\n";
+   key << "compiler: " << compiler.gcc << " " << compiler.extra_options << "\n";
+   key << "parameters: " << frontend_compiler_parameters << "\n";
+   key << "cost table: " << costTable << "\n";
+   key << "input format: " << static_cast<int>(Param->getOption<Parameters_FileFormat>(OPT_input_format)) << "\n";
+   key << "top functions: "
+       << (Param->isOption(OPT_top_functions_names) ? Param->getOption<std::string>(OPT_top_functions_names) : "")
+       << "\n";
+   key << "interface: " << static_cast<int>(Param->getOption<HLSFlowStep_Type>(OPT_interface_type)) << "\n";
+   key << "expose globals: " << Param->getOption<bool>(OPT_expose_globals) << "\n";
+   key << "compute sizeof: " << Param->getOption<bool>(OPT_compute_size_of) << "\n";
+   key << "discrepancy: " << (Param->isOption(OPT_discrepancy) && Param->getOption<bool>(OPT_discrepancy))
+       << (Param->isOption(OPT_discrepancy_hw) && Param->getOption<bool>(OPT_discrepancy_hw)) << "\n";
+   for(const auto& parameter : {"disable-pragma-parsing", "enable-CSROA", "max-CSROA"})
+   {
+      key << parameter << ": " << (Param->IsParameter(parameter) ? Param->GetParameter<std::string>(parameter) : "")
+          << "\n";
+   }
+
+   /// source files are keyed by their preprocessed text, so that changes to included headers are detected as well
+   const auto preprocessed_file = unique_path(output_temporary_directory + "/frontend_cache_key.%%%%%%.i");
+   for(const auto& source_file : source_files)
+   {
+      const auto command = compiler.gcc + " -E -D__NO_INLINE__ " + compiler.extra_options + " " +
+                           frontend_compiler_parameters + " -o " + preprocessed_file.string() + " \"" +
+                           source_file + "\"";
+      if(IsError(PandaSystem(Param, command, false, output_temporary_directory + "/" STR_CST_gcc_output)))
+      {
+         THROW_ERROR("Front-end compiler returns an error during preprocessing of " + source_file);
+      }
+      std::ifstream preprocessed(preprocessed_file);
+      const std::string text(std::istreambuf_iterator<char>(preprocessed), {});
+      key << "source: " << source_file << " " << ContentDigest(text) << "\n";
+   }
+   std::filesystem::remove(preprocessed_file);
+   return key.str();
+}
+
 void CompilerWrapper::InitializeCompilerParameters()
 {
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Initializing gcc parameters");
@@ -205,9 +205,18 @@ class CompilerWrapper
     * @param parameters_line are the parameters to be passed to the frontend compiler
     * @param multiple_files is the true in case multiple files are considered.
     * @param cm is the mode in which we compile
+    * @param analyzer_output_directory is the directory where the analyzer plugin updates the architecture
+    * description (default is the temporary directory)
     */
    void CompileFile(std::string& input_filename, const std::string& output_file, const std::string& parameters_line,
-                    int cm, const std::string& costTable);
+                    int cm, const std::string& costTable, const std::string& analyzer_output_directory = "");
+
+   /**
+    * Merge the architecture descriptions written by concurrent analyzer invocations into the one of the temporary
+    * directory, giving precedence to the earlier descriptions as the analyzer plugin does when it updates the file
+    * @param architecture_files are the architecture descriptions in source file order
+    */
+   void MergeArchitectureXML(const std::vector<std::string>& architecture_files) const;
 
    std::string GetAnalyzeCompiler() const;
 
@@ -256,6 +265,17 @@ class CompilerWrapper
 
    std::string add_plugin_prefix(CompilerWrapper_CompilerTarget target, std::string O_level = "") const;
 
+   /**
+    * Compute the key identifying the front-end IR cache entry of a set of source files
+    * The key covers the preprocessed sources, the front-end compiler and all the options which are forwarded to it
+    * or to its plugins, so that runs differing only in HLS options share the same entry.
+    * @param source_files are the source files to be compiled
+    * @param costTable is the cost table passed to the front-end plugins
+    * @return the textual description of the key, stored in the entry to detect digest collisions
+    */
+   std::string ComputeFrontendCacheKey(const std::vector<std::string>& source_files,
+                                       const std::string& costTable) const;
+
  public:
    /// The version of the frontend compiler
    static std::string bambu_ir_info;
@@ -61,12 +61,17 @@
 #include "utility.hpp"
 
 /// Standard include
+#include <algorithm>
 #include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
 #include <unistd.h>
 
 /// Streams include
 #include <fstream>
 #include <iosfwd>
+#include <iterator>
 
 /// STL include
 #include "custom_map.hpp"
@@ -156,14 +161,16 @@ flopoco_wrapper::flopoco_wrapper(int
                                      _debug_level
 #endif
                                  ,
-                                 const std::string& FU_target)
+                                 const std::string& FU_target, const std::string& _cache_dir)
     :
 #ifndef NDEBUG
       debug_level(_debug_level),
 #endif
       PP(STD_OPENING_CHAR, STD_CLOSING_CHAR, 3),
       type(UT_UNKNOWN),
-      signed_p(false)
+      signed_p(false),
+      cache_dir(_cache_dir),
+      target_family(FU_target)
 {
    // Get the target architecture
    if("Spartan-3" == FU_target)
@@ -288,6 +295,30 @@ void flopoco_wrapper::add_FU(const std::string& FU_type, unsigned int FU_prec_in
    PRINT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level,
                  "Creating FloPoCo operator for unit " + FU_type + "(" + STR(FU_prec_in) + "-" + STR(FU_prec_out) +
                      "-" + pipe_parameter + ")");
+   const auto cache_key =
+       cache_dir.empty() ? std::string() : get_cache_key(FU_type, FU_prec_in, FU_prec_out, FU_name, pipe_parameter);
+   if(!cache_dir.empty())
+   {
+      cached_unit unit;
+      if(load_cached_unit(cache_key, unit))
+      {
+         PRINT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "- Unit " + unit.FU_name_stored + " loaded from cache");
+         FU_to_prec.insert(make_pair(unit.FU_name_stored, std::make_pair(unit.FU_prec_in, unit.FU_prec_out)));
+         if(cached_FUs.find(unit.FU_name_stored) == cached_FUs.end())
+         {
+            cached_FU_order.push_back(unit.FU_name_stored);
+         }
+         cached_FUs[unit.FU_name_stored] = unit;
+         return;
+      }
+   }
+   /// the common components of the unit are collected in an empty global operator list, so that they can be stored
+   /// in the cache together with the unit
+   std::vector<flopoco::Operator*> common_ops;
+   if(!cache_dir.empty())
+   {
+      common_ops.swap(*target->getGlobalOpListRef());
+   }
 
    if(pipe_parameter != "" && pipe_parameter != "0")
    {
@@ -563,6 +594,30 @@ void flopoco_wrapper::add_FU(const std::string& FU_type, unsigned int FU_prec_in
       op->changeName(OUT_WRAP_PREFIX + FU_name_stored);
       FUs[OUT_WRAP_PREFIX + FU_name_stored] = op;
    }
+
+   if(!cache_dir.empty())
+   {
+      cached_unit unit;
+      unit.key = cache_key;
+      unit.FU_name_stored = FU_name_stored;
+      unit.FU_prec_in = FU_prec_in;
+      unit.FU_prec_out = FU_prec_out;
+      /// merge the common components of the unit into the global list, skipping the ones already present
+      auto& global_ops = *target->getGlobalOpListRef();
+      for(const auto common_op : global_ops)
+      {
+         unit.common_names.push_back(common_op->getName());
+         if(std::find_if(common_ops.begin(), common_ops.end(), [&](const flopoco::Operator* other) {
+               return other->getName() == common_op->getName();
+            }) == common_ops.end())
+         {
+            common_ops.push_back(common_op);
+         }
+      }
+      global_ops.swap(common_ops);
+      cached_FUs.erase(FU_name_stored);
+      generated_FUs[FU_name_stored] = std::make_pair(unit, type);
+   }
 }
 
 unsigned int flopoco_wrapper::get_FUPipelineDepth(const std::string& FU_name, const unsigned int FU_prec_in,
@@ -570,13 +625,23 @@ unsigned int flopoco_wrapper::get_FUPipelineDepth(const std::string& FU_name, co
                                                   const std::string& pipe_parameter) const
 {
    std::string FU_name_stored = ENCODE_NAME(FU_name, FU_prec_in, FU_prec_out, pipe_parameter);
+   const auto cached = cached_FUs.find(FU_name_stored);
+   if(cached != cached_FUs.end())
+   {
+      return cached->second.pipeline_depth;
+   }
+   return compute_pipeline_depth(FU_name_stored, type);
+}
+
+unsigned int flopoco_wrapper::compute_pipeline_depth(const std::string& FU_name_stored, unit_type unit) const
+{
    unsigned int fu_pipe_depth = static_cast<unsigned int>(get_FU(WRAPPED_PREFIX + FU_name_stored)->getPipelineDepth());
-   if(type != flopoco_wrapper::UT_IFIX2FP and type != flopoco_wrapper::UT_UFIX2FP)
+   if(unit != flopoco_wrapper::UT_IFIX2FP and unit != flopoco_wrapper::UT_UFIX2FP)
    {
       fu_pipe_depth += static_cast<unsigned int>(get_FU(IN_WRAP_PREFIX + FU_name_stored)->getPipelineDepth());
    }
-   if(type != flopoco_wrapper::UT_FP2UFIX and type != flopoco_wrapper::UT_FP2IFIX and
-      type != flopoco_wrapper::UT_compare_expr)
+   if(unit != flopoco_wrapper::UT_FP2UFIX and unit != flopoco_wrapper::UT_FP2IFIX and
+      unit != flopoco_wrapper::UT_compare_expr)
    {
       fu_pipe_depth += static_cast<unsigned int>(get_FU(OUT_WRAP_PREFIX + FU_name_stored)->getPipelineDepth());
    }
@@ -1060,6 +1125,14 @@ int flopoco_wrapper::InternalWriteVHDL(const std::string& FU_name, const unsigne
       PRINT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "- Something went wrong in file creation");
       return -1;
    }
+   const auto cached = cached_FUs.find(FU_name_stored);
+   if(cached != cached_FUs.end())
+   {
+      file << cached->second.vhdl;
+      FU_files.insert(filename);
+      PRINT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "- Successfully written from cache!");
+      return 0;
+   }
    // Call FloPoCo method to generate VHDL for Functional Unit and Conversion Units
    {
       try
@@ -1078,6 +1151,12 @@ int flopoco_wrapper::InternalWriteVHDL(const std::string& FU_name, const unsigne
    FU_files.insert(filename);
    file.close();
    OPLIST.clear();
+   const auto generated = generated_FUs.find(FU_name_stored);
+   if(generated != generated_FUs.end())
+   {
+      std::ifstream written(filename);
+      generated->second.first.vhdl.assign(std::istreambuf_iterator<char>(written), std::istreambuf_iterator<char>());
+   }
    PRINT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "- Successfully written to file!");
    return 0;
 }
@@ -1092,7 +1171,89 @@ int flopoco_wrapper::writeVHDL(const std::string& FU_name, const unsigned int FU
 std::string flopoco_wrapper::writeVHDLcommon()
 {
    std::vector<flopoco::Operator*>* common_oplist = target->getGlobalOpListRef();
-   if(!common_oplist || common_oplist->empty())
+   if(cache_dir.empty() || (generated_FUs.empty() && cached_FUs.empty()))
+   {
+      if(!common_oplist || common_oplist->empty())
+      {
+         return "";
+      }
+      const std::string filename = "FloPoCo_common" FILE_EXT;
+      std::ofstream file(filename);
+      if(!file.is_open())
+      {
+         THROW_UNREACHABLE("Something went wrong in file creation");
+         return "";
+      }
+      // Call FloPoCo method to generate VHDL for all common units
+      {
+         try
+         {
+            flopoco::Operator::outputVHDLToFile(*common_oplist, file);
+         }
+         catch(const std::string& s)
+         {
+            THROW_UNREACHABLE("Exception while generating " + s);
+         }
+      }
+      // Mark the file as generated
+      return filename;
+   }
+
+   /// the common components are generated one at a time, so that the code of each of them can be stored in the cache
+   /// together with the units requiring it; the components of the units loaded from the cache follow
+   std::vector<std::string> common_names;
+   CustomUnorderedMap<std::string, std::string> common_vhdl;
+   const auto common_chunk = unique_path("FloPoCo_common.%%%%%%" FILE_EXT).string();
+   for(const auto common_op : *common_oplist)
+   {
+      {
+         std::ofstream chunk_file(common_chunk);
+         std::vector<flopoco::Operator*> chunk_oplist(1, common_op);
+         try
+         {
+            flopoco::Operator::outputVHDLToFile(chunk_oplist, chunk_file);
+         }
+         catch(const std::string& s)
+         {
+            THROW_UNREACHABLE("Exception while generating " + s);
+         }
+      }
+      std::ifstream chunk_file(common_chunk);
+      common_names.push_back(common_op->getName());
+      common_vhdl[common_op->getName()].assign(std::istreambuf_iterator<char>(chunk_file),
+                                               std::istreambuf_iterator<char>());
+   }
+   std::remove(common_chunk.c_str());
+   for(const auto& FU_name_stored : cached_FU_order)
+   {
+      const auto& unit = cached_FUs.at(FU_name_stored);
+      for(size_t i = 0; i < unit.common_names.size(); ++i)
+      {
+         if(common_vhdl.find(unit.common_names.at(i)) == common_vhdl.end())
+         {
+            common_names.push_back(unit.common_names.at(i));
+            common_vhdl[unit.common_names.at(i)] = unit.common_vhdl.at(i);
+         }
+      }
+   }
+   for(auto& [FU_name_stored, generated] : generated_FUs)
+   {
+      auto& unit = generated.first;
+      if(unit.vhdl.empty())
+      {
+         continue;
+      }
+      unit.pipeline_depth = compute_pipeline_depth(FU_name_stored, generated.second);
+      unit.in_ports = get_ports(WRAPPED_PREFIX + FU_name_stored, 0, port_in, false);
+      unit.out_ports = get_ports(WRAPPED_PREFIX + FU_name_stored, 0, port_out, false);
+      for(const auto& common_name : unit.common_names)
+      {
+         unit.common_vhdl.push_back(common_vhdl.at(common_name));
+      }
+      store_cached_unit(unit);
+   }
+   generated_FUs.clear();
+   if(common_names.empty())
    {
       return "";
    }
@@ -1103,19 +1264,110 @@ std::string flopoco_wrapper::writeVHDLcommon()
       THROW_UNREACHABLE("Something went wrong in file creation");
       return "";
    }
-   // Call FloPoCo method to generate VHDL for all common units
+   for(const auto& common_name : common_names)
    {
-      try
+      file << common_vhdl.at(common_name);
+   }
+   return filename;
+}
+
+std::string flopoco_wrapper::get_cache_key(const std::string& FU_type, unsigned int FU_prec_in,
+                                           unsigned int FU_prec_out, const std::string& FU_name,
+                                           const std::string& pipe_parameter) const
+{
+   /// FloPoCo is built from the sources distributed with the framework, so the framework version identifies it
+   return "flopoco " PACKAGE_VERSION " " + target_family + " " + FU_type + " " + FU_name + " " + STR(FU_prec_in) +
+          " " + STR(FU_prec_out) + " " + (pipe_parameter.empty() ? std::string("0") : pipe_parameter);
+}
+
+bool flopoco_wrapper::load_cached_unit(const std::string& key, cached_unit& unit) const
+{
+   const auto entry = std::filesystem::path(cache_dir) / ContentDigest(key);
+   const auto read_file = [&](const std::string& name) -> std::string {
+      std::ifstream in(entry / name);
+      return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+   };
+   if(read_file("key.txt") != key)
+   {
+      return false;
+   }
+   std::ifstream info(entry / "unit.txt");
+   size_t n_in = 0, n_out = 0, n_common = 0;
+   if(!(info >> unit.FU_name_stored >> unit.FU_prec_in >> unit.FU_prec_out >> unit.pipeline_depth >> n_in))
+   {
+      return false;
+   }
+   unit.in_ports.resize(n_in);
+   for(auto& port : unit.in_ports)
+   {
+      info >> port;
+   }
+   info >> n_out;
+   unit.out_ports.resize(n_out);
+   for(auto& port : unit.out_ports)
+   {
+      info >> port;
+   }
+   info >> n_common;
+   unit.common_names.resize(n_common);
+   for(auto& common_name : unit.common_names)
+   {
+      info >> common_name;
+   }
+   if(!info || !std::filesystem::exists(entry / "unit.vhdl"))
+   {
+      return false;
+   }
+   unit.key = key;
+   unit.vhdl = read_file("unit.vhdl");
+   for(size_t i = 0; i < n_common; ++i)
+   {
+      unit.common_vhdl.push_back(read_file("common_" + STR(i) + FILE_EXT));
+   }
+   return true;
+}
+
+void flopoco_wrapper::store_cached_unit(const cached_unit& unit) const
+{
+   const auto entry = std::filesystem::path(cache_dir) / ContentDigest(unit.key);
+   const auto stored = StoreCacheEntry(entry, [&](const std::filesystem::path& staging) {
+      std::filesystem::create_directories(staging);
       {
-         flopoco::Operator::outputVHDLToFile(*common_oplist, file);
+         std::ofstream info(staging / "unit.txt");
+         info << unit.FU_name_stored << "\n" << unit.FU_prec_in << " " << unit.FU_prec_out << "\n"
+              << unit.pipeline_depth << "\n"
+              << unit.in_ports.size();
+         for(const auto& port : unit.in_ports)
+         {
+            info << " " << port;
+         }
+         info << "\n" << unit.out_ports.size();
+         for(const auto& port : unit.out_ports)
+         {
+            info << " " << port;
+         }
+         info << "\n" << unit.common_names.size() << "\n";
+         for(const auto& common_name : unit.common_names)
+         {
+            info << common_name << "\n";
+         }
       }
-      catch(const std::string& s)
       {
-         THROW_UNREACHABLE("Exception while generating " + s);
+         std::ofstream vhdl_file(staging / "unit.vhdl");
+         vhdl_file << unit.vhdl;
       }
+      for(size_t i = 0; i < unit.common_vhdl.size(); ++i)
+      {
+         std::ofstream common_file(staging / ("common_" + STR(i) + FILE_EXT));
+         common_file << unit.common_vhdl.at(i);
+      }
+      std::ofstream key_file(staging / "key.txt");
+      key_file << unit.key;
+   });
+   if(!stored)
+   {
+      THROW_WARNING("FloPoCo cache entry could not be stored: " + entry.string());
    }
-   // Mark the file as generated
-   return filename;
 }
 
 const std::vector<std::string> flopoco_wrapper::get_ports(const std::string& FU_name_stored,
@@ -1124,6 +1376,18 @@ const std::vector<std::string> flopoco_wrapper::get_ports(const std::string& FU_
                                                           bool ASSERT_PARAMETER(check_ports)) const
 {
    std::vector<std::string> ports;
+   if(!cached_FUs.empty() && FU_name_stored.find(WRAPPED_PREFIX) == 0)
+   {
+      const auto cached = cached_FUs.find(FU_name_stored.substr(std::string(WRAPPED_PREFIX).size()));
+      if(cached != cached_FUs.end())
+      {
+         ports = local_type == port_in ? cached->second.in_ports : cached->second.out_ports;
+         THROW_ASSERT(!check_ports || expected_ports == ports.size(),
+                      "Expected a different number of " +
+                          (local_type == port_in ? std::string("input") : std::string("output")) + " ports");
+         return ports;
+      }
+   }
    flopoco::Operator* op = get_FU(FU_name_stored);
    for(int i = 0; i < op->getIOListSize(); i++)
    {
@@ -139,6 +139,77 @@ class flopoco_wrapper
 
    flopoco::Target* target;
 
+   /// Directory of the persistent cache of the generated Functional Units (empty if the cache is disabled)
+   const std::string cache_dir;
+
+   /// Family of the target device
+   const std::string target_family;
+
+   /**
+    * Functional Unit stored in the persistent cache
+    */
+   struct cached_unit
+   {
+      /// Key identifying the FloPoCo operator
+      std::string key;
+      /// Name of the stored Functional Unit
+      std::string FU_name_stored;
+      /// Input and output precisions of the stored Functional Unit
+      unsigned int FU_prec_in{0}, FU_prec_out{0};
+      /// Pipeline depth of the Functional Unit including the conversion units
+      unsigned int pipeline_depth{0};
+      /// Input and output ports of the wrapped Functional Unit
+      std::vector<std::string> in_ports, out_ports;
+      /// VHDL code of the Functional Unit and of its wrapper
+      std::string vhdl;
+      /// Names of the common components required by the Functional Unit
+      std::vector<std::string> common_names;
+      /// VHDL code of the common components
+      std::vector<std::string> common_vhdl;
+   };
+
+   /// Functional Units loaded from the cache
+   CustomUnorderedMap<std::string, cached_unit> cached_FUs;
+
+   /// Stored names of the Functional Units loaded from the cache in order of insertion
+   std::vector<std::string> cached_FU_order;
+
+   /// Functional Units generated in this run to be stored in the cache together with their common components
+   CustomUnorderedMap<std::string, std::pair<cached_unit, unit_type>> generated_FUs;
+
+   /**
+    * Returns the cache key of a Functional Unit
+    * @param FU_type is the type of the Functional Unit
+    * @param FU_prec_in is the input precision
+    * @param FU_prec_out is the output precision
+    * @param FU_name is the name of the Functional Unit
+    * @param pipe_parameter is the target frequency of the pipelined unit (empty or "0" for the combinational one)
+    * @return the key identifying the generated code in the persistent cache
+    */
+   std::string get_cache_key(const std::string& FU_type, unsigned int FU_prec_in, unsigned int FU_prec_out,
+                             const std::string& FU_name, const std::string& pipe_parameter) const;
+
+   /**
+    * Loads a Functional Unit from the cache
+    * @param key is the cache key of the Functional Unit
+    * @param unit is where the loaded data are stored
+    * @return true if a valid entry has been found
+    */
+   bool load_cached_unit(const std::string& key, cached_unit& unit) const;
+
+   /**
+    * Stores a Functional Unit in the cache
+    * @param unit is the Functional Unit to be stored
+    */
+   void store_cached_unit(const cached_unit& unit) const;
+
+   /**
+    * Returns the pipeline depth of a generated Functional Unit
+    * @param FU_name_stored is a string representing the stored FU name
+    * @param unit is the type of the Functional Unit
+    */
+   unsigned int compute_pipeline_depth(const std::string& FU_name_stored, unit_type unit) const;
+
    /**
     * Returns one of the generated Functional Units
     * @param FU_name_stored is a string representing the stored FU name
@@ -193,8 +264,10 @@ class flopoco_wrapper
    /**
     * Constructor
     * @param debug is the current debug level
+    * @param FU_target is the family of the target device
+    * @param cache_dir is the directory of the persistent cache of the generated Functional Units; empty to disable it
     */
-   flopoco_wrapper(int _debug_level, const std::string& FU_target);
+   flopoco_wrapper(int _debug_level, const std::string& FU_target, const std::string& cache_dir = "");
 
    /**
     * Destructor